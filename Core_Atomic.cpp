@@ -2,10 +2,106 @@
 // Validates atomic operations and provides atomic utilities
 
 #include "Core_Atomic.h"
+#include <algorithm>
+#include <bit>
 #include <cstdio>
+#include <new>
+#include <vector>
+
+#if AARENDOCORE_PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <ctime>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
 
 AARENDOCORE_NAMESPACE_BEGIN
 
+// ============================================================================
+// MCS QUEUE NODES - Per-thread, one per lock held at once
+// ============================================================================
+
+namespace {
+    constexpr u32 MCS_NODES_PER_THREAD = 32;   // Locks one thread can hold at once
+    
+    struct McsNodeSet {
+        McsNode nodes[MCS_NODES_PER_THREAD];
+        u32 used = 0;                          // Bit per node in nodes[]
+    };
+    
+    thread_local McsNodeSet t_mcsNodes;
+}
+
+McsNode* AcquireMcsNode() noexcept {
+    McsNodeSet& set = t_mcsNodes;
+    u32 free = ~set.used;
+    if (free == 0) {
+        // Nesting deeper than the set - a bug, but keep the lock correct
+        AARENDOCORE_ASSERT(false);
+        return new McsNode();
+    }
+    
+    u32 index = static_cast<u32>(std::countr_zero(free));
+    set.used |= 1u << index;
+    return &set.nodes[index];
+}
+
+void ReleaseMcsNode(McsNode* node) noexcept {
+    McsNodeSet& set = t_mcsNodes;
+    if (node < set.nodes || node >= set.nodes + MCS_NODES_PER_THREAD) {
+        delete node;
+        return;
+    }
+    set.used &= ~(1u << static_cast<u32>(node - set.nodes));
+}
+
+// ============================================================================
+// ADDRESS WAIT
+// ============================================================================
+
+bool WaitOnWord(const std::atomic<u32>& word, u32 expected, u64 timeoutNs) noexcept {
+    static_assert(sizeof(std::atomic<u32>) == sizeof(u32),
+                  "Address wait needs a plain 32-bit atomic");
+    void* address = const_cast<std::atomic<u32>*>(&word);
+    
+#if AARENDOCORE_PLATFORM_WINDOWS
+    // Round up so a short timeout still sleeps instead of spinning
+    DWORD timeoutMs = INFINITE;
+    if (timeoutNs > 0) {
+        const u64 ms = (timeoutNs + 999999) / 1000000;
+        timeoutMs = ms >= INFINITE ? INFINITE - 1 : static_cast<DWORD>(ms);
+    }
+    if (!WaitOnAddress(address, &expected, sizeof(u32), timeoutMs)) {
+        return GetLastError() != ERROR_TIMEOUT;
+    }
+    return true;
+#else
+    timespec timeout{};
+    timespec* timeoutPtr = nullptr;
+    if (timeoutNs > 0) {
+        timeout.tv_sec = static_cast<time_t>(timeoutNs / 1000000000);
+        timeout.tv_nsec = static_cast<long>(timeoutNs % 1000000000);
+        timeoutPtr = &timeout;
+    }
+    // Relative timeout; EAGAIN (word already moved) and EINTR are wakes too
+    if (syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, timeoutPtr, nullptr, 0) != 0) {
+        return errno != ETIMEDOUT;
+    }
+    return true;
+#endif
+}
+
+void WakeAllOnWord(std::atomic<u32>& word) noexcept {
+#if AARENDOCORE_PLATFORM_WINDOWS
+    WakeByAddressAll(&word);
+#else
+    syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#endif
+}
+
 // ============================================================================
 // ATOMIC VALIDATION
 // ============================================================================
@@ -17,6 +113,7 @@ namespace {
             ValidateLockFree();
             ValidateAtomicOperations();
             ValidateSpinlock();
+            ValidateMcsLock();
             ValidateSequenceCounter();
         }
         
@@ -92,6 +189,28 @@ namespace {
             AARENDOCORE_ASSERT(!lock.is_locked());
         }
         
+        void ValidateMcsLock() {
+            McsLock first;
+            McsLock second;
+            
+            AARENDOCORE_ASSERT(!first.is_locked());
+            
+            first.lock();
+            AARENDOCORE_ASSERT(first.is_locked());
+            AARENDOCORE_ASSERT(!first.try_lock());
+            
+            // Nested, released out of order - nodes must not be mixed up
+            AARENDOCORE_ASSERT(second.try_lock());
+            first.unlock();
+            AARENDOCORE_ASSERT(!first.is_locked());
+            AARENDOCORE_ASSERT(second.is_locked());
+            
+            first.lock();
+            second.unlock();
+            first.unlock();
+            AARENDOCORE_ASSERT(!first.is_locked() && !second.is_locked());
+        }
+        
         void ValidateSequenceCounter() {
             SequenceCounter<u64> seq(1000);
             
@@ -131,11 +250,12 @@ extern "C" AARENDOCORE_API const char* AARendoCore_GetAtomicInfo() {
     std::snprintf(info, sizeof(info),
         "Atomic Info: "
         "u64_lockfree=%d, ptr_lockfree=%d, "
-        "spinlock_size=%zu, sequence_size=%zu, "
+        "spinlock_size=%zu, mcslock_size=%zu, sequence_size=%zu, "
         "cache_line=%zu",
         std::atomic<u64>{}.is_lock_free() ? 1 : 0,
         std::atomic<void*>{}.is_lock_free() ? 1 : 0,
         sizeof(Spinlock),
+        sizeof(McsLock),
         sizeof(SequenceCounter<u64>),
         CACHE_LINE
     );
@@ -168,6 +288,159 @@ extern "C" AARENDOCORE_API u64 AARendoCore_TestSpinlockPerformance(u32 iteration
     return static_cast<u64>(duration.count());
 }
 
+// ============================================================================
+// LOCK CONTENTION TEST
+// ============================================================================
+
+namespace {
+    constexpr u32 LOCK_BENCH_SAMPLES = 65536;   // Latency samples kept per thread
+    
+    // Origin: What the bench locks protect - two lines, checked for tearing
+    struct alignas(CACHE_LINE) LockBenchRecord {
+        std::atomic<u64> words[16];
+    };
+    
+    // Write all words with one value, relaxed - only the lock orders them
+    AARENDOCORE_FORCEINLINE void WriteBenchRecord(LockBenchRecord& record, u64 value) noexcept {
+        for (auto& word : record.words) {
+            word.store(value, MemoryOrderRelaxed);
+        }
+    }
+    
+    // True if all words agree
+    AARENDOCORE_FORCEINLINE bool ReadBenchRecord(const LockBenchRecord& record) noexcept {
+        u64 first = record.words[0].load(MemoryOrderRelaxed);
+        bool same = true;
+        for (const auto& word : record.words) {
+            same &= word.load(MemoryOrderRelaxed) == first;
+        }
+        return same;
+    }
+}
+
+// lockKind: 0 = Spinlock, 1 = McsLock, 2 = SeqLock (thread 0 writes under a
+// McsLock, the rest read). Every thread times each acquire-to-release;
+// returns the mean in ns, p99Ns/maxNs get the tail over all threads and
+// torn counts critical sections that saw a half-written record.
+extern "C" AARENDOCORE_API u64 AARendoCore_TestLockContention(
+    u32 threads, u32 acquiresPerThread, u32 lockKind,
+    u64* p99Ns, u64* maxNs, u64* torn) {
+    if (threads < 2 || threads > 64) {
+        threads = 8;
+    }
+    if (acquiresPerThread == 0) {
+        acquiresPerThread = 100000;  // Default 100K acquires per thread
+    }
+    
+    Spinlock* spinlock = new(std::nothrow) Spinlock();
+    McsLock* mcsLock = new(std::nothrow) McsLock();
+    SeqLock* seqLock = new(std::nothrow) SeqLock();
+    LockBenchRecord* record = new(std::nothrow) LockBenchRecord();
+    if (!spinlock || !mcsLock || !seqLock || !record) {
+        delete spinlock;
+        delete mcsLock;
+        delete seqLock;
+        delete record;
+        return 0;
+    }
+    WriteBenchRecord(*record, 0);
+    
+    const u32 stride = acquiresPerThread > LOCK_BENCH_SAMPLES
+        ? (acquiresPerThread + LOCK_BENCH_SAMPLES - 1) / LOCK_BENCH_SAMPLES : 1;
+    std::vector<u64> samples[64];
+    std::atomic<u64> totalNs{0};
+    std::atomic<u64> tornCount{0};
+    std::atomic<u32> ready{0};
+    
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (u32 t = 0; t < threads; ++t) {
+        samples[t].reserve(acquiresPerThread / stride + 1);
+        workers.emplace_back([&, t]() {
+            const bool writer = lockKind != 2 || t == 0;
+            u64 localNs = 0;
+            u64 localTorn = 0;
+            
+            // Start together so the contention is real from the first acquire
+            ready.fetch_add(1, MemoryOrderAcqRel);
+            while (ready.load(MemoryOrderAcquire) < threads) {
+                CpuPause();
+            }
+            
+            for (u32 i = 0; i < acquiresPerThread; ++i) {
+                auto start = Clock::now();
+                
+                if (lockKind == 0) {
+                    spinlock->lock();
+                    localTorn += !ReadBenchRecord(*record);
+                    WriteBenchRecord(*record, i);
+                    spinlock->unlock();
+                } else if (writer) {
+                    mcsLock->lock();
+                    if (lockKind == 2) {
+                        seqLock->writeBegin();
+                    }
+                    localTorn += !ReadBenchRecord(*record);
+                    WriteBenchRecord(*record, i);
+                    if (lockKind == 2) {
+                        seqLock->writeEnd();
+                    }
+                    mcsLock->unlock();
+                } else {
+                    bool consistent;
+                    u32 sequence;
+                    do {
+                        sequence = seqLock->readBegin();
+                        consistent = ReadBenchRecord(*record);
+                    } while (seqLock->readRetry(sequence));
+                    localTorn += !consistent;
+                }
+                
+                u64 ns = static_cast<u64>(
+                    std::chrono::duration_cast<Nanoseconds>(Clock::now() - start).count());
+                localNs += ns;
+                if (i % stride == 0) {
+                    samples[t].push_back(ns);
+                }
+            }
+            
+            totalNs.fetch_add(localNs, MemoryOrderRelaxed);
+            tornCount.fetch_add(localTorn, MemoryOrderRelaxed);
+        });
+    }
+    
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    
+    std::vector<u64> all;
+    for (u32 t = 0; t < threads; ++t) {
+        all.insert(all.end(), samples[t].begin(), samples[t].end());
+    }
+    
+    if (!all.empty()) {
+        usize rank = all.size() * 99 / 100;
+        std::nth_element(all.begin(), all.begin() + rank, all.end());
+        if (p99Ns) {
+            *p99Ns = all[rank];
+        }
+        if (maxNs) {
+            *maxNs = *std::max_element(all.begin(), all.end());
+        }
+    }
+    if (torn) {
+        *torn = tornCount.load(MemoryOrderRelaxed);
+    }
+    
+    delete spinlock;
+    delete mcsLock;
+    delete seqLock;
+    delete record;
+    
+    const u64 acquires = static_cast<u64>(threads) * acquiresPerThread;
+    return totalNs.load(MemoryOrderRelaxed) / acquires;
+}
+
 // ============================================================================
 // SEQUENCE COUNTER PERFORMANCE TEST
 // ============================================================================
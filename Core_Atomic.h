@@ -60,6 +60,14 @@ AARENDOCORE_FORCEINLINE T AtomicAdd(std::atomic<T>& value, T delta,
     return value.fetch_add(delta, order);
 }
 
+// Single-writer increment - plain load + store, no LOCK prefix. Only for
+// values with exactly one writing thread (actor-owned state); readers on
+// other threads still see whole values.
+template<typename T>
+AARENDOCORE_FORCEINLINE void OwnerIncrement(std::atomic<T>& value) noexcept {
+    value.store(value.load(MemoryOrderRelaxed) + 1, MemoryOrderRelaxed);
+}
+
 // Atomic compare and swap (CAS)
 template<typename T>
 AARENDOCORE_FORCEINLINE bool AtomicCompareExchange(std::atomic<T>& value,
@@ -139,6 +147,188 @@ public:
     }
 };
 
+// ============================================================================
+// MCS LOCK - Queued lock for contended write paths
+// ============================================================================
+// Every waiter spins on its own node, so a release touches exactly one other
+// cache line and the lock is handed over in arrival order (FIFO). Same
+// lock()/unlock() shape as Spinlock - the queue node comes from a small
+// per-thread set and the holder's node is remembered in the lock itself.
+
+// Origin: One waiter's place in the queue, a full line so spins never share
+struct CACHE_ALIGNED McsNode {
+    std::atomic<McsNode*> next{nullptr};
+    std::atomic<bool> waiting{false};
+};
+
+// Per-thread queue nodes, one per lock held at once (any release order)
+AARENDOCORE_API McsNode* AcquireMcsNode() noexcept;
+AARENDOCORE_API void ReleaseMcsNode(McsNode* node) noexcept;
+
+class CACHE_ALIGNED McsLock {
+private:
+    std::atomic<McsNode*> tail_{nullptr};
+    McsNode* holder_ = nullptr;        // Written and read by the owner only
+    
+    // Spin on a line we own, yield like Spinlock if the owner is descheduled
+    template<typename Predicate>
+    AARENDOCORE_FORCEINLINE static void spinUntil(Predicate done) noexcept {
+        u32 spin_count = 0;
+        while (!done()) {
+            if (++spin_count < SPINLOCK_ITERATIONS) {
+                #if AARENDOCORE_ARCH_X64
+                    _mm_pause();
+                #endif
+            } else {
+                std::this_thread::yield();
+                spin_count = 0;
+            }
+        }
+    }
+    
+public:
+    McsLock() noexcept = default;
+    
+    // Disable copy and move - waiters hold pointers into the queue
+    McsLock(const McsLock&) = delete;
+    McsLock& operator=(const McsLock&) = delete;
+    McsLock(McsLock&&) = delete;
+    McsLock& operator=(McsLock&&) = delete;
+    
+    // Take the lock only if nobody holds or waits for it
+    AARENDOCORE_FORCEINLINE bool try_lock() noexcept {
+        if (tail_.load(MemoryOrderRelaxed)) {
+            return false;
+        }
+        
+        McsNode* node = AcquireMcsNode();
+        node->next.store(nullptr, MemoryOrderRelaxed);
+        
+        McsNode* expected = nullptr;
+        if (!tail_.compare_exchange_strong(expected, node,
+                                           MemoryOrderAcquire,
+                                           MemoryOrderRelaxed)) {
+            ReleaseMcsNode(node);
+            return false;
+        }
+        
+        holder_ = node;
+        return true;
+    }
+    
+    // Join the queue and wait for the predecessor to hand over
+    AARENDOCORE_FORCEINLINE void lock() noexcept {
+        McsNode* node = AcquireMcsNode();
+        node->next.store(nullptr, MemoryOrderRelaxed);
+        node->waiting.store(true, MemoryOrderRelaxed);
+        
+        McsNode* predecessor = tail_.exchange(node, MemoryOrderAcqRel);
+        if (predecessor) {
+            predecessor->next.store(node, MemoryOrderRelease);
+            spinUntil([node]() noexcept { return !node->waiting.load(MemoryOrderAcquire); });
+        }
+        
+        holder_ = node;
+    }
+    
+    // Hand over to the next waiter, or empty the queue
+    AARENDOCORE_FORCEINLINE void unlock() noexcept {
+        McsNode* node = holder_;
+        McsNode* successor = node->next.load(MemoryOrderAcquire);
+        
+        if (!successor) {
+            McsNode* expected = node;
+            if (tail_.compare_exchange_strong(expected, nullptr,
+                                              MemoryOrderRelease,
+                                              MemoryOrderRelaxed)) {
+                ReleaseMcsNode(node);
+                return;
+            }
+            
+            // A waiter swapped itself in but has not linked up yet
+            spinUntil([node]() noexcept { return node->next.load(MemoryOrderAcquire) != nullptr; });
+            successor = node->next.load(MemoryOrderAcquire);
+        }
+        
+        successor->waiting.store(false, MemoryOrderRelease);
+        ReleaseMcsNode(node);
+    }
+    
+    // Check if locked (for debugging)
+    AARENDOCORE_FORCEINLINE bool is_locked() const noexcept {
+        return tail_.load(MemoryOrderRelaxed) != nullptr;
+    }
+};
+
+// ============================================================================
+// SEQLOCK - Readers never write, writers never wait for readers
+// ============================================================================
+// For read-mostly data. The sequence is odd while a write is in progress;
+// a reader snapshots it, reads, and retries if it changed. Writers must
+// already be serialized (hold a lock) around writeBegin/writeEnd.
+
+class SeqLock {
+private:
+    std::atomic<u32> sequence_{0};
+    
+public:
+    SeqLock() noexcept = default;
+    
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+    
+    // Wait out a writer in progress, return the (even) start sequence
+    AARENDOCORE_FORCEINLINE u32 readBegin() const noexcept {
+        u32 spin_count = 0;
+        u32 sequence = sequence_.load(MemoryOrderAcquire);
+        while (sequence & 1) {
+            if (++spin_count < SPINLOCK_ITERATIONS) {
+                #if AARENDOCORE_ARCH_X64
+                    _mm_pause();
+                #endif
+            } else {
+                std::this_thread::yield();
+                spin_count = 0;
+            }
+            sequence = sequence_.load(MemoryOrderAcquire);
+        }
+        return sequence;
+    }
+    
+    // True if a write overlapped the read that started at sequence
+    AARENDOCORE_FORCEINLINE bool readRetry(u32 sequence) const noexcept {
+        std::atomic_thread_fence(MemoryOrderAcquire);
+        return sequence_.load(MemoryOrderRelaxed) != sequence;
+    }
+    
+    AARENDOCORE_FORCEINLINE void writeBegin() noexcept {
+        sequence_.store(sequence_.load(MemoryOrderRelaxed) + 1, MemoryOrderRelaxed);
+        std::atomic_thread_fence(MemoryOrderRelease);
+    }
+    
+    AARENDOCORE_FORCEINLINE void writeEnd() noexcept {
+        sequence_.store(sequence_.load(MemoryOrderRelaxed) + 1, MemoryOrderRelease);
+    }
+    
+    // Completed writes so far
+    AARENDOCORE_FORCEINLINE u32 writes() const noexcept {
+        return sequence_.load(MemoryOrderRelaxed) >> 1;
+    }
+};
+
+// ============================================================================
+// ADDRESS WAIT - Sleep on a 32-bit word (futex / WaitOnAddress)
+// ============================================================================
+// The kernel rechecks word == expected before sleeping, so a wake that lands
+// between the caller's check and the wait is never lost. Returns may be
+// spurious - callers recheck the word. A wake is a syscall; gate it behind a
+// waiter count so signalling with nobody asleep stays a plain store.
+
+// Sleep while word == expected, at most timeoutNs (0 = no limit).
+// Returns false only if the timeout expired.
+AARENDOCORE_API bool WaitOnWord(const std::atomic<u32>& word, u32 expected, u64 timeoutNs) noexcept;
+AARENDOCORE_API void WakeAllOnWord(std::atomic<u32>& word) noexcept;
+
 // ============================================================================
 // SEQUENCE COUNTER - For generating unique IDs at extreme speed
 // ============================================================================
@@ -292,6 +482,9 @@ static_assert(std::atomic<void*>::is_always_lock_free, "pointer atomics must be
 // Ensure Spinlock fits in cache line
 static_assert(sizeof(Spinlock) <= CACHE_LINE, "Spinlock must fit in cache line");
 
+// Ensure McsLock fits in cache line
+static_assert(sizeof(McsLock) <= CACHE_LINE, "McsLock must fit in cache line");
+
 // Ensure SequenceCounter fits in cache line
 static_assert(sizeof(SequenceCounter<u64>) <= CACHE_LINE, 
     "SequenceCounter must fit in cache line");
@@ -24,7 +24,8 @@ namespace AARendoCoreGLM {
 BaseProcessingUnit::BaseProcessingUnit(ProcessingUnitType type, 
                                        u64 capabilities,
                                        i32 numaNode) noexcept
-    : config_{}
+    : config_()
+    , unitId_(0)
     , metrics_{}
     , state_(static_cast<u8>(ProcessingUnitState::UNINITIALIZED))
     , capabilities_(capabilities)
@@ -66,8 +67,12 @@ ResultCode BaseProcessingUnit::initialize(const ProcessingUnitConfig& config) no
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
     
-    // Store configuration
-    config_ = config;
+    // Publish configuration
+    if (config_.publish(config) == 0) {
+        transitionState(ProcessingUnitState::ERROR);
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
+    unitId_.store(config.unitId, std::memory_order_release);
     
     // Set NUMA affinity if specified
     if (config.numaNode >= 0) {
@@ -99,7 +104,7 @@ bool BaseProcessingUnit::validate() const noexcept {
     }
     
     // Check configuration is valid
-    return validateConfig(config_);
+    return validateConfig(config_.load());
 }
 
 // Origin: Shutdown the unit
@@ -206,6 +211,12 @@ u32 BaseProcessingUnit::routeToConnected([[maybe_unused]] const void* data,
 // STATE MANAGEMENT
 // ==========================================================================
 
+// Origin: Get unit identifier fixed at initialize
+// Output: Unit ID (0 before initialize)
+ProcessingUnitId BaseProcessingUnit::getId() const noexcept {
+    return unitId_.load(std::memory_order_acquire);
+}
+
 // Origin: Get current state
 // Output: Current state
 ProcessingUnitState BaseProcessingUnit::getState() const noexcept {
@@ -388,11 +399,12 @@ bool BaseProcessingUnit::validateConfig(const ProcessingUnitConfig& config) cons
 // Input: config - New configuration
 // Output: ResultCode
 ResultCode BaseProcessingUnit::reconfigure(const ProcessingUnitConfig& config) noexcept {
-    // Only allow reconfiguration in READY or PAUSED state
+    // Allowed while processing - readers never see a half-written config
     // currentState: Origin - Local from atomic load, Scope: function
     ProcessingUnitState currentState = getState();
     
     if (currentState != ProcessingUnitState::READY &&
+        currentState != ProcessingUnitState::PROCESSING &&
         currentState != ProcessingUnitState::PAUSED) {
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
@@ -402,8 +414,15 @@ ResultCode BaseProcessingUnit::reconfigure(const ProcessingUnitConfig& config) n
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
     
-    // Apply configuration
-    config_ = config;
+    // The unit's identity is fixed at initialize
+    if (config.unitId != getId()) {
+        return ResultCode::ERROR_INVALID_PARAMETER;
+    }
+    
+    // Publish - one pointer swap, previous snapshot retired through EBR
+    if (config_.publish(config) == 0) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
     
     return ResultCode::SUCCESS;
 }
@@ -2,7 +2,8 @@
 //
 // COMPILATION LEVEL: 3 (Depends on IProcessingUnit, PrimitiveTypes)
 // ORIGIN: NEW - Abstract base class providing common functionality
-// DEPENDENCIES: Core_IProcessingUnit.h, Core_PrimitiveTypes.h, Core_Atomic.h
+// DEPENDENCIES: Core_IProcessingUnit.h, Core_PrimitiveTypes.h, Core_Atomic.h,
+//               Core_VersionedConfig.h
 // DEPENDENTS: ALL concrete processing units will inherit from this
 //
 // This provides COMMON implementation that ALL processing units share.
@@ -18,6 +19,7 @@
 #include "Core_Atomic.h"
 #include "Core_NUMA.h"
 #include "Core_DAGTypes.h"              // PSYCHOTIC PRECISION: For ProcessingUnitId
+#include "Core_VersionedConfig.h"       // RCU snapshots for runtime reconfiguration
 
 // Enforce compilation level
 #ifndef CORE_BASEPROCESSINGUNIT_LEVEL_DEFINED
@@ -159,8 +161,14 @@ protected:  // Protected so derived classes can access
     // MEMBER VARIABLES - Common to all units
     // ======================================================================
     
-    // Origin: Member - Unit configuration, Scope: Instance lifetime
-    ProcessingUnitConfig config_;
+    // Origin: Member - Unit configuration, published as immutable snapshots
+    // Scope: Instance lifetime - swapped by reconfigure() while processing
+    VersionedConfig<ProcessingUnitConfig> config_;
+    
+    // Origin: Member - Unit identifier, copied out of config_ at initialize
+    // Scope: Instance lifetime - reconfigure() may not change it, so getId()
+    // and trace points read it without touching the snapshot
+    AtomicU64 unitId_;
     
     // Origin: Member - Performance metrics, Scope: Instance lifetime
     mutable ProcessingUnitMetrics metrics_;  // mutable for const methods
@@ -238,16 +246,18 @@ public:
     ProcessingUnitType getType() const noexcept override final { return type_; }
     u64 getCapabilities() const noexcept override final { return capabilities_; }
     ProcessingUnitState getState() const noexcept override final;
-    ProcessingUnitId getId() const noexcept override final { return config_.unitId; }
+    ProcessingUnitId getId() const noexcept override final;
     i32 getNumaNode() const noexcept override final { return numaNode_; }
     
     // Metrics methods (common implementation)
     ProcessingUnitMetrics getMetrics() const noexcept override final;
     void resetMetrics() noexcept override final;
     
-    // Configuration methods (common implementation)
+    // Configuration methods (common implementation) - reconfigure publishes a
+    // new snapshot and is allowed while processing; the old one is reclaimed
+    // once no reader can hold it
     ResultCode reconfigure(const ProcessingUnitConfig& config) noexcept override;
-    ProcessingUnitConfig getConfiguration() const noexcept override final { return config_; }
+    ProcessingUnitConfig getConfiguration() const noexcept override final { return config_.load(); }
     
     // ======================================================================
     // PURE VIRTUAL METHODS - Must be implemented by derived classes
@@ -2,20 +2,344 @@
 //
 // COMPILATION LEVEL: 4
 // ORIGIN: Implementation for Core_BatchProcessingUnit.h
-// DEPENDENCIES: Core_BatchProcessingUnit.h, Core_AVX2Math.h
+// DEPENDENCIES: Core_BatchProcessingUnit.h, Core_AVX2Math.h, Core_SIMDDispatch.h
 // DEPENDENTS: None
 //
 // FULL implementation with AVX2 SIMD - NO PLACEHOLDERS!
 //===----------------------------------------------------------------------===//
 
 #include "Core_BatchProcessingUnit.h"
+#include "Core_SIMDDispatch.h"
+#include "Core_Threading.h"
+#include "Core_Trace.h"
 #include <cstring>
 #include <algorithm>
 #include <malloc.h>
 #include <chrono>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <bit>
 
 namespace AARendoCoreGLM {
 
+// ==========================================================================
+// FILTER COMPACTORS - Branch-free left-pack, one per (ISA, predicate terms)
+// ==========================================================================
+//
+// A Tick is one 32-byte row, so survivors are packed row by row: every row is
+// stored unconditionally at the write cursor and the cursor advances by the
+// predicate bit. No data-dependent branch, so a 50% pass rate costs the same
+// as 0% or 100%. Stores never pass the read cursor - in-place is safe.
+
+namespace {
+
+// Origin: Bounds for exclusive comparisons expressed as inclusive ranges
+constexpr f64 FILTER_INFINITY = std::numeric_limits<f64>::infinity();
+
+// Origin: Translate legacy aggregationFunction filter IDs into a predicate
+// 0 price > 100, 1 volume > 1000, 2 price in [50, 150], 3 volume > 0, other pass-all
+FilterPredicate MakeLegacyFilterPredicate(u32 function) noexcept {
+    FilterPredicate predicate{};
+    predicate.minPrice = -FILTER_INFINITY;
+    predicate.maxPrice = FILTER_INFINITY;
+    predicate.minVolume = -FILTER_INFINITY;
+    predicate.maxVolume = FILTER_INFINITY;
+    
+    switch (function) {
+        case 0:
+            predicate.minPrice = std::nextafter(100.0, FILTER_INFINITY);
+            predicate.terms = FILTER_TERM_PRICE;
+            break;
+        case 1:
+            predicate.minVolume = std::nextafter(1000.0, FILTER_INFINITY);
+            predicate.terms = FILTER_TERM_VOLUME;
+            break;
+        case 2:
+            predicate.minPrice = 50.0;
+            predicate.maxPrice = 150.0;
+            predicate.terms = FILTER_TERM_PRICE;
+            break;
+        case 3:
+            predicate.minVolume = std::nextafter(0.0, FILTER_INFINITY);
+            predicate.terms = FILTER_TERM_VOLUME;
+            break;
+        default:
+            predicate.terms = 0;
+            break;
+    }
+    
+    return predicate;
+}
+
+// Origin: Scalar predicate - ordered compares, so NaN never passes a term
+template<u32 Terms>
+AARENDOCORE_FORCEINLINE u32 FilterPass(const Tick& tick, const FilterPredicate& predicate) noexcept {
+    bool pass = true;
+    if constexpr ((Terms & FILTER_TERM_PRICE) != 0) {
+        pass &= (tick.price >= predicate.minPrice) & (tick.price <= predicate.maxPrice);
+    }
+    if constexpr ((Terms & FILTER_TERM_VOLUME) != 0) {
+        pass &= (tick.volume >= predicate.minVolume) & (tick.volume <= predicate.maxVolume);
+    }
+    if constexpr ((Terms & FILTER_TERM_FLAGS) != 0) {
+        pass &= (tick.flags & predicate.flagsMask) == predicate.flagsValue;
+    }
+    return static_cast<u32>(pass);
+}
+
+// Origin: Pass-all - survivors are the input
+u32 CompactPassAll(const Tick* input, Tick* output, u32 count,
+                   [[maybe_unused]] const FilterPredicate& predicate) noexcept {
+    if (input != output) {
+        std::memmove(output, input, count * sizeof(Tick));
+    }
+    return count;
+}
+
+// Origin: Scalar left-pack tail shared by every ISA
+template<u32 Terms>
+AARENDOCORE_FORCEINLINE u32 CompactTail(const Tick* input, Tick* output, u32 begin, u32 count,
+                                        u32 outputCount, const FilterPredicate& predicate) noexcept {
+    for (u32 i = begin; i < count; ++i) {
+        const Tick tick = input[i];
+        output[outputCount] = tick;
+        outputCount += FilterPass<Terms>(tick, predicate);
+    }
+    return outputCount;
+}
+
+template<u32 Terms>
+u32 CompactScalar(const Tick* input, Tick* output, u32 count,
+                  const FilterPredicate& predicate) noexcept {
+    return CompactTail<Terms>(input, output, 0, count, 0, predicate);
+}
+
+// Origin: AVX2 - 4 rows transposed in registers, predicate mask via movemask
+template<u32 Terms>
+u32 CompactAVX2(const Tick* input, Tick* output, u32 count,
+                const FilterPredicate& predicate) noexcept {
+    const __m256d minPrice = _mm256_set1_pd(predicate.minPrice);
+    const __m256d maxPrice = _mm256_set1_pd(predicate.maxPrice);
+    const __m256d minVolume = _mm256_set1_pd(predicate.minVolume);
+    const __m256d maxVolume = _mm256_set1_pd(predicate.maxVolume);
+    const __m256i flagsMask = _mm256_set1_epi64x(predicate.flagsMask);
+    const __m256i flagsValue = _mm256_set1_epi64x(predicate.flagsValue);
+    
+    const f64* src = reinterpret_cast<const f64*>(input);
+    f64* dst = reinterpret_cast<f64*>(output);
+    u32 outputCount = 0;
+    u32 i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        // Row r = {timestamp, price, volume, flags}
+        const __m256d r0 = _mm256_loadu_pd(src + (i + 0) * 4);
+        const __m256d r1 = _mm256_loadu_pd(src + (i + 1) * 4);
+        const __m256d r2 = _mm256_loadu_pd(src + (i + 2) * 4);
+        const __m256d r3 = _mm256_loadu_pd(src + (i + 3) * 4);
+        
+        __m256d pass = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        if constexpr ((Terms & (FILTER_TERM_PRICE | FILTER_TERM_FLAGS)) != 0) {
+            // hi01: p0 p1 | f0 f1, hi23: p2 p3 | f2 f3
+            const __m256d hi01 = _mm256_unpackhi_pd(r0, r1);
+            const __m256d hi23 = _mm256_unpackhi_pd(r2, r3);
+            if constexpr ((Terms & FILTER_TERM_PRICE) != 0) {
+                const __m256d prices = _mm256_permute2f128_pd(hi01, hi23, 0x20);
+                pass = _mm256_and_pd(pass, _mm256_and_pd(
+                    _mm256_cmp_pd(prices, minPrice, _CMP_GE_OQ),
+                    _mm256_cmp_pd(prices, maxPrice, _CMP_LE_OQ)));
+            }
+            if constexpr ((Terms & FILTER_TERM_FLAGS) != 0) {
+                // Upper 32 bits of the flags qword are padding; flagsMask clears them
+                const __m256i flags = _mm256_castpd_si256(_mm256_permute2f128_pd(hi01, hi23, 0x31));
+                pass = _mm256_and_pd(pass, _mm256_castsi256_pd(_mm256_cmpeq_epi64(
+                    _mm256_and_si256(flags, flagsMask), flagsValue)));
+            }
+        }
+        if constexpr ((Terms & FILTER_TERM_VOLUME) != 0) {
+            // lo01: t0 t1 | v0 v1, lo23: t2 t3 | v2 v3
+            const __m256d volumes = _mm256_permute2f128_pd(
+                _mm256_unpacklo_pd(r0, r1), _mm256_unpacklo_pd(r2, r3), 0x31);
+            pass = _mm256_and_pd(pass, _mm256_and_pd(
+                _mm256_cmp_pd(volumes, minVolume, _CMP_GE_OQ),
+                _mm256_cmp_pd(volumes, maxVolume, _CMP_LE_OQ)));
+        }
+        
+        const u32 mask = static_cast<u32>(_mm256_movemask_pd(pass));
+        _mm256_storeu_pd(dst + outputCount * 4, r0);
+        outputCount += mask & 1;
+        _mm256_storeu_pd(dst + outputCount * 4, r1);
+        outputCount += (mask >> 1) & 1;
+        _mm256_storeu_pd(dst + outputCount * 4, r2);
+        outputCount += (mask >> 2) & 1;
+        _mm256_storeu_pd(dst + outputCount * 4, r3);
+        outputCount += (mask >> 3) & 1;
+    }
+    
+    return CompactTail<Terms>(input, output, i, count, outputCount, predicate);
+}
+
+// Origin: Pair LUTs for AVX-512 - a zmm holds two ticks, so the 2-bit pass
+// mask of a pair picks the vcompresspd lane mask and the rows it yields
+alignas(CACHE_LINE_SIZE) constexpr __mmask8 PAIR_COMPRESS_LANES[4] = {0x00, 0x0F, 0xF0, 0xFF};
+alignas(CACHE_LINE_SIZE) constexpr u32 PAIR_SURVIVORS[4] = {0, 1, 1, 2};
+
+// Origin: AVX-512 - 8 rows per step, predicate in opmask registers, each pair
+// compressed with vcompresspd and stored as one full 64-byte write
+template<u32 Terms>
+AARENDOCORE_TARGET_AVX512
+u32 CompactAVX512(const Tick* input, Tick* output, u32 count,
+                  const FilterPredicate& predicate) noexcept {
+    const __m512d minPrice = _mm512_set1_pd(predicate.minPrice);
+    const __m512d maxPrice = _mm512_set1_pd(predicate.maxPrice);
+    const __m512d minVolume = _mm512_set1_pd(predicate.minVolume);
+    const __m512d maxVolume = _mm512_set1_pd(predicate.maxVolume);
+    const __m512i flagsMask = _mm512_set1_epi64(predicate.flagsMask);
+    const __m512i flagsValue = _mm512_set1_epi64(predicate.flagsValue);
+    
+    // z0..z3 hold ticks {0,1} {2,3} {4,5} {6,7}; qword 4k+1 is a price
+    const __m512i priceVolumeIndex = _mm512_set_epi64(14, 10, 6, 2, 13, 9, 5, 1);
+    const __m512i flagsIndex = _mm512_set_epi64(15, 11, 7, 3, 15, 11, 7, 3);
+    
+    const f64* src = reinterpret_cast<const f64*>(input);
+    f64* dst = reinterpret_cast<f64*>(output);
+    u32 outputCount = 0;
+    u32 i = 0;
+    
+    for (; i + 8 <= count; i += 8) {
+        const __m512d z0 = _mm512_loadu_pd(src + i * 4);
+        const __m512d z1 = _mm512_loadu_pd(src + i * 4 + 8);
+        const __m512d z2 = _mm512_loadu_pd(src + i * 4 + 16);
+        const __m512d z3 = _mm512_loadu_pd(src + i * 4 + 24);
+        
+        __mmask8 pass = 0xFF;
+        if constexpr ((Terms & (FILTER_TERM_PRICE | FILTER_TERM_VOLUME)) != 0) {
+            // a: p0 p1 p2 p3 | v0 v1 v2 v3, b: same for ticks 4..7
+            const __m512d a = _mm512_permutex2var_pd(z0, priceVolumeIndex, z1);
+            const __m512d b = _mm512_permutex2var_pd(z2, priceVolumeIndex, z3);
+            if constexpr ((Terms & FILTER_TERM_PRICE) != 0) {
+                const __m512d prices = _mm512_shuffle_f64x2(a, b, 0x44);
+                pass = _mm512_mask_cmp_pd_mask(
+                    _mm512_mask_cmp_pd_mask(pass, prices, minPrice, _CMP_GE_OQ),
+                    prices, maxPrice, _CMP_LE_OQ);
+            }
+            if constexpr ((Terms & FILTER_TERM_VOLUME) != 0) {
+                const __m512d volumes = _mm512_shuffle_f64x2(a, b, 0xEE);
+                pass = _mm512_mask_cmp_pd_mask(
+                    _mm512_mask_cmp_pd_mask(pass, volumes, minVolume, _CMP_GE_OQ),
+                    volumes, maxVolume, _CMP_LE_OQ);
+            }
+        }
+        if constexpr ((Terms & FILTER_TERM_FLAGS) != 0) {
+            const __m512i fa = _mm512_permutex2var_epi64(
+                _mm512_castpd_si512(z0), flagsIndex, _mm512_castpd_si512(z1));
+            const __m512i fb = _mm512_permutex2var_epi64(
+                _mm512_castpd_si512(z2), flagsIndex, _mm512_castpd_si512(z3));
+            const __m512i flags = _mm512_shuffle_i64x2(fa, fb, 0x44);
+            pass = _mm512_mask_cmpeq_epi64_mask(pass, _mm512_and_si512(flags, flagsMask), flagsValue);
+        }
+        
+        const u32 bits = static_cast<u32>(pass);
+        _mm512_storeu_pd(dst + outputCount * 4,
+                         _mm512_maskz_compress_pd(PAIR_COMPRESS_LANES[bits & 3], z0));
+        outputCount += PAIR_SURVIVORS[bits & 3];
+        _mm512_storeu_pd(dst + outputCount * 4,
+                         _mm512_maskz_compress_pd(PAIR_COMPRESS_LANES[(bits >> 2) & 3], z1));
+        outputCount += PAIR_SURVIVORS[(bits >> 2) & 3];
+        _mm512_storeu_pd(dst + outputCount * 4,
+                         _mm512_maskz_compress_pd(PAIR_COMPRESS_LANES[(bits >> 4) & 3], z2));
+        outputCount += PAIR_SURVIVORS[(bits >> 4) & 3];
+        _mm512_storeu_pd(dst + outputCount * 4,
+                         _mm512_maskz_compress_pd(PAIR_COMPRESS_LANES[bits >> 6], z3));
+        outputCount += PAIR_SURVIVORS[bits >> 6];
+    }
+    
+    return CompactTail<Terms>(input, output, i, count, outputCount, predicate);
+}
+
+// Origin: Compactor tables indexed by FilterTerm bits
+constexpr FilterCompactor SCALAR_COMPACTORS[8] = {
+    CompactPassAll, CompactScalar<1>, CompactScalar<2>, CompactScalar<3>,
+    CompactScalar<4>, CompactScalar<5>, CompactScalar<6>, CompactScalar<7>
+};
+
+constexpr FilterCompactor AVX2_COMPACTORS[8] = {
+    CompactPassAll, CompactAVX2<1>, CompactAVX2<2>, CompactAVX2<3>,
+    CompactAVX2<4>, CompactAVX2<5>, CompactAVX2<6>, CompactAVX2<7>
+};
+
+constexpr FilterCompactor AVX512_COMPACTORS[8] = {
+    CompactPassAll, CompactAVX512<1>, CompactAVX512<2>, CompactAVX512<3>,
+    CompactAVX512<4>, CompactAVX512<5>, CompactAVX512<6>, CompactAVX512<7>
+};
+
+// Origin: Pick the compactor for a level (clamped to supported) and terms
+FilterCompactor SelectFilterCompactor(SIMDLevel level, u32 terms) noexcept {
+    terms &= FILTER_TERM_ALL;
+    const SIMDLevel supported = GetMaxSupportedSIMDLevel();
+    if (level > supported) {
+        level = supported;
+    }
+    
+    switch (level) {
+        case SIMDLevel::AVX512: return AVX512_COMPACTORS[terms];
+        case SIMDLevel::AVX2:   return AVX2_COMPACTORS[terms];
+        default:                return SCALAR_COMPACTORS[terms];
+    }
+}
+
+} // anonymous namespace
+
+// ==========================================================================
+// RESULT TICKS - One shape for the specialized kernels and the generic path
+// ==========================================================================
+//
+// An N→1 mode hands back a fresh tick whichever path ran, so switching
+// enableAVX2 or crossing AVX2_BATCH changes timing, never fields.
+
+namespace {
+
+// Origin: VWAP tick from running sums (price mean when there is no volume)
+Tick MakeAggregatedTick(f64 sumPriceVolume, f64 sumVolume, f64 sumPrice,
+                        u64 lastTimestamp, u32 count) noexcept {
+    Tick result{};
+    result.timestamp = lastTimestamp;
+    result.volume = sumVolume;
+    result.price = sumVolume > 0.0 ? sumPriceVolume / sumVolume : sumPrice / count;
+    result.flags = 0x20; // Aggregated flag
+    return result;
+}
+
+// Origin: Aggregate one contiguous batch N→1
+Tick AggregateTicks(const Tick* ticks, u32 count) noexcept {
+    f64 sumPrice = 0.0;
+    f64 sumVolume = 0.0;
+    f64 sumPriceVolume = 0.0;
+    u64 lastTimestamp = 0;
+    
+    for (u32 i = 0; i < count; ++i) {
+        sumPrice += ticks[i].price;
+        sumVolume += ticks[i].volume;
+        sumPriceVolume += ticks[i].price * ticks[i].volume;
+        lastTimestamp = std::max(lastTimestamp, ticks[i].timestamp);
+    }
+    
+    return MakeAggregatedTick(sumPriceVolume, sumVolume, sumPrice, lastTimestamp, count);
+}
+
+// Origin: REDUCE tick - reduced price, batch size as volume, last timestamp
+Tick MakeReducedTick(const Tick* batch, u32 count, f64 reduced) noexcept {
+    Tick result{};
+    result.timestamp = batch[count - 1].timestamp;
+    result.price = reduced;
+    result.volume = static_cast<f64>(count);
+    return result;
+}
+
+} // anonymous namespace
+
 // ==========================================================================
 // CONSTRUCTOR/DESTRUCTOR
 // ==========================================================================
@@ -28,6 +352,8 @@ BatchProcessingUnit::BatchProcessingUnit(i32 numaNode) noexcept
                         CAP_LOCK_FREE | CAP_ZERO_COPY,
                         numaNode)
     , batchConfig_{}
+    , publishedSettings_()
+    , settingsVersion_(0)
     , stats_{}
     , inputBuffers_{}
     , outputBuffers_{}
@@ -36,6 +362,15 @@ BatchProcessingUnit::BatchProcessingUnit(i32 numaNode) noexcept
     , batchQueue_(nullptr)
     , accumulators_{}
     , lastBatchTime_(0)
+    , batchKernel_(nullptr)
+    , filterPredicate_{}
+    , filterCompactor_(nullptr)
+    , threadPool_(nullptr)
+    , oldestArrivalNs_{}
+    , nextDeadlineNs_(UINT64_MAX)
+    , lastArrivalNs_(0)
+    , interArrivalNs_(0)
+    , targetBatchSize_(0)
     , padding_{} {
     
     // Initialize all input/output buffers
@@ -71,6 +406,16 @@ BatchProcessingUnit::BatchProcessingUnit(i32 numaNode) noexcept
     stats_.minLatencyNs.store(UINT64_MAX, std::memory_order_relaxed);
     stats_.maxLatencyNs.store(0, std::memory_order_relaxed);
     stats_.throughput.store(0.0, std::memory_order_relaxed);
+    stats_.parallelBatches.store(0, std::memory_order_relaxed);
+    stats_.fillFlushes.store(0, std::memory_order_relaxed);
+    stats_.deadlineFlushes.store(0, std::memory_order_relaxed);
+    stats_.arrivalRate.store(0.0, std::memory_order_relaxed);
+    for (u32 i = 0; i < BATCH_CURVE_BUCKETS; ++i) {
+        stats_.curveFlushes[i].store(0, std::memory_order_relaxed);
+        stats_.curveItems[i].store(0, std::memory_order_relaxed);
+        stats_.curveWaitNs[i].store(0, std::memory_order_relaxed);
+        stats_.curveMaxWaitNs[i].store(0, std::memory_order_relaxed);
+    }
     
     // Initialize configuration
     batchConfig_.mode = BatchMode::AGGREGATION;
@@ -83,6 +428,17 @@ BatchProcessingUnit::BatchProcessingUnit(i32 numaNode) noexcept
     batchConfig_.aggregationFunction = 0;
     batchConfig_.transformFunction = 0;
     batchConfig_.maxLatencyNs = 1000000; // 1ms
+    
+    // Start at the cap; the first flushes pull it toward the arrival rate
+    targetBatchSize_.store(batchSizeCap(), std::memory_order_relaxed);
+    stats_.targetBatchSize.store(batchSizeCap(), std::memory_order_relaxed);
+    
+    filterPredicate_ = MakeLegacyFilterPredicate(batchConfig_.aggregationFunction);
+    selectBatchKernel();
+    
+    // Defaults are the first snapshot - configureFilter updates from it
+    settingsVersion_ = publishedSettings_.publish(
+        BatchUnitSettings{batchConfig_, filterPredicate_});
 }
 
 // Origin: Destructor with FULL cleanup
@@ -112,33 +468,64 @@ BatchProcessingUnit::~BatchProcessingUnit() noexcept {
 // ==========================================================================
 
 // Origin: Process single tick by adding to batch
-ProcessResult BatchProcessingUnit::processTick([[maybe_unused]] SessionId sessionId,
+ProcessResult BatchProcessingUnit::processTick(SessionId sessionId,
                                                const Tick& tick) noexcept {
+    const u64 nowNs = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    return processTickAt(sessionId, tick, nowNs);
+}
+
+// Origin: Buffer tick; flush on adaptive fill or oldest-tick deadline
+ProcessResult BatchProcessingUnit::processTickAt([[maybe_unused]] SessionId sessionId,
+                                                 const Tick& tick,
+                                                 u64 arrivalNs) noexcept {
+    AARENDOCORE_TRACE_SCOPE(BATCH_UNIT, UNIT_PROCESS_TICK, getId(), tick.timestamp);
+    
+    adoptBatchSettings();
+    
     // Determine which stream to add to (round-robin for now)
     static AtomicU32 streamSelector(0);
     u32 streamId = streamSelector.fetch_add(1, std::memory_order_relaxed) % batchConfig_.numInputStreams;
     
+    trackArrival(arrivalNs);
+    
     // Get current position in stream buffer
     u32 pos = inputPositions_[streamId].fetch_add(1, std::memory_order_acq_rel);
     
     if (pos >= MAX_BATCH_SIZE) {
-        // Buffer full, process batch
-        executeBatch(batchConfig_.mode, 
-                    const_cast<const Tick**>(inputBuffers_),
-                    outputBuffers_, 
-                    pos);
-        
-        // Reset position
-        inputPositions_[streamId].store(0, std::memory_order_release);
-        pos = 0;
+        // Buffer full (target raised past the buffer), process batch
+        inputPositions_[streamId].store(pos, std::memory_order_release);
+        flushStream(streamId, arrivalNs, false);
+        pos = inputPositions_[streamId].fetch_add(1, std::memory_order_acq_rel);
     }
     
     // Add tick to buffer
     inputBuffers_[streamId][pos] = tick;
     
+    // First tick of a batch starts its latency clock
+    if (pos == 0) {
+        oldestArrivalNs_[streamId].store(arrivalNs, std::memory_order_relaxed);
+        if (batchConfig_.maxLatencyNs > 0) {
+            const u64 deadline = arrivalNs + batchConfig_.maxLatencyNs;
+            u64 current = nextDeadlineNs_.load(std::memory_order_relaxed);
+            while (deadline < current &&
+                   !nextDeadlineNs_.compare_exchange_weak(current, deadline, std::memory_order_relaxed)) {}
+        }
+    }
+    
     // Update metrics
     metrics_.ticksProcessed.fetch_add(1, std::memory_order_relaxed);
     
+    if (pos + 1 >= targetBatchSize_.load(std::memory_order_relaxed)) {
+        flushStream(streamId, arrivalNs, false);
+    }
+    
+    // Flush now what would overrun its deadline before the next expected tick
+    const u64 horizonNs = arrivalNs + interArrivalNs_.load(std::memory_order_relaxed);
+    if (horizonNs >= nextDeadlineNs_.load(std::memory_order_relaxed)) {
+        flushDueStreams(arrivalNs, horizonNs);
+    }
+    
     return ProcessResult::SUCCESS;
 }
 
@@ -146,27 +533,31 @@ ProcessResult BatchProcessingUnit::processTick([[maybe_unused]] SessionId sessio
 ProcessResult BatchProcessingUnit::processBatch([[maybe_unused]] SessionId sessionId,
                                                 const Tick* ticks,
                                                 usize count) noexcept {
-    if (!ticks || count == 0) {
+    // Output buffers hold MAX_BATCH_SIZE items
+    if (!ticks || count == 0 || count > MAX_BATCH_SIZE) {
         return ProcessResult::FAILED;
     }
     
+    AARENDOCORE_TRACE_SCOPE(BATCH_UNIT, UNIT_PROCESS_BATCH, getId(), count);
+    
+    // Batch boundary - the whole batch runs under one configuration
+    adoptBatchSettings();
+    
     // Record start time for latency measurement
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Process based on mode
     u32 processed = 0;
     
-    if (batchConfig_.enableAVX2 && count >= AVX2_BATCH) {
+    if (batchConfig_.enableAVX2 && batchKernel_ && count >= AVX2_BATCH) {
         processed = processBatchAVX2(ticks, outputBuffers_[0], static_cast<u32>(count));
     } else {
         // Standard processing
         switch (batchConfig_.mode) {
             case BatchMode::AGGREGATION:
-                {
-                    Tick aggregated = aggregateBatch(&ticks, static_cast<u32>(count));
-                    outputBuffers_[0][0] = aggregated;
-                    processed = 1;
-                }
+                // This batch only - the buffered streams are not part of it
+                outputBuffers_[0][0] = AggregateTicks(ticks, static_cast<u32>(count));
+                processed = 1;
                 break;
                 
             case BatchMode::TRANSFORM:
@@ -178,11 +569,9 @@ ProcessResult BatchProcessingUnit::processBatch([[maybe_unused]] SessionId sessi
                 break;
                 
             case BatchMode::REDUCE:
-                {
-                    f64 reduced = reduceBatch(ticks, static_cast<u32>(count));
-                    outputBuffers_[0][0].price = reduced;
-                    processed = 1;
-                }
+                outputBuffers_[0][0] = MakeReducedTick(ticks, static_cast<u32>(count),
+                    reduceBatch(ticks, static_cast<u32>(count)));
+                processed = 1;
                 break;
                 
             default:
@@ -259,12 +648,74 @@ ResultCode BatchProcessingUnit::configureBatch(const BatchProcessingConfig& conf
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
     
-    batchConfig_ = config;
-    resetBatches();
+    // Publish only - the processing thread adopts it at its next boundary
+    if (publishedSettings_.publish(BatchUnitSettings{
+            config, MakeLegacyFilterPredicate(config.aggregationFunction)}) == 0) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
     
     return ResultCode::SUCCESS;
 }
 
+// Origin: Install composite filter predicate
+ResultCode BatchProcessingUnit::configureFilter(const FilterPredicate& predicate) noexcept {
+    // A flagsValue bit outside flagsMask could never match
+    if ((predicate.terms & ~static_cast<u32>(FILTER_TERM_ALL)) != 0 ||
+        ((predicate.terms & FILTER_TERM_FLAGS) != 0 &&
+         (predicate.flagsValue & ~predicate.flagsMask) != 0)) {
+        return ResultCode::ERROR_INVALID_PARAMETER;
+    }
+    
+    // Read-copy-update - keeps whatever batch config is current
+    if (publishedSettings_.update([&predicate](BatchUnitSettings& settings) noexcept {
+            settings.filter = predicate;
+        }) == 0) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
+    
+    return ResultCode::SUCCESS;
+}
+
+// Origin: Adopt the latest published settings
+void BatchProcessingUnit::adoptBatchSettings() noexcept {
+    if (publishedSettings_.version() == settingsVersion_) {
+        return;
+    }
+    
+    // settings: Origin - Copy of the latest snapshot, Scope: function
+    BatchUnitSettings settings{};
+    if (!publishedSettings_.refresh(settings, settingsVersion_)) {
+        return;
+    }
+    
+    const bool batchChanged = std::memcmp(&settings.batch, &batchConfig_,
+                                          sizeof(BatchProcessingConfig)) != 0;
+    if (batchChanged) {
+        // Buffered ticks were collected under the old mode and stream
+        // count - finish them with it instead of dropping them
+        flushAllBatches();
+    }
+    
+    batchConfig_ = settings.batch;
+    filterPredicate_ = settings.filter;
+    
+    if (batchChanged) {
+        // Restart adaptive batching from the configured size
+        lastArrivalNs_.store(0, std::memory_order_relaxed);
+        interArrivalNs_.store(0, std::memory_order_relaxed);
+        targetBatchSize_.store(batchSizeCap(), std::memory_order_relaxed);
+        stats_.targetBatchSize.store(batchSizeCap(), std::memory_order_relaxed);
+    }
+    selectBatchKernel();
+    
+    AARENDOCORE_TRACE_INSTANT(BATCH_UNIT, UNIT_CONFIG_ADOPTED, getId(), settingsVersion_);
+}
+
+// Origin: Attach workers for enableParallel
+void BatchProcessingUnit::attachThreadPool(ThreadPool* pool) noexcept {
+    threadPool_ = pool;
+}
+
 // Origin: Execute batch operation with FULL implementation
 u32 BatchProcessingUnit::executeBatch(BatchMode mode, const Tick** inputs,
                                       Tick** outputs, u32 count) noexcept {
@@ -277,7 +728,13 @@ u32 BatchProcessingUnit::executeBatch(BatchMode mode, const Tick** inputs,
     switch (mode) {
         case BatchMode::AGGREGATION:
             {
-                Tick aggregated = aggregateBatch(inputs, count);
+                // Parallel over streams when the buffered total is large
+                u64 buffered = 0;
+                for (u32 stream = 0; stream < batchConfig_.numInputStreams && stream < count; ++stream) {
+                    buffered += inputPositions_[stream].load(std::memory_order_acquire);
+                }
+                Tick aggregated = shouldRunParallel(buffered) ?
+                    aggregateBatchParallel(inputs, count) : aggregateBatch(inputs, count);
                 outputs[0][0] = aggregated;
                 processed = 1;
             }
@@ -296,27 +753,25 @@ u32 BatchProcessingUnit::executeBatch(BatchMode mode, const Tick** inputs,
             break;
             
         case BatchMode::TRANSFORM:
-            processed = transformBatch(inputs[0], outputs[0], count);
+            // In-place moving average depends on already-written neighbours
+            processed = shouldRunParallel(count) && inputs[0] != outputs[0] ?
+                transformBatchParallel(mode, inputs[0], outputs[0], count) :
+                transformBatch(inputs[0], outputs[0], count);
             break;
             
         case BatchMode::REDUCE:
             {
-                f64 reduced = reduceBatch(inputs[0], count);
-                outputs[0][0].price = reduced;
-                outputs[0][0].volume = count;
-                outputs[0][0].timestamp = inputs[0][count-1].timestamp;
+                f64 reduced = shouldRunParallel(count) ?
+                    reduceBatchParallel(inputs[0], count) : reduceBatch(inputs[0], count);
+                outputs[0][0] = MakeReducedTick(inputs[0], count, reduced);
                 processed = 1;
             }
             break;
             
         case BatchMode::MAP:
-            // Map operation - apply function to each element
-            for (u32 i = 0; i < count; ++i) {
-                outputs[0][i] = inputs[0][i];
-                // Apply transform function
-                outputs[0][i].price *= 1.1; // Example: 10% markup
-                processed++;
-            }
+            processed = shouldRunParallel(count) ?
+                transformBatchParallel(mode, inputs[0], outputs[0], count) :
+                mapBatch(inputs[0], outputs[0], count);
             break;
             
         case BatchMode::FILTER:
@@ -340,15 +795,48 @@ u32 BatchProcessingUnit::flushAllBatches() noexcept {
         u32 pos = inputPositions_[i].load(std::memory_order_acquire);
         if (pos > 0) {
             // Process remaining items in buffer
-            executeBatch(batchConfig_.mode,
-                        const_cast<const Tick**>(&inputBuffers_[i]),
-                        &outputBuffers_[i],
-                        pos);
+            executeStream(i, pos);
             
             totalFlushed += pos;
             inputPositions_[i].store(0, std::memory_order_release);
+            oldestArrivalNs_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    nextDeadlineNs_.store(UINT64_MAX, std::memory_order_relaxed);
+    
+    return totalFlushed;
+}
+
+// Origin: Flush every stream whose oldest tick reached the latency budget
+u32 BatchProcessingUnit::pollDeadlines(u64 nowNs) noexcept {
+    adoptBatchSettings();
+    
+    return flushDueStreams(nowNs, nowNs);
+}
+
+// Origin: Flush streams whose deadline falls at or before horizonNs
+u32 BatchProcessingUnit::flushDueStreams(u64 nowNs, u64 horizonNs) noexcept {
+    const u64 budget = batchConfig_.maxLatencyNs;
+    if (budget == 0 || horizonNs < nextDeadlineNs_.load(std::memory_order_relaxed)) {
+        return 0;
+    }
+    
+    u32 totalFlushed = 0;
+    u64 nextDeadline = UINT64_MAX;
+    
+    for (u32 i = 0; i < batchConfig_.numInputStreams; ++i) {
+        if (inputPositions_[i].load(std::memory_order_acquire) == 0) {
+            continue;
+        }
+        
+        const u64 deadline = oldestArrivalNs_[i].load(std::memory_order_relaxed) + budget;
+        if (horizonNs >= deadline) {
+            totalFlushed += flushStream(i, nowNs, true);
+        } else {
+            nextDeadline = std::min(nextDeadline, deadline);
         }
     }
+    nextDeadlineNs_.store(nextDeadline, std::memory_order_relaxed);
     
     return totalFlushed;
 }
@@ -358,6 +846,7 @@ void BatchProcessingUnit::resetBatches() noexcept {
     for (u32 i = 0; i < MAX_STREAMS; ++i) {
         inputPositions_[i].store(0, std::memory_order_release);
         outputPositions_[i].store(0, std::memory_order_release);
+        oldestArrivalNs_[i].store(0, std::memory_order_relaxed);
         
         if (inputBuffers_[i]) {
             std::memset(inputBuffers_[i], 0, MAX_BATCH_SIZE * sizeof(Tick));
@@ -371,80 +860,365 @@ void BatchProcessingUnit::resetBatches() noexcept {
     for (u32 i = 0; i < 8; ++i) {
         accumulators_[i] = _mm256_setzero_pd();
     }
+    
+    // Restart adaptive batching from the configured size
+    nextDeadlineNs_.store(UINT64_MAX, std::memory_order_relaxed);
+    lastArrivalNs_.store(0, std::memory_order_relaxed);
+    interArrivalNs_.store(0, std::memory_order_relaxed);
+    targetBatchSize_.store(batchSizeCap(), std::memory_order_relaxed);
+    stats_.targetBatchSize.store(batchSizeCap(), std::memory_order_relaxed);
+}
+
+// ==========================================================================
+// ADAPTIVE BATCHING - Arrival rate sets the size, maxLatencyNs bounds the wait
+// ==========================================================================
+//
+// The target is what one stream receives in half the latency budget at the
+// smoothed arrival rate: under load batches grow toward inputBatchSize and
+// amortize per-batch cost; when the feed goes quiet they shrink toward
+// ADAPTIVE_MIN_BATCH, and the oldest-tick deadline flushes whatever is left.
+
+// Origin: Buffered flush size cap
+u32 BatchProcessingUnit::batchSizeCap() const noexcept {
+    const u32 configured = batchConfig_.inputBatchSize;
+    return configured == 0 ? MAX_BATCH_SIZE : std::min(configured, MAX_BATCH_SIZE);
+}
+
+// Origin: Fold one arrival into the inter-arrival EWMA
+void BatchProcessingUnit::trackArrival(u64 nowNs) noexcept {
+    // Exchange so concurrent producers each fold their own gap
+    const u64 lastNs = lastArrivalNs_.exchange(nowNs, std::memory_order_relaxed);
+    if (lastNs != 0 && nowNs >= lastNs) {
+        const u64 gap = nowNs - lastNs;
+        const u64 ewma = interArrivalNs_.load(std::memory_order_relaxed);
+        if (ewma == 0) {
+            interArrivalNs_.store(gap, std::memory_order_relaxed);
+        } else {
+            // ewma += (gap - ewma) / 8, in signed arithmetic - a racing
+            // producer's update may be lost, which only slows convergence
+            const i64 delta = static_cast<i64>(gap) - static_cast<i64>(ewma);
+            interArrivalNs_.store(static_cast<u64>(static_cast<i64>(ewma) +
+                                                   delta / (1 << ARRIVAL_EWMA_SHIFT)),
+                                  std::memory_order_relaxed);
+        }
+    }
+}
+
+// Origin: Re-derive the target from arrival rate and latency budget
+void BatchProcessingUnit::adaptBatchSize(u64 nowNs) noexcept {
+    const u32 cap = batchSizeCap();
+    const u64 budget = batchConfig_.maxLatencyNs;
+    
+    const u64 ewma = interArrivalNs_.load(std::memory_order_relaxed);
+    if (budget == 0 || ewma == 0) {
+        targetBatchSize_.store(cap, std::memory_order_relaxed);
+        stats_.targetBatchSize.store(cap, std::memory_order_relaxed);
+        return;
+    }
+    
+    // A silent feed counts as slow as the current silence
+    u64 gap = ewma;
+    const u64 lastNs = lastArrivalNs_.load(std::memory_order_relaxed);
+    if (nowNs > lastNs) {
+        gap = std::max(gap, nowNs - lastNs);
+    }
+    gap = std::max<u64>(gap, 1);
+    
+    const u64 perStreamGap = gap * std::max(batchConfig_.numInputStreams, 1u);
+    const u64 desired = std::clamp<u64>(budget / (2 * perStreamGap),
+                                        std::min(ADAPTIVE_MIN_BATCH, cap), cap);
+    
+    // Move halfway each flush so one burst or pause cannot whipsaw the size
+    const u32 target = static_cast<u32>(
+        (targetBatchSize_.load(std::memory_order_relaxed) + desired + 1) / 2);
+    targetBatchSize_.store(target, std::memory_order_relaxed);
+    stats_.targetBatchSize.store(target, std::memory_order_relaxed);
+    stats_.arrivalRate.store(1e9 / static_cast<f64>(gap), std::memory_order_relaxed);
+}
+
+// Origin: Run one stream's buffer through the current mode
+void BatchProcessingUnit::executeStream(u32 streamId, u32 count) noexcept {
+    if (batchConfig_.mode == BatchMode::AGGREGATION) {
+        // executeBatch aggregates every stream from index 0 - handing it this
+        // stream's slot would pair neighbouring buffers with the wrong counts
+        outputBuffers_[streamId][0] = aggregateStream(streamId, count);
+        return;
+    }
+    
+    executeBatch(batchConfig_.mode,
+                const_cast<const Tick**>(&inputBuffers_[streamId]),
+                &outputBuffers_[streamId],
+                count);
+}
+
+// Origin: Execute one stream's buffer and record it on the tradeoff curve
+u32 BatchProcessingUnit::flushStream(u32 streamId, u64 nowNs, bool deadline) noexcept {
+    const u32 pos = inputPositions_[streamId].load(std::memory_order_acquire);
+    if (pos == 0) {
+        return 0;
+    }
+    
+    // The buffered ticks' real work - nests under the tick that filled it
+    AARENDOCORE_TRACE_SCOPE(BATCH_UNIT, UNIT_PROCESS_BATCH, getId(), pos);
+    
+    executeStream(streamId, pos);
+    inputPositions_[streamId].store(0, std::memory_order_release);
+    
+    const u64 oldest = oldestArrivalNs_[streamId].exchange(0, std::memory_order_relaxed);
+    const u64 waitNs = nowNs > oldest ? nowNs - oldest : 0;
+    
+    const u32 bucket = std::min<u32>(static_cast<u32>(std::bit_width(pos)) - 1,
+                                     BATCH_CURVE_BUCKETS - 1);
+    stats_.curveFlushes[bucket].fetch_add(1, std::memory_order_relaxed);
+    stats_.curveItems[bucket].fetch_add(pos, std::memory_order_relaxed);
+    stats_.curveWaitNs[bucket].fetch_add(waitNs, std::memory_order_relaxed);
+    u64 currentMax = stats_.curveMaxWaitNs[bucket].load(std::memory_order_relaxed);
+    while (waitNs > currentMax &&
+           !stats_.curveMaxWaitNs[bucket].compare_exchange_weak(currentMax, waitNs)) {}
+    
+    if (deadline) {
+        stats_.deadlineFlushes.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        stats_.fillFlushes.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    adaptBatchSize(nowNs);
+    return pos;
+}
+
+// ==========================================================================
+// KERNEL LANE OPERATIONS - Resolved per template instantiation
+// ==========================================================================
+
+namespace {
+
+// Origin: Transpose 4 AoS ticks into SoA price/volume registers
+// {price, volume} are adjacent in Tick, so each tick is one 16-byte load that
+// never crosses a cache line; two in-lane unpacks finish the transpose.
+// Materializing SoA arrays first was measured slower - the extra store and
+// reload pass cost more than the aligned loads saved.
+AARENDOCORE_FORCEINLINE void LoadLanes(const Tick* ticks, __m256d& prices, __m256d& volumes) noexcept {
+    // a: p0 v0 | p2 v2, b: p1 v1 | p3 v3
+    const __m256d a = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(&ticks[0].price)), _mm_loadu_pd(&ticks[2].price), 1);
+    const __m256d b = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(&ticks[1].price)), _mm_loadu_pd(&ticks[3].price), 1);
+    prices = _mm256_unpacklo_pd(a, b);
+    volumes = _mm256_unpackhi_pd(a, b);
+}
+
+// Origin: Element-wise price/volume combiner (0 sum, 1 product, 2 max, 3 min)
+template<u32 Function>
+AARENDOCORE_FORCEINLINE __m256d CombineLanes(__m256d prices, [[maybe_unused]] __m256d volumes) noexcept {
+    if constexpr (Function == 0) return _mm256_add_pd(prices, volumes);
+    else if constexpr (Function == 1) return _mm256_mul_pd(prices, volumes);
+    else if constexpr (Function == 2) return _mm256_max_pd(prices, volumes);
+    else if constexpr (Function == 3) return _mm256_min_pd(prices, volumes);
+    else return prices;
+}
+
+// Origin: Reduction step (0 sum, 1 product, 2 max, 3 min, 4 average)
+template<u32 Function>
+AARENDOCORE_FORCEINLINE __m256d ReduceLanes(__m256d acc, __m256d prices) noexcept {
+    if constexpr (Function == 1) return _mm256_mul_pd(acc, prices);
+    else if constexpr (Function == 2) return _mm256_max_pd(acc, prices);
+    else if constexpr (Function == 3) return _mm256_min_pd(acc, prices);
+    else return _mm256_add_pd(acc, prices);
+}
+
+template<u32 Function>
+AARENDOCORE_FORCEINLINE f64 ReduceScalar(f64 acc, f64 price) noexcept {
+    if constexpr (Function == 1) return acc * price;
+    else if constexpr (Function == 2) return std::max(acc, price);
+    else if constexpr (Function == 3) return std::min(acc, price);
+    else return acc + price;
 }
 
+} // anonymous namespace
+
 // ==========================================================================
 // PRIVATE METHODS - SIMD OPTIMIZED
 // ==========================================================================
 
 // Origin: Process batch with AVX2 - FULL implementation
 u32 BatchProcessingUnit::processBatchAVX2(const Tick* input, Tick* output, u32 count) noexcept {
-    if (!input || !output || count < AVX2_BATCH) {
+    if (!input || !output || count < AVX2_BATCH || count > MAX_BATCH_SIZE || !batchKernel_) {
         return 0;
     }
     
-    u32 processed = 0;
+    // Kernel was bound once at adoption - no mode/function switch here
+    return (this->*batchKernel_)(input, output, count);
+}
+
+// Origin: Bind specialized kernel - the only place mode/function are switched on
+void BatchProcessingUnit::selectBatchKernel() noexcept {
+    // Filter compactor exists at every level; enableAVX2 = false keeps it scalar
+    filterCompactor_ = SelectFilterCompactor(
+        batchConfig_.enableAVX2 ? GetSIMDKernels().level : SIMDLevel::SCALAR,
+        filterPredicate_.terms);
+    
+    // Kernels are AVX2; without it the generic scalar path handles everything
+    if (GetMaxSupportedSIMDLevel() < SIMDLevel::AVX2) {
+        batchKernel_ = nullptr;
+        return;
+    }
+    
+    const u32 function = batchConfig_.aggregationFunction;
     
-    // Process in groups of 4 (AVX2 can handle 4 doubles)
-    for (u32 i = 0; i <= count - AVX2_BATCH; i += AVX2_BATCH) {
-        // Load prices
-        __m256d prices = _mm256_set_pd(
-            input[i + 3].price,
-            input[i + 2].price,
-            input[i + 1].price,
-            input[i + 0].price
-        );
+    switch (batchConfig_.mode) {
+        case BatchMode::AGGREGATION:
+            batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::AGGREGATION, 0>;
+            break;
+            
+        case BatchMode::REDUCE:
+            // The 512-bit dispatched reducer (reduceBatch) outruns a 256-bit kernel
+            if (GetSIMDKernels().level == SIMDLevel::AVX512) {
+                batchKernel_ = nullptr;
+                break;
+            }
+            switch (function) {
+                case 0: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::REDUCE, 0>; break;
+                case 1: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::REDUCE, 1>; break;
+                case 2: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::REDUCE, 2>; break;
+                case 3: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::REDUCE, 3>; break;
+                case 4: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::REDUCE, 4>; break;
+                default: batchKernel_ = nullptr; break;  // Generic path
+            }
+            break;
+            
+        case BatchMode::FILTER:
+            // The left-pack compactor is already specialized on predicate terms
+            batchKernel_ = &BatchProcessingUnit::filterBatch;
+            break;
+            
+        default:
+            // TRANSFORM, MAP, DISTRIBUTION and ROUTING share the element-wise
+            // price/volume combiner on the single-batch path
+            switch (function) {
+                case 0: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::TRANSFORM, 0>; break;
+                case 1: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::TRANSFORM, 1>; break;
+                case 2: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::TRANSFORM, 2>; break;
+                case 3: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::TRANSFORM, 3>; break;
+                default: batchKernel_ = &BatchProcessingUnit::runBatchKernel<BatchMode::TRANSFORM, 4>; break;
+            }
+            break;
+    }
+}
+
+// Origin: Specialized kernel body - every branch below folds at compile time
+template<BatchMode Mode, u32 Function>
+u32 BatchProcessingUnit::runBatchKernel(const Tick* input, Tick* output, u32 count) noexcept {
+    if constexpr (Mode == BatchMode::AGGREGATION) {
+        // N→1 VWAP with two independent FMA chains per quantity
+        __m256d pv0 = _mm256_setzero_pd(), pv1 = _mm256_setzero_pd();
+        __m256d v0 = _mm256_setzero_pd(), v1 = _mm256_setzero_pd();
+        __m256d p0 = _mm256_setzero_pd(), p1 = _mm256_setzero_pd();
         
-        // Load volumes
-        __m256d volumes = _mm256_set_pd(
-            input[i + 3].volume,
-            input[i + 2].volume,
-            input[i + 1].volume,
-            input[i + 0].volume
-        );
+        u32 i = 0;
+        for (; i + 2 * AVX2_BATCH <= count; i += 2 * AVX2_BATCH) {
+            __m256d pa, va, pb, vb;
+            LoadLanes(input + i, pa, va);
+            LoadLanes(input + i + AVX2_BATCH, pb, vb);
+            pv0 = _mm256_fmadd_pd(pa, va, pv0);
+            pv1 = _mm256_fmadd_pd(pb, vb, pv1);
+            v0 = _mm256_add_pd(v0, va);
+            v1 = _mm256_add_pd(v1, vb);
+            p0 = _mm256_add_pd(p0, pa);
+            p1 = _mm256_add_pd(p1, pb);
+        }
         
-        // Apply operation based on function ID
-        __m256d result;
-        switch (batchConfig_.aggregationFunction) {
-            case 0: // Sum
-                result = _mm256_add_pd(prices, volumes);
-                break;
-            case 1: // Product
-                result = _mm256_mul_pd(prices, volumes);
-                break;
-            case 2: // Max
-                result = _mm256_max_pd(prices, volumes);
-                break;
-            case 3: // Min
-                result = _mm256_min_pd(prices, volumes);
-                break;
-            default:
-                result = prices;
-                break;
+        alignas(32) f64 lanes[12];
+        _mm256_store_pd(lanes + 0, _mm256_add_pd(pv0, pv1));
+        _mm256_store_pd(lanes + 4, _mm256_add_pd(v0, v1));
+        _mm256_store_pd(lanes + 8, _mm256_add_pd(p0, p1));
+        
+        f64 sumPriceVolume = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        f64 sumVolume = lanes[4] + lanes[5] + lanes[6] + lanes[7];
+        f64 sumPrice = lanes[8] + lanes[9] + lanes[10] + lanes[11];
+        for (; i < count; ++i) {
+            sumPriceVolume += input[i].price * input[i].volume;
+            sumVolume += input[i].volume;
+            sumPrice += input[i].price;
         }
         
-        // Store results
-        alignas(32) f64 results[4];
-        _mm256_store_pd(results, result);
+        u64 lastTimestamp = 0;
+        for (u32 j = 0; j < count; ++j) {
+            lastTimestamp = std::max(lastTimestamp, input[j].timestamp);
+        }
         
-        for (u32 j = 0; j < AVX2_BATCH; ++j) {
-            output[i + j] = input[i + j];
-            output[i + j].price = results[j];
+        output[0] = MakeAggregatedTick(sumPriceVolume, sumVolume, sumPrice, lastTimestamp, count);
+        return 1;
+    } else if constexpr (Mode == BatchMode::REDUCE) {
+        // KERNEL_ACCUMULATORS independent chains so each op overlaps the last
+        __m256d identity;
+        if constexpr (Function == 1) {
+            identity = _mm256_set1_pd(1.0);
+        } else if constexpr (Function == 2 || Function == 3) {
+            identity = _mm256_set1_pd(input[0].price);
+        } else {
+            identity = _mm256_setzero_pd();
         }
+        __m256d acc[KERNEL_ACCUMULATORS] = {identity, identity, identity, identity};
         
-        // Update accumulator
-        accumulators_[0] = _mm256_add_pd(accumulators_[0], result);
+        u32 i = 0;
+        for (; i + KERNEL_ACCUMULATORS * AVX2_BATCH <= count; i += KERNEL_ACCUMULATORS * AVX2_BATCH) {
+            for (u32 a = 0; a < KERNEL_ACCUMULATORS; ++a) {
+                __m256d prices, volumes;
+                LoadLanes(input + i + a * AVX2_BATCH, prices, volumes);
+                acc[a] = ReduceLanes<Function>(acc[a], prices);
+            }
+        }
+        for (; i + AVX2_BATCH <= count; i += AVX2_BATCH) {
+            __m256d prices, volumes;
+            LoadLanes(input + i, prices, volumes);
+            acc[0] = ReduceLanes<Function>(acc[0], prices);
+        }
         
-        processed += AVX2_BATCH;
-    }
-    
-    // Process remaining elements
-    for (u32 i = (count / AVX2_BATCH) * AVX2_BATCH; i < count; ++i) {
-        output[i] = input[i];
-        processed++;
+        acc[0] = ReduceLanes<Function>(acc[0], acc[1]);
+        acc[2] = ReduceLanes<Function>(acc[2], acc[3]);
+        acc[0] = ReduceLanes<Function>(acc[0], acc[2]);
+        
+        alignas(32) f64 lanes[AVX2_BATCH];
+        _mm256_store_pd(lanes, acc[0]);
+        f64 result = lanes[0];
+        for (u32 lane = 1; lane < AVX2_BATCH; ++lane) {
+            result = ReduceScalar<Function>(result, lanes[lane]);
+        }
+        for (; i < count; ++i) {
+            result = ReduceScalar<Function>(result, input[i].price);
+        }
+        if constexpr (Function == 4) {
+            result /= count;
+        }
+        
+        output[0] = MakeReducedTick(input, count, result);
+        return 1;
+    } else {
+        // Element-wise combine; results blended straight into output rows
+        u32 i = 0;
+        for (; i + AVX2_BATCH <= count; i += AVX2_BATCH) {
+            __m256d prices, volumes;
+            LoadLanes(input + i, prices, volumes);
+            __m256d result = CombineLanes<Function>(prices, volumes);
+            
+            const f64* src = reinterpret_cast<const f64*>(input + i);
+            f64* dst = reinterpret_cast<f64*>(output + i);
+            _mm256_store_pd(dst + 0, _mm256_blend_pd(_mm256_load_pd(src + 0),
+                _mm256_permute4x64_pd(result, 0x00), 0x2));
+            _mm256_store_pd(dst + 4, _mm256_blend_pd(_mm256_load_pd(src + 4),
+                _mm256_permute4x64_pd(result, 0x55), 0x2));
+            _mm256_store_pd(dst + 8, _mm256_blend_pd(_mm256_load_pd(src + 8),
+                _mm256_permute4x64_pd(result, 0xAA), 0x2));
+            _mm256_store_pd(dst + 12, _mm256_blend_pd(_mm256_load_pd(src + 12),
+                _mm256_permute4x64_pd(result, 0xFF), 0x2));
+        }
+        
+        // Remaining elements pass through, matching the generic path
+        for (; i < count; ++i) {
+            output[i] = input[i];
+        }
+        return count;
     }
-    
-    return processed;
 }
 
 // Origin: Aggregate batch N→1 with FULL implementation
@@ -476,12 +1250,16 @@ Tick BatchProcessingUnit::aggregateBatch(const Tick** inputs, u32 count) noexcep
     }
     
     // Calculate aggregated values
-    result.timestamp = lastTimestamp;
-    result.volume = sumVolume;
-    result.price = sumVolume > 0.0 ? sumPriceVolume / sumVolume : sumPrice / count;
-    result.flags = 0x20; // Aggregated flag
+    return MakeAggregatedTick(sumPriceVolume, sumVolume, sumPrice, lastTimestamp, count);
+}
+
+// Origin: Aggregate one stream's buffered ticks N→1
+Tick BatchProcessingUnit::aggregateStream(u32 streamId, u32 count) noexcept {
+    if (streamId >= MAX_STREAMS || !inputBuffers_[streamId] || count == 0) {
+        return Tick{};
+    }
     
-    return result;
+    return AggregateTicks(inputBuffers_[streamId], std::min(count, MAX_BATCH_SIZE));
 }
 
 // Origin: Route batch N→K with FULL implementation
@@ -558,87 +1336,607 @@ f64 BatchProcessingUnit::reduceBatch(const Tick* batch, u32 count) noexcept {
         return 0.0;
     }
     
-    f64 result = 0.0;
+    // Sum / product / max / min / average via the dispatched kernel
+    return GetSIMDKernels().reducePrice(batch, count, batchConfig_.aggregationFunction);
+}
+
+// Origin: Filter batch with FULL implementation
+// The predicate and compactor were bound at configure time - no per-tick switch
+u32 BatchProcessingUnit::filterBatch(const Tick* input, Tick* output, u32 count) noexcept {
+    if (!input || !output || count == 0 || !filterCompactor_) {
+        return 0;
+    }
     
-    switch (batchConfig_.aggregationFunction) {
-        case 0: // Sum
-            for (u32 i = 0; i < count; ++i) {
-                result += batch[i].price;
-            }
-            break;
-            
-        case 1: // Product
-            result = 1.0;
-            for (u32 i = 0; i < count; ++i) {
-                result *= batch[i].price;
-            }
-            break;
-            
-        case 2: // Max
-            result = batch[0].price;
-            for (u32 i = 1; i < count; ++i) {
-                result = std::max(result, batch[i].price);
+    return filterCompactor_(input, output, count, filterPredicate_);
+}
+
+// Origin: Map batch - apply function to each element
+u32 BatchProcessingUnit::mapBatch(const Tick* input, Tick* output, u32 count) noexcept {
+    if (!input || !output || count == 0) {
+        return 0;
+    }
+    
+    for (u32 i = 0; i < count; ++i) {
+        output[i] = input[i];
+        // Apply transform function
+        output[i].price *= 1.1; // Example: 10% markup
+    }
+    
+    return count;
+}
+
+// ==========================================================================
+// PARALLEL EXECUTION - Fork-join over the attached ThreadPool
+// ==========================================================================
+//
+// Parts are claimed from a shared counter by the caller and by helper tasks.
+// The caller never waits on a part nobody has claimed, so a saturated (or
+// re-entrant) pool degrades to serial instead of deadlocking. Each part
+// writes its own cache-line-sized partial; partials merge in part order, so
+// results do not depend on scheduling.
+
+namespace {
+
+// Origin: Structure for one part's partial accumulators
+struct alignas(CACHE_LINE_SIZE) BatchPartial {
+    f64 sumPrice;
+    f64 sumVolume;
+    f64 sumPriceVolume;
+    f64 value;              // REDUCE result for the part
+    u64 lastTimestamp;
+    u64 count;
+};
+
+// Origin: Shared fork-join state - heap owned so late helpers stay valid
+struct ForkJoinState {
+    std::function<void(u32)> body;  // Invoked only for successfully claimed parts
+    std::atomic<u32> nextPart{0};
+    std::atomic<u32> completedParts{0};
+    u32 parts{0};
+};
+
+// Origin: Claim and run parts until none remain
+void RunClaimedParts(ForkJoinState& state) noexcept {
+    for (;;) {
+        const u32 part = state.nextPart.fetch_add(1, std::memory_order_acq_rel);
+        if (part >= state.parts) {
+            return;
+        }
+        state.body(part);
+        state.completedParts.fetch_add(1, std::memory_order_release);
+    }
+}
+
+// Origin: Run body(0..parts-1) on the caller plus up to parts-1 pool workers
+template<typename Body>
+void ForkJoin(ThreadPool& pool, u32 parts, Body&& body) noexcept {
+    auto state = std::make_shared<ForkJoinState>();
+    state->body = [&body](u32 part) { body(part); };
+    state->parts = parts;
+    
+    const u32 helpers = std::min(parts - 1, pool.getWorkerCount());
+    for (u32 i = 0; i < helpers; ++i) {
+        if (!pool.submit([state]() { RunClaimedParts(*state); })) {
+            break;  // Queue full - the caller absorbs the remaining parts
+        }
+    }
+    
+    RunClaimedParts(*state);
+    
+    // Every part is claimed; wait only for helpers still running theirs
+    while (state->completedParts.load(std::memory_order_acquire) < parts) {
+        std::this_thread::yield();
+    }
+}
+
+// Origin: Split items into parts of at least PARALLEL_MIN_CHUNK
+u32 PlanParallelParts(u64 items, u32 workers) noexcept {
+    const u64 byChunk = items / BatchProcessingUnit::PARALLEL_MIN_CHUNK;
+    u64 parts = std::min<u64>(workers + 1, BatchProcessingUnit::MAX_PARALLEL_PARTS);
+    parts = std::min(parts, byChunk);
+    return parts == 0 ? 1 : static_cast<u32>(parts);
+}
+
+// Origin: Accumulate one stream into a partial (same order as the serial loop)
+void AccumulatePartial(const Tick* ticks, u32 count, BatchPartial& partial) noexcept {
+    for (u32 i = 0; i < count; ++i) {
+        partial.sumPrice += ticks[i].price;
+        partial.sumVolume += ticks[i].volume;
+        partial.sumPriceVolume += ticks[i].price * ticks[i].volume;
+        partial.lastTimestamp = std::max(partial.lastTimestamp, ticks[i].timestamp);
+    }
+    partial.count += count;
+}
+
+} // anonymous namespace
+
+// Origin: Parallel gate - below the threshold fork-join costs more than it saves
+bool BatchProcessingUnit::shouldRunParallel(u64 items) const noexcept {
+    return batchConfig_.enableParallel && threadPool_ &&
+           threadPool_->getWorkerCount() > 0 && items >= PARALLEL_THRESHOLD;
+}
+
+// Origin: Aggregate N→1 with one partial per stream, merged in stream order
+Tick BatchProcessingUnit::aggregateBatchParallel(const Tick** inputs, u32 count) noexcept {
+    Tick result{};
+    
+    if (!inputs || count == 0) {
+        return result;
+    }
+    
+    const u32 streams = std::min(batchConfig_.numInputStreams, count);
+    BatchPartial partials[MAX_STREAMS] = {};
+    
+    ForkJoin(*threadPool_, streams, [&](u32 stream) {
+        if (inputs[stream]) {
+            AccumulatePartial(inputs[stream],
+                              inputPositions_[stream].load(std::memory_order_acquire),
+                              partials[stream]);
+        }
+    });
+    stats_.parallelBatches.fetch_add(1, std::memory_order_relaxed);
+    
+    BatchPartial total{};
+    for (u32 stream = 0; stream < streams; ++stream) {
+        total.sumPrice += partials[stream].sumPrice;
+        total.sumVolume += partials[stream].sumVolume;
+        total.sumPriceVolume += partials[stream].sumPriceVolume;
+        total.lastTimestamp = std::max(total.lastTimestamp, partials[stream].lastTimestamp);
+    }
+    
+    result.timestamp = total.lastTimestamp;
+    result.volume = total.sumVolume;
+    result.price = total.sumVolume > 0.0 ? total.sumPriceVolume / total.sumVolume
+                                         : total.sumPrice / count;
+    result.flags = 0x20; // Aggregated flag
+    
+    return result;
+}
+
+// Origin: Reduce index ranges on workers, merge partials in range order
+f64 BatchProcessingUnit::reduceBatchParallel(const Tick* batch, u32 count) noexcept {
+    if (!batch || count == 0) {
+        return 0.0;
+    }
+    
+    const u32 function = batchConfig_.aggregationFunction;
+    if (function > 4) {
+        return reduceBatch(batch, count);  // Unknown IDs keep their serial meaning
+    }
+    
+    const u32 parts = PlanParallelParts(count, threadPool_->getWorkerCount());
+    const u32 chunk = (count + parts - 1) / parts;
+    const SIMDKernels& kernels = GetSIMDKernels();
+    BatchPartial partials[MAX_PARALLEL_PARTS] = {};
+    
+    // Average merges as a sum of sums
+    const u32 partFunction = function == 4 ? 0 : function;
+    ForkJoin(*threadPool_, parts, [&](u32 part) {
+        const u32 begin = part * chunk;
+        const u32 end = std::min(count, begin + chunk);
+        partials[part].value = kernels.reducePrice(batch + begin, end - begin, partFunction);
+    });
+    stats_.parallelBatches.fetch_add(1, std::memory_order_relaxed);
+    
+    f64 result = partials[0].value;
+    for (u32 part = 1; part < parts; ++part) {
+        const f64 value = partials[part].value;
+        switch (function) {
+            case 1:  result *= value; break;
+            case 2:  result = std::max(result, value); break;
+            case 3:  result = std::min(result, value); break;
+            default: result += value; break;
+        }
+    }
+    
+    return function == 4 ? result / count : result;
+}
+
+// Origin: TRANSFORM / MAP over index ranges (input and output must not alias)
+u32 BatchProcessingUnit::transformBatchParallel(BatchMode mode, const Tick* input,
+                                                Tick* output, u32 count) noexcept {
+    if (!input || !output || count == 0) {
+        return 0;
+    }
+    
+    const u32 parts = PlanParallelParts(count, threadPool_->getWorkerCount());
+    const u32 chunk = (count + parts - 1) / parts;
+    
+    ForkJoin(*threadPool_, parts, [&](u32 part) {
+        const u32 begin = part * chunk;
+        const u32 end = std::min(count, begin + chunk);
+        if (mode == BatchMode::MAP) {
+            mapBatch(input + begin, output + begin, end - begin);
+            return;
+        }
+        
+        transformBatch(input + begin, output + begin, end - begin);
+        // Moving average reaches one tick back across the range boundary
+        if (batchConfig_.transformFunction == 3 && begin > 0) {
+            output[begin].price = (input[begin].price + input[begin - 1].price) / 2.0;
+        }
+    });
+    stats_.parallelBatches.fetch_add(1, std::memory_order_relaxed);
+    
+    return count;
+}
+
+// ==========================================================================
+// KERNEL BENCHMARK - Generic path vs specialized kernels
+// ==========================================================================
+
+namespace {
+
+// Origin: Constant - Ticks per benchmark batch, Scope: Benchmark
+constexpr u32 BENCHMARK_BATCH = 1024;
+
+// Origin: Benchmark ticks - varied prices and volumes, some zero volumes
+void FillBenchmarkTicks(Tick* ticks) noexcept {
+    for (u32 i = 0; i < BENCHMARK_BATCH; ++i) {
+        ticks[i] = Tick{};
+        ticks[i].timestamp = 1000000ULL + i;
+        ticks[i].price = 50.0 + static_cast<f64>(i % 200);
+        ticks[i].volume = static_cast<f64>((i * 37) % 2000);
+    }
+}
+
+// Origin: Single-stream unit on the generic path or the specialized kernels
+void ConfigureBenchmarkUnit(BatchProcessingUnit* unit, BatchMode mode, u32 function,
+                            bool specialized) noexcept {
+    BatchProcessingConfig config{};
+    config.mode = mode;
+    config.inputBatchSize = BENCHMARK_BATCH;
+    config.outputBatchSize = BENCHMARK_BATCH;
+    config.numInputStreams = 1;
+    config.numOutputStreams = 1;
+    config.enableAVX2 = specialized;
+    config.aggregationFunction = function;
+    config.maxLatencyNs = 1000000;
+    unit->configureBatch(config);
+}
+
+// Origin: Same value up to summation order (kernels reassociate)
+bool NearlyEqual(f64 a, f64 b) noexcept {
+    return a == b || std::fabs(a - b) <= 1e-9 * std::max({1.0, std::fabs(a), std::fabs(b)});
+}
+
+// Origin: Run one batch down both paths of an N→1 mode and compare the ticks
+// Output: true if every field matches (price and volume up to rounding)
+bool BatchPathsAgree(BatchMode mode, u32 function) noexcept {
+    Tick* ticks = static_cast<Tick*>(_aligned_malloc(BENCHMARK_BATCH * sizeof(Tick),
+                                                     CACHE_LINE_SIZE));
+    if (!ticks) {
+        return false;
+    }
+    FillBenchmarkTicks(ticks);
+    
+    Tick results[2];
+    for (u32 path = 0; path < 2; ++path) {
+        BatchProcessingUnit* unit = new BatchProcessingUnit();
+        ConfigureBenchmarkUnit(unit, mode, function, path == 1);
+        unit->processBatch(SessionId{1}, ticks, BENCHMARK_BATCH);
+        results[path] = unit->getOutputBuffer(0)[0];
+        delete unit;
+    }
+    _aligned_free(ticks);
+    
+    return results[0].timestamp == results[1].timestamp &&
+           results[0].flags == results[1].flags &&
+           NearlyEqual(results[0].price, results[1].price) &&
+           NearlyEqual(results[0].volume, results[1].volume);
+}
+
+// Origin: Run one (mode, function) cell on a fresh unit
+// Output: Elapsed nanoseconds for iterations x BENCHMARK_BATCH ticks
+u64 RunBatchKernelBenchmark(u32 iterations, BatchMode mode, u32 function,
+                            bool specialized) noexcept {
+    BatchProcessingUnit* unit = new BatchProcessingUnit();
+    Tick* ticks = static_cast<Tick*>(_aligned_malloc(BENCHMARK_BATCH * sizeof(Tick),
+                                                     CACHE_LINE_SIZE));
+    if (!ticks) {
+        delete unit;
+        return 0;
+    }
+    
+    FillBenchmarkTicks(ticks);
+    ConfigureBenchmarkUnit(unit, mode, function, specialized);
+    
+    // Warm caches and branch predictors
+    unit->processBatch(SessionId{1}, ticks, BENCHMARK_BATCH);
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (u32 i = 0; i < iterations; ++i) {
+        unit->processBatch(SessionId{1}, ticks, BENCHMARK_BATCH);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    
+    _aligned_free(ticks);
+    delete unit;
+    
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+// Origin: Convert elapsed time to millions of ticks per second
+f64 TicksPerSecondM(u32 iterations, u64 elapsedNs) noexcept {
+    if (elapsedNs == 0) {
+        return 0.0;
+    }
+    return (static_cast<f64>(iterations) * BENCHMARK_BATCH * 1000.0) / static_cast<f64>(elapsedNs);
+}
+
+} // anonymous namespace
+
+// ==========================================================================
+// DLL EXPORTS
+// ==========================================================================
+
+// Origin: Time one matrix cell (specialized = 0 runs the generic path)
+extern "C" AARENDOCORE_API u64 AARendoCore_TestBatchKernelPerformance(u32 iterations,
+                                                                     u32 mode,
+                                                                     u32 function,
+                                                                     u32 specialized) {
+    if (iterations == 0) {
+        iterations = 10000;
+    }
+    if (mode > static_cast<u32>(BatchMode::FILTER)) {
+        return 0;
+    }
+    
+    return RunBatchKernelBenchmark(iterations, static_cast<BatchMode>(mode),
+                                   function, specialized != 0);
+}
+
+// Origin: Ticks/s per (mode, function), generic path vs specialized kernel.
+// N→1 rows also say whether both paths produced the same tick.
+extern "C" AARENDOCORE_API const char* AARendoCore_GetBatchKernelMatrix(u32 iterations) {
+    static char info[2048];
+    
+    if (iterations == 0) {
+        iterations = 2000;
+    }
+    
+    static constexpr BatchMode modes[] = {
+        BatchMode::AGGREGATION, BatchMode::TRANSFORM, BatchMode::REDUCE, BatchMode::FILTER
+    };
+    static constexpr const char* modeNames[] = {
+        "AGGREGATION", "TRANSFORM", "REDUCE", "FILTER"
+    };
+    
+    int written = std::snprintf(info, sizeof(info),
+        "BatchKernels (Mticks/s, generic -> specialized, %s):\n",
+        SIMDLevelToString(GetMaxSupportedSIMDLevel()));
+    
+    for (u32 m = 0; m < 4; ++m) {
+        for (u32 function = 0; function < 4; ++function) {
+            if (written < 0 || static_cast<usize>(written) >= sizeof(info)) {
+                return info;
             }
-            break;
             
-        case 3: // Min
-            result = batch[0].price;
-            for (u32 i = 1; i < count; ++i) {
-                result = std::min(result, batch[i].price);
-            }
-            break;
+            const u64 genericNs = RunBatchKernelBenchmark(iterations, modes[m], function, false);
+            const u64 specializedNs = RunBatchKernelBenchmark(iterations, modes[m], function, true);
             
-        case 4: // Average
-            for (u32 i = 0; i < count; ++i) {
-                result += batch[i].price;
+            const char* agreement = "";
+            if (modes[m] == BatchMode::AGGREGATION || modes[m] == BatchMode::REDUCE) {
+                agreement = BatchPathsAgree(modes[m], function) ? "  same" : "  MISMATCH";
             }
-            result /= count;
-            break;
             
-        default:
-            result = batch[0].price;
-            break;
+            written += std::snprintf(info + written, sizeof(info) - written,
+                "  %-11s f%u: %8.1f -> %8.1f%s\n",
+                modeNames[m], function,
+                TicksPerSecondM(iterations, genericNs),
+                TicksPerSecondM(iterations, specializedNs), agreement);
+        }
     }
     
-    return result;
+    return info;
 }
 
-// Origin: Filter batch with FULL implementation
-u32 BatchProcessingUnit::filterBatch(const Tick* input, Tick* output, u32 count) noexcept {
-    if (!input || !output || count == 0) {
+// Origin: Time the left-pack filter on full 4096-tick batches
+// Input: passPercent - share of ticks surviving (prices are uniform in [0, 100)),
+//        level - 0 scalar, 1 AVX2, 2 AVX-512 (clamped to supported)
+// Output: Elapsed nanoseconds for iterations x MAX_BATCH_SIZE ticks
+extern "C" AARENDOCORE_API u64 AARendoCore_TestFilterPerformance(u32 iterations,
+                                                                 u32 passPercent,
+                                                                 u32 level) {
+    constexpr u32 FILTER_BATCH = BatchProcessingUnit::MAX_BATCH_SIZE;
+    
+    if (iterations == 0) {
+        iterations = 10000;
+    }
+    if (passPercent > 100 || level > static_cast<u32>(SIMDLevel::AVX512)) {
         return 0;
     }
     
-    u32 outputCount = 0;
+    Tick* input = static_cast<Tick*>(_aligned_malloc(FILTER_BATCH * sizeof(Tick), CACHE_LINE_SIZE));
+    Tick* output = static_cast<Tick*>(_aligned_malloc(FILTER_BATCH * sizeof(Tick), CACHE_LINE_SIZE));
+    if (!input || !output) {
+        if (input) _aligned_free(input);
+        if (output) _aligned_free(output);
+        return 0;
+    }
     
-    for (u32 i = 0; i < count; ++i) {
-        bool passFilter = false;
-        
-        // Apply filter based on configuration
-        switch (batchConfig_.aggregationFunction) {
-            case 0: // Price > 100
-                passFilter = input[i].price > 100.0;
-                break;
-            case 1: // Volume > 1000
-                passFilter = input[i].volume > 1000.0;
-                break;
-            case 2: // Price in range [50, 150]
-                passFilter = input[i].price >= 50.0 && input[i].price <= 150.0;
-                break;
-            case 3: // Non-zero volume
-                passFilter = input[i].volume > 0.0;
-                break;
-            default:
-                passFilter = true;
-                break;
+    // Shuffled prices so a branchy filter would mispredict at 50%
+    u64 state = 0x9E3779B97F4A7C15ULL;
+    for (u32 i = 0; i < FILTER_BATCH; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        input[i] = Tick{};
+        input[i].timestamp = 1000000ULL + i;
+        input[i].price = static_cast<f64>(state >> 33) * (100.0 / 2147483648.0);
+        input[i].volume = static_cast<f64>(1 + (i * 37) % 2000);
+        input[i].flags = 0x1;
+    }
+    
+    // Composite predicate: price window sets the pass rate, volume and
+    // flags terms always hold but are still evaluated
+    FilterPredicate predicate{};
+    predicate.minPrice = 0.0;
+    predicate.maxPrice = std::nextafter(static_cast<f64>(passPercent), -FILTER_INFINITY);
+    predicate.minVolume = 1.0;
+    predicate.maxVolume = FILTER_INFINITY;
+    predicate.flagsMask = 0x1;
+    predicate.flagsValue = 0x1;
+    predicate.terms = FILTER_TERM_ALL;
+    
+    const FilterCompactor compactor =
+        SelectFilterCompactor(static_cast<SIMDLevel>(level), predicate.terms);
+    
+    // Warm caches
+    volatile u32 survivors = compactor(input, output, FILTER_BATCH, predicate);
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (u32 i = 0; i < iterations; ++i) {
+        survivors = compactor(input, output, FILTER_BATCH, predicate);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    (void)survivors;
+    
+    _aligned_free(input);
+    _aligned_free(output);
+    
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+// Origin: Time an end-of-day style REDUCE (mean) over a caller-sized array
+// Input: tickCount - Ticks per pass, workers - Pool size (0 runs serial)
+// Output: Elapsed nanoseconds for iterations passes
+extern "C" AARENDOCORE_API u64 AARendoCore_TestParallelBatchPerformance(u32 iterations,
+                                                                        u32 tickCount,
+                                                                        u32 workers) {
+    if (iterations == 0) {
+        iterations = 10;
+    }
+    if (tickCount == 0) {
+        tickCount = 4 * 1024 * 1024;
+    }
+    
+    Tick* ticks = static_cast<Tick*>(_aligned_malloc(static_cast<usize>(tickCount) * sizeof(Tick),
+                                                     CACHE_LINE_SIZE));
+    if (!ticks) {
+        return 0;
+    }
+    for (u32 i = 0; i < tickCount; ++i) {
+        ticks[i] = Tick{};
+        ticks[i].timestamp = 1000000ULL + i;
+        ticks[i].price = 50.0 + static_cast<f64>(i % 200);
+        ticks[i].volume = static_cast<f64>((i * 37) % 2000);
+    }
+    
+    ThreadPool* pool = workers > 0 ? new ThreadPool(workers, AffinityPolicy::None) : nullptr;
+    BatchProcessingUnit* unit = new BatchProcessingUnit();
+    
+    BatchProcessingConfig config{};
+    config.mode = BatchMode::REDUCE;
+    config.inputBatchSize = BatchProcessingUnit::MAX_BATCH_SIZE;
+    config.outputBatchSize = BatchProcessingUnit::MAX_BATCH_SIZE;
+    config.numInputStreams = 1;
+    config.numOutputStreams = 1;
+    config.enableAVX2 = true;
+    config.enableParallel = pool != nullptr;
+    config.aggregationFunction = 4;
+    config.maxLatencyNs = 1000000;
+    unit->configureBatch(config);
+    unit->adoptBatchSettings();
+    unit->attachThreadPool(pool);
+    
+    Tick result{};
+    Tick* outputs[1] = {&result};
+    const Tick* inputs[1] = {ticks};
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (u32 i = 0; i < iterations; ++i) {
+        unit->executeBatch(BatchMode::REDUCE, inputs, outputs, tickCount);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    
+    unit->attachThreadPool(nullptr);
+    delete unit;
+    if (pool) {
+        pool->shutdown();
+        delete pool;
+    }
+    _aligned_free(ticks);
+    
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+// Origin: Replay a burst / trickle / silence feed and report the tradeoff curve
+// Input: maxLatencyUs - Latency budget (0 uses 1000us)
+// Output: Per-bucket flushes, mean size and oldest-tick wait
+extern "C" AARENDOCORE_API const char* AARendoCore_GetAdaptiveBatchingCurve(u32 maxLatencyUs) {
+    static char info[2048];
+    
+    if (maxLatencyUs == 0) {
+        maxLatencyUs = 1000;
+    }
+    
+    BatchProcessingUnit* unit = new BatchProcessingUnit();
+    BatchProcessingConfig config{};
+    config.mode = BatchMode::TRANSFORM;
+    config.inputBatchSize = BatchProcessingUnit::MAX_BATCH_SIZE;
+    config.outputBatchSize = BatchProcessingUnit::MAX_BATCH_SIZE;
+    config.numInputStreams = 1;
+    config.numOutputStreams = 1;
+    config.enableAVX2 = true;
+    config.maxLatencyNs = static_cast<u64>(maxLatencyUs) * 1000;
+    unit->configureBatch(config);
+    
+    // Phases on a synthetic clock: 10M ticks/s for 50ms, 20K ticks/s for
+    // 200ms, then 50ms of silence covered only by pollDeadlines
+    struct Phase { u64 gapNs; u64 durationNs; };
+    static constexpr Phase phases[] = {
+        {100, 50000000}, {50000, 200000000}, {0, 50000000}
+    };
+    
+    Tick tick{};
+    u64 nowNs = 1;
+    for (const Phase& phase : phases) {
+        const u64 endNs = nowNs + phase.durationNs;
+        if (phase.gapNs == 0) {
+            // A timer driver sleeps until the next deadline, then polls
+            while (unit->getNextDeadlineNs() < endNs) {
+                nowNs = std::max(nowNs, unit->getNextDeadlineNs());
+                unit->pollDeadlines(nowNs);
+            }
+            nowNs = endNs;
+            continue;
         }
-        
-        if (passFilter) {
-            output[outputCount++] = input[i];
+        for (; nowNs < endNs; nowNs += phase.gapNs) {
+            tick.timestamp = nowNs;
+            tick.price = 100.0 + static_cast<f64>(nowNs % 1000) * 0.01;
+            tick.volume = 1.0;
+            unit->processTickAt(SessionId{1}, tick, nowNs);
         }
     }
     
-    return outputCount;
+    BatchStatistics stats = unit->getBatchStatistics();
+    delete unit;
+    
+    int written = std::snprintf(info, sizeof(info),
+        "AdaptiveBatching (budget %uus): fill=%llu deadline=%llu target=%u\n"
+        "  size>=   flushes   meanSize  meanWaitUs   maxWaitUs\n",
+        maxLatencyUs,
+        static_cast<unsigned long long>(stats.fillFlushes.load()),
+        static_cast<unsigned long long>(stats.deadlineFlushes.load()),
+        stats.targetBatchSize.load());
+    
+    for (u32 bucket = 0; bucket < BATCH_CURVE_BUCKETS; ++bucket) {
+        const u64 flushes = stats.curveFlushes[bucket].load();
+        if (flushes == 0) {
+            continue;
+        }
+        if (written < 0 || static_cast<usize>(written) >= sizeof(info)) {
+            return info;
+        }
+        written += std::snprintf(info + written, sizeof(info) - written,
+            "  %6u %9llu %10.1f %11.1f %11.1f\n",
+            1u << bucket,
+            static_cast<unsigned long long>(flushes),
+            static_cast<f64>(stats.curveItems[bucket].load()) / static_cast<f64>(flushes),
+            static_cast<f64>(stats.curveWaitNs[bucket].load()) / static_cast<f64>(flushes) / 1000.0,
+            static_cast<f64>(stats.curveMaxWaitNs[bucket].load()) / 1000.0);
+    }
+    
+    return info;
 }
 
 } // namespace AARendoCoreGLM
\ No newline at end of file
@@ -26,6 +26,9 @@ static constexpr int BatchProcessingUnit_CompilationLevel = 4;
 
 namespace AARendoCoreGLM {
 
+// Forward declaration - parallel batches borrow workers from the pool
+class ThreadPool;
+
 // ==========================================================================
 // BATCH PROCESSING MODES
 // ==========================================================================
@@ -76,6 +79,8 @@ struct alignas(CACHE_LINE_SIZE) BatchProcessingConfig {
     u32 transformFunction;
     
     // Origin: Member - Max latency target, Scope: Config lifetime
+    // Buffered ticks flush once the oldest waited this long; 0 disables
+    // deadlines and adaptive sizing (flush only at inputBatchSize)
     u64 maxLatencyNs;
     
     // Padding to cache line
@@ -85,11 +90,65 @@ struct alignas(CACHE_LINE_SIZE) BatchProcessingConfig {
 static_assert(sizeof(BatchProcessingConfig) == CACHE_LINE_SIZE,
               "BatchProcessingConfig must be exactly one cache line");
 
+// ==========================================================================
+// FILTER PREDICATES
+// ==========================================================================
+
+// Origin: Enumeration of composable filter terms (bit flags)
+enum FilterTerm : u32 {
+    FILTER_TERM_PRICE  = 0x1,   // minPrice <= price <= maxPrice
+    FILTER_TERM_VOLUME = 0x2,   // minVolume <= volume <= maxVolume
+    FILTER_TERM_FLAGS  = 0x4,   // (flags & flagsMask) == flagsValue
+    FILTER_TERM_ALL    = 0x7
+};
+
+// Origin: Structure for composite filter predicates
+// Scope: Set through configureBatch (legacy IDs) or configureFilter
+// A tick passes when every enabled term holds; no terms passes everything.
+struct FilterPredicate {
+    // Origin: Member - Inclusive price bounds, Scope: Predicate lifetime
+    f64 minPrice;
+    f64 maxPrice;
+    
+    // Origin: Member - Inclusive volume bounds, Scope: Predicate lifetime
+    f64 minVolume;
+    f64 maxVolume;
+    
+    // Origin: Member - Flag match, Scope: Predicate lifetime
+    u32 flagsMask;
+    u32 flagsValue;
+    
+    // Origin: Member - Enabled FilterTerm bits, Scope: Predicate lifetime
+    u32 terms;
+};
+
+// Origin: Type - Branch-free left-pack filter, one per (ISA, terms) pair
+// Survivors are packed to the front of output; returns the survivor count.
+// output may equal input (in-place compaction).
+using FilterCompactor = u32 (*)(const Tick* input, Tick* output, u32 count,
+                                const FilterPredicate& predicate) noexcept;
+
+// Origin: What configureBatch/configureFilter publish - swapped as one so a
+// batch never pairs a new mode with an old filter
+// Scope: Immutable once published
+struct BatchUnitSettings {
+    // Origin: Member - Batch configuration, Scope: Snapshot lifetime
+    BatchProcessingConfig batch;
+    
+    // Origin: Member - Filter predicate, Scope: Snapshot lifetime
+    FilterPredicate filter;
+};
+
 // ==========================================================================
 // BATCH STATISTICS
 // ==========================================================================
 
+// Origin: Constant - log2 batch-size buckets of the tradeoff curve (1..4096)
+constexpr u32 BATCH_CURVE_BUCKETS = 13;
+
 // Origin: Structure for batch statistics
+// The tradeoff curve buckets buffered flushes by floor(log2(batch size)) and
+// records how long the oldest tick of each batch waited.
 struct alignas(CACHE_LINE_SIZE) BatchStatistics {
     // Origin: Member - Total batches processed, Scope: Session lifetime
     AtomicU64 batchesProcessed;
@@ -109,8 +168,26 @@ struct alignas(CACHE_LINE_SIZE) BatchStatistics {
     // Origin: Member - Current throughput items/sec, Scope: Real-time
     AtomicF64 throughput;
     
-    // Padding
-    char padding[8];
+    // Origin: Member - Batches split across the ThreadPool, Scope: Session lifetime
+    AtomicU64 parallelBatches;
+    
+    // Origin: Member - Buffered flushes because the batch filled, Scope: Session lifetime
+    AtomicU64 fillFlushes;
+    
+    // Origin: Member - Buffered flushes because the oldest tick hit maxLatencyNs
+    AtomicU64 deadlineFlushes;
+    
+    // Origin: Member - Smoothed arrival rate ticks/sec, Scope: Real-time
+    AtomicF64 arrivalRate;
+    
+    // Origin: Member - Adaptive batch size in force, Scope: Real-time
+    AtomicU32 targetBatchSize;
+    
+    // Origin: Member - Tradeoff curve, Scope: Session lifetime
+    AtomicU64 curveFlushes[BATCH_CURVE_BUCKETS];     // Flushes per size bucket
+    AtomicU64 curveItems[BATCH_CURVE_BUCKETS];       // Ticks flushed per bucket
+    AtomicU64 curveWaitNs[BATCH_CURVE_BUCKETS];      // Sum of oldest-tick waits
+    AtomicU64 curveMaxWaitNs[BATCH_CURVE_BUCKETS];   // Worst oldest-tick wait
     
     // Default constructor
     BatchStatistics() noexcept = default;
@@ -123,13 +200,24 @@ struct alignas(CACHE_LINE_SIZE) BatchStatistics {
         minLatencyNs.store(other.minLatencyNs.load(std::memory_order_relaxed));
         maxLatencyNs.store(other.maxLatencyNs.load(std::memory_order_relaxed));
         throughput.store(other.throughput.load(std::memory_order_relaxed));
+        parallelBatches.store(other.parallelBatches.load(std::memory_order_relaxed));
+        fillFlushes.store(other.fillFlushes.load(std::memory_order_relaxed));
+        deadlineFlushes.store(other.deadlineFlushes.load(std::memory_order_relaxed));
+        arrivalRate.store(other.arrivalRate.load(std::memory_order_relaxed));
+        targetBatchSize.store(other.targetBatchSize.load(std::memory_order_relaxed));
+        for (u32 i = 0; i < BATCH_CURVE_BUCKETS; ++i) {
+            curveFlushes[i].store(other.curveFlushes[i].load(std::memory_order_relaxed));
+            curveItems[i].store(other.curveItems[i].load(std::memory_order_relaxed));
+            curveWaitNs[i].store(other.curveWaitNs[i].load(std::memory_order_relaxed));
+            curveMaxWaitNs[i].store(other.curveMaxWaitNs[i].load(std::memory_order_relaxed));
+        }
     }
     
     BatchStatistics& operator=(const BatchStatistics&) = delete;
 };
 
-static_assert(sizeof(BatchStatistics) == CACHE_LINE_SIZE,
-              "BatchStatistics must be exactly one cache line");
+static_assert(sizeof(BatchStatistics) % CACHE_LINE_SIZE == 0,
+              "BatchStatistics must be whole cache lines");
 
 // ==========================================================================
 // BATCH PROCESSING UNIT - ALIEN LEVEL BATCHING
@@ -150,15 +238,43 @@ public:
     
     // Origin: Constant - AVX2 batch size, Scope: Compile-time
     static constexpr u32 AVX2_BATCH = 4;         // Process 4 doubles
+    
+    // Origin: Constant - Independent accumulators per reduction, Scope: Compile-time
+    static constexpr u32 KERNEL_ACCUMULATORS = 4; // Covers 4-cycle FMA/add latency
+    
+    // Origin: Constant - Items below which executeBatch stays serial, Scope: Compile-time
+    static constexpr u32 PARALLEL_THRESHOLD = 32768;  // Fork-join costs ~10us
+    
+    // Origin: Constant - Minimum items per parallel part, Scope: Compile-time
+    static constexpr u32 PARALLEL_MIN_CHUNK = 16384;
+    
+    // Origin: Constant - Maximum parts per parallel batch, Scope: Compile-time
+    static constexpr u32 MAX_PARALLEL_PARTS = 64;     // One per stream at most
+    
+    // Origin: Constant - Smallest adaptive batch, Scope: Compile-time
+    static constexpr u32 ADAPTIVE_MIN_BATCH = 16;
+    
+    // Origin: Constant - Arrival EWMA weight as a shift (1/8), Scope: Compile-time
+    static constexpr u32 ARRIVAL_EWMA_SHIFT = 3;
 
 private:
+    // Origin: Type - Specialized kernel, one per (mode, function) pair
+    using BatchKernel = u32 (BatchProcessingUnit::*)(const Tick* input, Tick* output,
+                                                     u32 count) noexcept;
+    
     // ======================================================================
     // MEMBER VARIABLES - PSYCHOTICALLY ALIGNED
     // ======================================================================
     
-    // Origin: Member - Batch configuration, Scope: Instance lifetime
+    // Origin: Member - Batch configuration in use, Scope: Adopted at batch boundaries
     BatchProcessingConfig batchConfig_;
     
+    // Origin: Member - Latest configureBatch/configureFilter snapshot, Scope: Instance lifetime
+    VersionedConfig<BatchUnitSettings> publishedSettings_;
+    
+    // Origin: Member - Version the settings in use were copied from, Scope: Processing thread
+    u64 settingsVersion_;
+    
     // Origin: Member - Batch statistics, Scope: Instance lifetime
     mutable BatchStatistics stats_;
     
@@ -181,6 +297,34 @@ private:
     // Origin: Member - Last batch timestamp, Scope: Instance lifetime
     AtomicU64 lastBatchTime_;
     
+    // Origin: Member - Kernel bound when settings are adopted, Scope: Until reconfigured
+    BatchKernel batchKernel_;
+    
+    // Origin: Member - Active filter predicate, Scope: Adopted with batchConfig_
+    FilterPredicate filterPredicate_;
+    
+    // Origin: Member - Compactor bound to predicate terms, Scope: Until reconfigured
+    FilterCompactor filterCompactor_;
+    
+    // Origin: Member - Workers for enableParallel (not owned), Scope: Until detached
+    ThreadPool* threadPool_;
+    
+    // Adaptive state below is shared by producers calling processTickAt and
+    // whoever polls deadlines - relaxed atomics, each value is a heuristic
+    
+    // Origin: Member - Arrival time of each stream's oldest buffered tick (0 = empty)
+    AtomicU64 oldestArrivalNs_[MAX_STREAMS];
+    
+    // Origin: Member - Earliest stream deadline (may be stale-early), Scope: Real-time
+    AtomicU64 nextDeadlineNs_;
+    
+    // Origin: Member - Arrival-rate tracking, Scope: Real-time
+    AtomicU64 lastArrivalNs_;
+    AtomicU64 interArrivalNs_;  // EWMA of the gap between ticks
+    
+    // Origin: Member - Adaptive flush size, Scope: Real-time
+    AtomicU32 targetBatchSize_;
+    
     // ======================================================================
     // PRIVATE METHODS - SIMD OPTIMIZED
     // ======================================================================
@@ -190,11 +334,26 @@ private:
     // Output: Number processed
     u32 processBatchAVX2(const Tick* input, Tick* output, u32 count) noexcept;
     
+    // Origin: Bind the specialized kernel for the current mode/function
+    void selectBatchKernel() noexcept;
+
+    
+    // Origin: Specialized kernel - mode and function resolved at compile time
+    // Input: input - Input batch, output - Output batch, count - Items
+    // Output: Number of output items
+    template<BatchMode Mode, u32 Function>
+    u32 runBatchKernel(const Tick* input, Tick* output, u32 count) noexcept;
+    
     // Origin: Aggregate batch N→1
     // Input: inputs - Multiple input streams, count - Items per stream
     // Output: Aggregated tick
     Tick aggregateBatch(const Tick** inputs, u32 count) noexcept;
     
+    // Origin: Aggregate one stream's buffered ticks N→1
+    // Input: streamId - Buffered stream, count - Ticks in its buffer
+    // Output: Aggregated tick
+    Tick aggregateStream(u32 streamId, u32 count) noexcept;
+    
     // Origin: Route batch N→K
     // Input: input - Input batch, outputs - Output streams, count - Items
     // Output: Number routed
@@ -214,6 +373,53 @@ private:
     // Input: input - Input batch, output - Output batch, count - Items
     // Output: Number passing filter
     u32 filterBatch(const Tick* input, Tick* output, u32 count) noexcept;
+    
+    // ======================================================================
+    // PRIVATE METHODS - ADAPTIVE BATCHING
+    // ======================================================================
+    
+    // Origin: Buffered flush size cap (inputBatchSize, bounded by MAX_BATCH_SIZE)
+    u32 batchSizeCap() const noexcept;
+    
+    // Origin: Fold one arrival into the inter-arrival EWMA
+    void trackArrival(u64 nowNs) noexcept;
+    
+    // Origin: Re-derive targetBatchSize_ from arrival rate and maxLatencyNs
+    void adaptBatchSize(u64 nowNs) noexcept;
+    
+    // Origin: Run one stream's buffer through the current mode
+    void executeStream(u32 streamId, u32 count) noexcept;
+    
+    // Origin: Execute one stream's buffer and record it on the tradeoff curve
+    // Output: Number of ticks flushed
+    u32 flushStream(u32 streamId, u64 nowNs, bool deadline) noexcept;
+    
+    // Origin: Flush streams whose deadline falls at or before horizonNs
+    // Output: Number of ticks flushed
+    u32 flushDueStreams(u64 nowNs, u64 horizonNs) noexcept;
+    
+    // Origin: Map batch (10% markup)
+    // Input: input - Input batch, output - Output batch, count - Items
+    // Output: Number mapped
+    u32 mapBatch(const Tick* input, Tick* output, u32 count) noexcept;
+    
+    // ======================================================================
+    // PRIVATE METHODS - PARALLEL
+    // ======================================================================
+    
+    // Origin: Parallel path enabled, pool attached and batch above threshold
+    bool shouldRunParallel(u64 items) const noexcept;
+    
+    // Origin: Aggregate N streams with one partial accumulator per stream
+    Tick aggregateBatchParallel(const Tick** inputs, u32 count) noexcept;
+    
+    // Origin: Reduce index ranges in parallel, merge partials in order
+    f64 reduceBatchParallel(const Tick* batch, u32 count) noexcept;
+    
+    // Origin: TRANSFORM / MAP over index ranges in parallel
+    // Output: Number processed
+    u32 transformBatchParallel(BatchMode mode, const Tick* input, Tick* output,
+                               u32 count) noexcept;
 
 public:
     // ======================================================================
@@ -246,17 +452,41 @@ public:
     // BATCH-SPECIFIC METHODS
     // ======================================================================
     
-    // Origin: Configure batch processing
+    // Origin: Configure batch processing - safe while processing. Takes
+    // effect at the next tick/batch/poll; ticks already buffered are
+    // flushed under the old configuration first.
     // Input: config - Batch configuration
     // Output: ResultCode
     ResultCode configureBatch(const BatchProcessingConfig& config) noexcept;
     
+    // Origin: Install a composite filter predicate (overrides the legacy
+    // aggregationFunction filter IDs until the next configureBatch).
+    // Published like configureBatch.
+    // Input: predicate - Price/volume/flags terms
+    // Output: ResultCode
+    ResultCode configureFilter(const FilterPredicate& predicate) noexcept;
+    
+    // Origin: Attach workers for enableParallel (nullptr detaches)
+    // The pool must outlive the unit or be detached first.
+    // Input: pool - Shared ThreadPool
+    void attachThreadPool(ThreadPool* pool) noexcept;
+    
     // Origin: Execute batch operation
+    // With enableParallel and an attached pool, batches of PARALLEL_THRESHOLD
+    // items or more are split across workers; count is not capped here, so
+    // caller-owned arrays of millions of ticks are accepted for REDUCE,
+    // TRANSFORM and MAP.
     // Input: mode - Batch mode, inputs - Input streams, outputs - Output streams
     // Output: Number processed
     u32 executeBatch(BatchMode mode, const Tick** inputs, 
                      Tick** outputs, u32 count) noexcept;
     
+    // Origin: Pick up settings published since the last batch - flushes
+    // what was buffered under the old ones, then rebinds the kernels.
+    // Ticks, batches and polls do this themselves; callers driving
+    // executeBatch directly call it at their own batch boundaries.
+    void adoptBatchSettings() noexcept;
+    
     // Origin: Get batch statistics
     // Output: Current statistics
     BatchStatistics getBatchStatistics() const noexcept;
@@ -265,6 +495,27 @@ public:
     // Output: Number of items flushed
     u32 flushAllBatches() noexcept;
     
+    // Origin: Process tick with a caller-supplied arrival time (replay, feed
+    // handler timestamps). processTick uses the steady clock.
+    // Input: arrivalNs - Monotonic nanoseconds
+    ProcessResult processTickAt(SessionId sessionId, const Tick& tick,
+                                u64 arrivalNs) noexcept;
+    
+    // Origin: Flush streams whose oldest tick reached maxLatencyNs. Ticks
+    // also check deadlines, so call this from a timer only to cover quiet
+    // periods with no arrivals.
+    // Input: nowNs - Monotonic nanoseconds (same clock as arrivals)
+    // Output: Number of items flushed
+    u32 pollDeadlines(u64 nowNs) noexcept;
+    
+    // Origin: Output buffer of a stream - processBatch's N→1 result is [0] of stream 0
+    const Tick* getOutputBuffer(u32 streamId) const noexcept {
+        return streamId < MAX_STREAMS ? outputBuffers_[streamId] : nullptr;
+    }
+    
+    // Origin: Earliest pending deadline (UINT64_MAX if nothing is buffered)
+    u64 getNextDeadlineNs() const noexcept { return nextDeadlineNs_.load(std::memory_order_relaxed); }
+    
     // Origin: Reset batch buffers
     void resetBatches() noexcept;
     
@@ -286,6 +537,7 @@ static_assert(sizeof(BatchProcessingUnit) <= ULTRA_PAGE_SIZE * 4,
 ENFORCE_NO_MUTEX(AARendoCoreGLM::BatchProcessingUnit);
 ENFORCE_NO_MUTEX(AARendoCoreGLM::BatchProcessingConfig);
 ENFORCE_NO_MUTEX(AARendoCoreGLM::BatchStatistics);
+ENFORCE_NO_MUTEX(AARendoCoreGLM::FilterPredicate);
 
 // Mark header complete
 ENFORCE_HEADER_COMPLETE(Core_BatchProcessingUnit);
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "Core_DAGBuilder.h"
+#include "Core_SIMDDispatch.h"
 #include <algorithm>
 
 AARENDOCORE_NAMESPACE_BEGIN
@@ -53,7 +54,7 @@ DAGNode* DAGInstance::getNode(NodeId id) noexcept {
 // Constructor
 DAGBuilder::DAGBuilder() noexcept 
     : nodePool(&getGlobalNodePool())
-    , stats{0, 0, 0, 0} {
+    , stats{0, 0, 0, 0, 0} {
 }
 
 // Build DAG from topology
@@ -134,6 +135,101 @@ DAGInstance* DAGBuilder::buildDAG(const DAGTopology& topology) noexcept {
     return dag;
 }
 
+// Compile topology into a shared template
+DAGTemplate* DAGBuilder::buildTemplate(const DAGTopology& topology) noexcept {
+    // Validate topology first
+    ValidationResult validation = validateTopology(topology);
+    if (!validation.isValid) {
+        stats.validationsFailed.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    
+    // Every node needs a batched kernel - there is no per-node fallback
+    for (const auto& nodeDesc : topology.nodes) {
+        if (!getTemplateKernel(nodeDesc.type)) {
+            stats.validationsFailed.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+    
+    // Schedule = topological order, same DFS as topologicalSort
+    tbb::concurrent_hash_map<NodeId, tbb::concurrent_vector<NodeId>, NodeIdHashCompare> adjList;
+    tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare> colors;
+    tbb::concurrent_vector<NodeId> order;
+    
+    for (const auto& nodeDesc : topology.nodes) {
+        adjList.insert(std::make_pair(nodeDesc.nodeId, tbb::concurrent_vector<NodeId>()));
+        colors.insert(std::make_pair(nodeDesc.nodeId, NodeColor::WHITE));
+    }
+    
+    for (const auto& edge : topology.edges) {
+        tbb::concurrent_hash_map<NodeId, tbb::concurrent_vector<NodeId>, NodeIdHashCompare>::accessor accessor;
+        if (adjList.find(accessor, edge.sourceNode)) {
+            accessor->second.push_back(edge.targetNode);
+        }
+    }
+    
+    for (const auto& nodeDesc : topology.nodes) {
+        tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare>::accessor accessor;
+        if (colors.find(accessor, nodeDesc.nodeId) && accessor->second == NodeColor::WHITE) {
+            accessor.release();
+            if (!dfsVisit(nodeDesc.nodeId, colors, order, adjList)) {
+                return nullptr;  // Cycle detected
+            }
+        }
+    }
+    
+    std::reverse(order.begin(), order.end());
+    
+    // Schedule index of every node
+    tbb::concurrent_hash_map<NodeId, u32, NodeIdHashCompare> scheduleIndex;
+    for (u32 i = 0; i < static_cast<u32>(order.size()); ++i) {
+        scheduleIndex.insert(std::make_pair(order[i], i));
+    }
+    
+    DAGTemplate* dagTemplate = new DAGTemplate(generateDAGId(), static_cast<u32>(order.size()));
+    if (!dagTemplate->isAllocated()) {
+        delete dagTemplate;
+        return nullptr;
+    }
+    
+    for (u32 i = 0; i < static_cast<u32>(order.size()); ++i) {
+        const DAGTopology::NodeDescriptor* nodeDesc = nullptr;
+        for (const auto& candidate : topology.nodes) {
+            if (candidate.nodeId == order[i]) {
+                nodeDesc = &candidate;
+                break;
+            }
+        }
+        
+        DAGTemplate::CompiledNode compiled;
+        compiled.nodeId = order[i];
+        compiled.type = nodeDesc->type;
+        compiled.kernel = getTemplateKernel(nodeDesc->type);
+        compiled.input = DAG_TEMPLATE_NO_INPUT;
+        
+        // Data comes from the earliest-scheduled predecessor; further
+        // predecessors only order execution
+        for (const auto& edge : topology.edges) {
+            if (edge.targetNode != order[i]) {
+                continue;
+            }
+            
+            tbb::concurrent_hash_map<NodeId, u32, NodeIdHashCompare>::const_accessor accessor;
+            if (scheduleIndex.find(accessor, edge.sourceNode) && accessor->second < compiled.input) {
+                compiled.input = accessor->second;
+            }
+        }
+        
+        dagTemplate->setNode(i, compiled);
+        stats.edgesCreated.fetch_add(compiled.input != DAG_TEMPLATE_NO_INPUT ? 1 : 0, 
+                                     std::memory_order_relaxed);
+    }
+    
+    stats.templatesBuilt.fetch_add(1, std::memory_order_relaxed);
+    return dagTemplate;
+}
+
 // Validate topology
 ValidationResult DAGBuilder::validateTopology(const DAGTopology& topology) noexcept {
     ValidationResult result;
@@ -233,6 +329,9 @@ void DAGBuilder::optimizeDAG(DAGInstance* dag) noexcept {
     // Set NUMA affinity
     setNumaAffinity(dag);
     
+    // Widest vector width the dispatched kernels actually run on this CPU
+    const u32 maxSimdWidth = GetActiveSIMDWidthBits();
+    
     // PSYCHOTIC: Optimize data locality by grouping related nodes
     // This is a simplified optimization - real implementation would be more complex
     for (auto* node : dag->getNodes()) {
@@ -254,6 +353,9 @@ void DAGBuilder::optimizeDAG(DAGInstance* dag) noexcept {
                 break;
         }
         
+        // Never request more width than the CPU provides
+        node->simdWidth = std::min(node->simdWidth, maxSimdWidth);
+        
         // Set cache hints
         node->cacheHints = 0x1;  // Prefetch L1
     }
@@ -286,6 +388,7 @@ bool DAGBuilder::detectCycles(const DAGTopology& topology) noexcept {
     for (const auto& node : topology.nodes) {
         tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare>::accessor accessor;
         if (colors.find(accessor, node.nodeId) && accessor->second == NodeColor::WHITE) {
+            accessor.release();
             if (!dfsVisit(node.nodeId, colors, dummy, adjList)) {
                 return true;  // Cycle detected
             }
@@ -319,6 +422,7 @@ bool DAGBuilder::detectCyclesInDAG(const DAGInstance* dag) noexcept {
     for (const auto* node : dag->getNodes()) {
         tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare>::accessor accessor;
         if (colors.find(accessor, node->nodeId) && accessor->second == NodeColor::WHITE) {
+            accessor.release();
             if (!dfsVisit(node->nodeId, colors, dummy, adjList)) {
                 return true;  // Cycle detected
             }
@@ -345,15 +449,20 @@ bool DAGBuilder::dfsVisit(NodeId nodeId,
     tbb::concurrent_hash_map<NodeId, tbb::concurrent_vector<NodeId>, NodeIdHashCompare>::const_accessor adjAccessor;
     if (adjList.find(adjAccessor, nodeId)) {
         for (const auto& successor : adjAccessor->second) {
-            tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare>::accessor colorAccessor;
-            if (colors.find(colorAccessor, successor)) {
-                if (colorAccessor->second == NodeColor::GRAY) {
-                    return false;  // Back edge found - cycle detected
+            NodeColor color = NodeColor::BLACK;
+            {
+                // Accessors are not reentrant - release before recursing
+                tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare>::const_accessor colorAccessor;
+                if (colors.find(colorAccessor, successor)) {
+                    color = colorAccessor->second;
                 }
-                if (colorAccessor->second == NodeColor::WHITE) {
-                    if (!dfsVisit(successor, colors, order, adjList)) {
-                        return false;
-                    }
+            }
+            if (color == NodeColor::GRAY) {
+                return false;  // Back edge found - cycle detected
+            }
+            if (color == NodeColor::WHITE) {
+                if (!dfsVisit(successor, colors, order, adjList)) {
+                    return false;
                 }
             }
         }
@@ -399,6 +508,7 @@ bool DAGBuilder::topologicalSort(DAGInstance* dag) noexcept {
     for (const auto* node : dag->getNodes()) {
         tbb::concurrent_hash_map<NodeId, NodeColor, NodeIdHashCompare>::accessor accessor;
         if (colors.find(accessor, node->nodeId) && accessor->second == NodeColor::WHITE) {
+            accessor.release();
             if (!dfsVisit(node->nodeId, colors, order, adjList)) {
                 return false;  // Cycle detected
             }
@@ -6,6 +6,7 @@
 //   - Core_DAGTypes.h (DAGId, NodeId, ProcessingUnitType)
 //   - Core_DAGNode.h (DAGNode, DAGNodePool)
 //   - Core_MessageTypes.h (Message)
+//   - Core_DAGTemplate.h (DAGTemplate)
 // ORIGIN: NEW - Builds and validates DAG topology
 //
 // PSYCHOTIC PRECISION: ZERO-ALLOCATION DAG CONSTRUCTION
@@ -19,6 +20,7 @@
 #include "Core_DAGTypes.h"
 #include "Core_DAGNode.h"
 #include "Core_MessageTypes.h"
+#include "Core_DAGTemplate.h"
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/concurrent_vector.h>
 
@@ -207,6 +209,7 @@ private:
         AtomicU64 nodesAllocated;
         AtomicU64 edgesCreated;
         AtomicU64 validationsFailed;
+        AtomicU64 templatesBuilt;
     } stats;
     
     // Cycle detection colors for DFS
@@ -226,6 +229,10 @@ public:
     // Build DAG from topology
     DAGInstance* buildDAG(const DAGTopology& topology) noexcept;
     
+    // Compile topology into a template shared by many sessions.
+    // Fails if a node type has no batched kernel.
+    DAGTemplate* buildTemplate(const DAGTopology& topology) noexcept;
+    
     // Validate topology
     ValidationResult validateTopology(const DAGTopology& topology) noexcept;
     
@@ -240,6 +247,7 @@ public:
     u64 getNodesAllocated() const noexcept { return stats.nodesAllocated.load(); }
     u64 getEdgesCreated() const noexcept { return stats.edgesCreated.load(); }
     u64 getValidationsFailed() const noexcept { return stats.validationsFailed.load(); }
+    u64 getTemplatesBuilt() const noexcept { return stats.templatesBuilt.load(); }
     
 private:
     // Helper methods
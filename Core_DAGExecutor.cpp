@@ -7,9 +7,14 @@
 //===----------------------------------------------------------------------===//
 
 #include "Core_DAGExecutor.h"
+#include "Core_Atomic.h"
+#include "Core_Trace.h"
 #include <thread>
+#include <algorithm>
+#include <chrono>
 #include <immintrin.h>  // For _mm_pause()
 #include <cstring>      // For std::strcpy
+#include <new>          // For std::nothrow
 
 // PSYCHOTIC: Define UNREFERENCED_PARAMETER for non-Windows platforms
 #ifndef UNREFERENCED_PARAMETER
@@ -27,6 +32,288 @@ DAGExecutor& getGlobalDAGExecutor() noexcept {
     return g_globalExecutor;
 }
 
+// ============================================================================
+// EXECUTION CONTEXT POOL
+// ============================================================================
+// PSYCHOTIC: Contexts are freed from EBR retire rings, which can outlive
+// any executor - so the pool is process-wide and never torn down
+
+static constexpr u32 EXECUTION_CONTEXT_POOL_SIZE = 4096;  // Executions in flight
+
+static ObjectPool<ExecutionContext>& getContextPool() noexcept {
+    static ObjectPool<ExecutionContext>* pool = []() noexcept {
+        ObjectPool<ExecutionContext>* contexts = new ObjectPool<ExecutionContext>();
+        contexts->initialize(EXECUTION_CONTEXT_POOL_SIZE);
+        return contexts;
+    }();
+    return *pool;
+}
+
+// Pool overflow falls back to the heap - free each the way it was made
+static void reclaimContext(void* object, void* pool) noexcept {
+    ObjectPool<ExecutionContext>* contexts = static_cast<ObjectPool<ExecutionContext>*>(pool);
+    ExecutionContext* context = static_cast<ExecutionContext*>(object);
+    if (contexts->owns(context)) {
+        contexts->destroy(context);
+    } else {
+        delete context;
+    }
+}
+
+// ============================================================================
+// EXECUTION COMPLETIONS
+// ============================================================================
+// Reference counted - the executor holds one until it signals, each handle
+// one more. Same process-wide pool shape as the contexts.
+
+static constexpr u32 EXECUTION_COMPLETION_POOL_SIZE = 4096;
+static constexpr u32 COMPLETION_SPIN_ITERATIONS = 2048;   // ~tens of us before sleeping
+
+// continuationState values
+static constexpr u32 CONTINUATION_EMPTY = 0;
+static constexpr u32 CONTINUATION_ARMING = 1;   // then() is writing the callback
+static constexpr u32 CONTINUATION_ARMED = 2;
+static constexpr u32 CONTINUATION_FIRED = 3;    // Execution finished
+
+static ObjectPool<ExecutionCompletion>& getCompletionPool() noexcept {
+    static ObjectPool<ExecutionCompletion>* pool = []() noexcept {
+        ObjectPool<ExecutionCompletion>* completions = new ObjectPool<ExecutionCompletion>();
+        completions->initialize(EXECUTION_COMPLETION_POOL_SIZE);
+        return completions;
+    }();
+    return *pool;
+}
+
+static ExecutionCompletion* createCompletion(u32 references) noexcept {
+    ExecutionCompletion* completion = getCompletionPool().create();
+    if (!completion) {
+        completion = new(std::nothrow) ExecutionCompletion();
+        if (!completion) {
+            return nullptr;
+        }
+    }
+    completion->references.store(references, std::memory_order_relaxed);
+    return completion;
+}
+
+static void releaseCompletion(ExecutionCompletion* completion) noexcept {
+    if (completion->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    
+    ObjectPool<ExecutionCompletion>& pool = getCompletionPool();
+    if (pool.owns(completion)) {
+        pool.destroy(completion);
+    } else {
+        delete completion;
+    }
+}
+
+// Publish the result, wake sleepers, fire the continuation. The caller
+// still holds its reference, so nothing here can free the completion.
+static void signalCompletion(ExecutionCompletion* completion, ExecutionStatus status) noexcept {
+    // seq_cst pairs with the waiter's sleepers increment: either it sees the
+    // status or we see it registered (and the kernel rechecks the word)
+    completion->status.store(static_cast<u32>(status), std::memory_order_seq_cst);
+    if (completion->sleepers.load(std::memory_order_seq_cst) != 0) {
+        WakeAllOnWord(completion->status);
+    }
+    
+    // An arming then() sees FIRED when it tries to arm and runs it itself
+    if (completion->continuationState.exchange(CONTINUATION_FIRED, std::memory_order_acq_rel) ==
+        CONTINUATION_ARMED) {
+        completion->references.fetch_add(1, std::memory_order_relaxed);
+        ExecutionHandle handle(completion);
+        completion->continuation(handle, completion->continuationData);
+    }
+}
+
+// ============================================================================
+// EXECUTION HANDLE
+// ============================================================================
+
+ExecutionHandle::ExecutionHandle(const ExecutionHandle& other) noexcept
+    : completion(other.completion) {
+    if (completion) {
+        completion->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+ExecutionHandle& ExecutionHandle::operator=(const ExecutionHandle& other) noexcept {
+    if (this != &other) {
+        ExecutionHandle copy(other);
+        *this = static_cast<ExecutionHandle&&>(copy);
+    }
+    return *this;
+}
+
+ExecutionHandle& ExecutionHandle::operator=(ExecutionHandle&& other) noexcept {
+    if (this != &other) {
+        if (completion) {
+            releaseCompletion(completion);
+        }
+        completion = other.completion;
+        other.completion = nullptr;
+    }
+    return *this;
+}
+
+ExecutionHandle::~ExecutionHandle() noexcept {
+    if (completion) {
+        releaseCompletion(completion);
+    }
+}
+
+ExecutionStatus ExecutionHandle::getStatus() const noexcept {
+    if (!completion) {
+        return ExecutionStatus::CANCELLED;
+    }
+    return static_cast<ExecutionStatus>(completion->status.load(std::memory_order_acquire));
+}
+
+bool ExecutionHandle::wait(u64 timeoutNs) const noexcept {
+    if (!completion) {
+        return false;
+    }
+    
+    // Most executions finish within a few microseconds - spin first
+    for (u32 i = 0; i < COMPLETION_SPIN_ITERATIONS; ++i) {
+        if (isReady()) {
+            return true;
+        }
+        _mm_pause();
+    }
+    
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeoutNs);
+    const u32 pending = static_cast<u32>(ExecutionStatus::PENDING);
+    
+    completion->sleepers.fetch_add(1, std::memory_order_seq_cst);
+    while (completion->status.load(std::memory_order_seq_cst) == pending) {
+        u64 remainingNs = 0;
+        if (timeoutNs > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                break;
+            }
+            remainingNs = static_cast<u64>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count());
+        }
+        WaitOnWord(completion->status, pending, remainingNs);
+    }
+    completion->sleepers.fetch_sub(1, std::memory_order_relaxed);
+    
+    return isReady();
+}
+
+bool ExecutionHandle::getResult(ExecutionResult& result) const noexcept {
+    ExecutionStatus status = getStatus();
+    if (!completion || status == ExecutionStatus::PENDING) {
+        return false;
+    }
+    
+    result.success = (status == ExecutionStatus::COMPLETED);
+    result.nodesExecuted = completion->nodesCompleted;
+    result.nodesFailed = completion->nodesFailed;
+    result.totalDuration = completion->durationCycles;
+    if (status == ExecutionStatus::CANCELLED) {
+        std::strcpy(result.errorMessage, "Execution cancelled or timed out");
+    }
+    return true;
+}
+
+bool ExecutionHandle::then(ExecutionContinuation continuation, void* userData) const noexcept {
+    if (!completion || !continuation) {
+        return false;
+    }
+    
+    u32 expected = CONTINUATION_EMPTY;
+    if (!completion->continuationState.compare_exchange_strong(expected, CONTINUATION_ARMING,
+                                                               std::memory_order_acquire)) {
+        if (expected != CONTINUATION_FIRED) {
+            return false;  // Another continuation already attached
+        }
+        continuation(*this, userData);
+        return true;
+    }
+    
+    completion->continuation = continuation;
+    completion->continuationData = userData;
+    
+    expected = CONTINUATION_ARMING;
+    if (!completion->continuationState.compare_exchange_strong(expected, CONTINUATION_ARMED,
+                                                               std::memory_order_release)) {
+        // Finished while we were arming - signalCompletion left it to us
+        continuation(*this, userData);
+    }
+    return true;
+}
+
+// ============================================================================
+// ASYNC NODE FRAMES AND AWAITABLES
+// ============================================================================
+
+// Origin: Executor-side state of one running async node - the body's
+// context, its coroutine and the timer it sleeps on
+struct AsyncNodeFrame {
+    AsyncNodeContext node;
+    NodeTask::Handle coroutine;
+    DAGExecutor* executor;
+    ExecutionPriority priority;     // Queue it resumes on
+    TimerNode timer;                // Armed while in AsyncSleep
+    
+    AsyncNodeFrame() noexcept 
+        : node()
+        , coroutine()
+        , executor(nullptr)
+        , priority(ExecutionPriority::NORMAL)
+        , timer() {}
+};
+
+void NodeTask::FinalAwaiter::await_suspend(Handle coroutine) const noexcept {
+    // Destroys the coroutine - nothing may touch it after this
+    AsyncNodeFrame* frame = coroutine.promise().frame;
+    frame->executor->finishAsyncNode(frame);
+}
+
+void NodeTask::promise_type::unhandled_exception() const noexcept {
+    frame->node.errorCode = ASYNC_NODE_ERROR_EXCEPTION;
+}
+
+void AsyncSleep::await_suspend(NodeTask::Handle coroutine) const noexcept {
+    AsyncNodeFrame* frame = coroutine.promise().frame;
+    frame->executor->sleepAsyncNode(frame, durationNs);
+}
+
+static void resumeAfterExecution(const ExecutionHandle& handle, void* userData) noexcept {
+    UNREFERENCED_PARAMETER(handle);
+    
+    AsyncNodeFrame* frame = static_cast<AsyncNodeFrame*>(userData);
+    frame->executor->resumeAsyncNode(frame);
+}
+
+bool ExecutionAwaiter::await_suspend(NodeTask::Handle coroutine) const noexcept {
+    // Slot already taken - carry on without suspending, await_resume says PENDING
+    return handle.then(resumeAfterExecution, coroutine.promise().frame);
+}
+
+void AsyncNodeEvent::signal(u64 value) noexcept {
+    result = value;
+    uptr previous = state.exchange(EVENT_SIGNALLED, std::memory_order_acq_rel);
+    if (previous != EVENT_EMPTY && previous != EVENT_SIGNALLED) {
+        AsyncNodeFrame* frame = reinterpret_cast<AsyncNodeFrame*>(previous);
+        frame->executor->resumeAsyncNode(frame);
+    }
+}
+
+bool AsyncNodeEvent::Awaiter::await_suspend(NodeTask::Handle coroutine) const noexcept {
+    // Losing to signal() means the result is already there - do not suspend
+    uptr expected = EVENT_EMPTY;
+    return event.state.compare_exchange_strong(expected,
+                                               reinterpret_cast<uptr>(coroutine.promise().frame),
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire);
+}
+
 // ============================================================================
 // DAG EXECUTOR IMPLEMENTATION
 // ============================================================================
@@ -34,6 +321,12 @@ DAGExecutor& getGlobalDAGExecutor() noexcept {
 // Constructor
 DAGExecutor::DAGExecutor() noexcept 
     : queues{}
+    , pendingExecutions()
+    , asyncBodies{}
+    , asyncBodyCount(0)
+    , sleepWheel()
+    , sleepLock()
+    , sleepingNodes(0)
     , activeExecutions()
     , executionRecords()
     , workers()
@@ -42,6 +335,7 @@ DAGExecutor::DAGExecutor() noexcept
     , totalExecutions(0)
     , failedExecutions(0)
     , broker(nullptr) {
+    sleepWheel.initialize(getRDTSC(), ASYNC_SLEEP_TICK_SHIFT);
 }
 
 // Destructor
@@ -49,6 +343,9 @@ DAGExecutor::~DAGExecutor() noexcept {
     shutdown();
     
     // Clean up execution records
+    for (auto it = executionRecords.begin(); it != executionRecords.end(); ++it) {
+        delete it->second;
+    }
     executionRecords.clear();
 }
 
@@ -63,33 +360,99 @@ bool DAGExecutor::initialize(MessageBroker* msgBroker) noexcept {
     return true;
 }
 
+// Initialize executor without workers
+bool DAGExecutor::initializeInline(MessageBroker* msgBroker) noexcept {
+    broker = msgBroker ? msgBroker : &getGlobalMessageBroker();
+    running.store(true, std::memory_order_release);
+    return true;
+}
+
+void DAGExecutor::prewarmPools() noexcept {
+    getContextPool().prefault();
+    getCompletionPool().prefault();
+}
+
 // Shutdown executor
 void DAGExecutor::shutdown() noexcept {
     running.store(false, std::memory_order_release);
     stopWorkers();
     
-    // Clear all queues
+    // Async runs no worker picked up still owe their waiters a completion
+    PendingExecution pending;
+    while (pendingExecutions.try_pop(pending)) {
+        pending.context->cancelled.store(true, std::memory_order_release);
+        releaseExecution(pending.context);
+    }
+    
+    // Clear all queues - every entry gives back the reference it holds
     for (u32 i = 0; i < 5; ++i) {
         ExecutionQueueEntry entry;
         while (queues[i].try_pop(entry)) {
-            // Drain queue
+            entry.context->cancelled.store(true, std::memory_order_release);
+            
+            // A suspended async node never resumes - its frame held the reference
+            if (entry.frame) {
+                entry.frame->coroutine.destroy();
+                delete entry.frame;
+            }
+            releaseExecution(entry.context);
         }
     }
-    
+
+    // Sleeping async nodes likewise - anything sleeping past the execution
+    // timeout would have been cancelled on waking
+    sleepLock.lock();
+    sleepWheel.advance(getRDTSC() + EXECUTION_TIMEOUT_CYCLES);
+    while (TimerNode* timer = sleepWheel.popExpired()) {
+        AsyncNodeFrame* frame = static_cast<AsyncNodeFrame*>(timer->context);
+        ExecutionContext* context = frame->node.context;
+        context->cancelled.store(true, std::memory_order_release);
+        frame->coroutine.destroy();
+        delete frame;
+        releaseExecution(context);
+    }
+    sleepingNodes.store(0, std::memory_order_relaxed);
+    sleepLock.unlock();
+
     // Clear active executions
     activeExecutions.clear();
 }
 
 // Execute DAG synchronously
 u64 DAGExecutor::executeDag(DAGInstance* dag, const ExecutionContext& context) noexcept {
-    if (!dag || dag->getState() != DAGState::READY) {
+    ExecutionContext* execContext = beginExecution(dag, context, false);
+    if (!execContext) {
         return 0;
     }
     
+    return runExecution(dag, execContext);
+}
+
+// Internal: Create and register an execution - waitForExecution can find it
+// from here on, even before a worker picks it up
+ExecutionContext* DAGExecutor::beginExecution(DAGInstance* dag, const ExecutionContext& context,
+                                              bool withHandle) noexcept {
+    if (!dag || dag->getState() != DAGState::READY) {
+        return nullptr;
+    }
+    
+    ExecutionCompletion* completion = createCompletion(withHandle ? 2 : 1);
+    if (!completion) {
+        return nullptr;
+    }
+    
     // Create execution context
-    ExecutionContext* execContext = new ExecutionContext(context);
+    ExecutionContext* execContext = getContextPool().create(context);
+    if (!execContext) {
+        execContext = new ExecutionContext(context);
+    }
+    execContext->dagId = dag->getId();
     execContext->executionId = nextExecutionId.fetch_add(1, std::memory_order_relaxed);
     execContext->startTimestamp = getRDTSC();
+    execContext->completion = completion;
+    execContext->dag = dag;
+    execContext->references.store(1, std::memory_order_relaxed);  // The runner's
+    completion->executionId = execContext->executionId;
     
     // Store active execution
     {
@@ -99,14 +462,19 @@ u64 DAGExecutor::executeDag(DAGInstance* dag, const ExecutionContext& context) n
         }
     }
     
-    // Create execution records for nodes
-    auto* nodeRecords = new tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>();
-    {
-        tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::accessor accessor;
-        if (executionRecords.insert(accessor, dag->getId())) {
-            accessor->second = nodeRecords;
-        }
-    }
+    return execContext;
+}
+
+// Internal: Run a registered execution to completion and finalize it
+u64 DAGExecutor::runExecution(DAGInstance* dag, ExecutionContext* execContext) noexcept {
+    AARENDOCORE_TRACE_SCOPE(EXECUTOR, EXECUTOR_EXECUTE_DAG, dag->getId().value, execContext->executionId);
+    
+    // Timeout counts from here, not from when the run was queued
+    execContext->startTimestamp = getRDTSC();
+    
+    // Create execution records for nodes - owned by this run's context
+    NodeRecordMap* nodeRecords = new NodeRecordMap();
+    execContext->records = nodeRecords;
     
     // Initialize node records and find entry nodes
     const auto& nodes = dag->getNodes();
@@ -119,14 +487,17 @@ u64 DAGExecutor::executeDag(DAGInstance* dag, const ExecutionContext& context) n
         record.state = NodeExecutionState::PENDING;
         record.pendingDependencies.store(node->inDegree.load(), std::memory_order_relaxed);
         
-        tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>::accessor accessor;
-        if (nodeRecords->insert(accessor, node->nodeId)) {
-            // Manual copy because NodeExecutionRecord has atomic members
-            accessor->second.nodeId = record.nodeId;
-            accessor->second.state = record.state;
-            accessor->second.stats = record.stats;
-            accessor->second.pendingDependencies.store(record.pendingDependencies.load());
-            accessor->second.lastOutput = record.lastOutput;
+        {
+            // Released before scheduleNode, which locks the same record
+            NodeRecordMap::accessor accessor;
+            if (nodeRecords->insert(accessor, node->nodeId)) {
+                // Manual copy because NodeExecutionRecord has atomic members
+                accessor->second.nodeId = record.nodeId;
+                accessor->second.state = record.state;
+                accessor->second.stats = record.stats;
+                accessor->second.pendingDependencies.store(record.pendingDependencies.load());
+                accessor->second.lastOutput = record.lastOutput;
+            }
         }
         
         // Schedule entry nodes (no dependencies)
@@ -148,8 +519,8 @@ u64 DAGExecutor::executeDag(DAGInstance* dag, const ExecutionContext& context) n
             break;
         }
         
-        // Process work
-        bool foundWork = false;
+        // Process work - async nodes whose sleep is over first
+        bool foundWork = processSleepingNodes() > 0;
         for (u32 priority = 0; priority < 5; ++priority) {
             if (processQueue(priority)) {
                 foundWork = true;
@@ -162,9 +533,6 @@ u64 DAGExecutor::executeDag(DAGInstance* dag, const ExecutionContext& context) n
         }
     }
     
-    // Finalize execution
-    finalizeExecution(execContext, dag);
-    
     u64 executionId = execContext->executionId;
     
     // Update statistics
@@ -173,55 +541,154 @@ u64 DAGExecutor::executeDag(DAGInstance* dag, const ExecutionContext& context) n
     }
     totalExecutions.fetch_add(1, std::memory_order_relaxed);
     
+    // Drop the runner's reference - queued entries and suspended async
+    // nodes hold their own, and the last one out finalizes. The context is
+    // not ours to read after this.
+    releaseExecution(execContext);
+    
     return executionId;
 }
 
+// Execute a batch of sessions through a shared template
+u32 DAGExecutor::executeTemplateBatch(const DAGTemplate& dagTemplate, SessionData* const* sessions,
+                                      const TickMessage* ticks, u32 count) noexcept {
+    if (!sessions || !ticks) {
+        return 0;
+    }
+    
+    AARENDOCORE_TRACE_SCOPE(EXECUTOR, EXECUTOR_TEMPLATE_BATCH, dagTemplate.getId().value, count);
+    
+    const u32 nodeCount = dagTemplate.getNodeCount();
+    u32 executed = 0;
+    
+    // Destroy and hibernate hand arena memory back through EBR - the
+    // resolved states stay readable for the whole call
+    EpochGuard guard;
+    
+    // Pointer tables for one sweep - the kernels never see the template
+    DAGSessionState* batch[DAG_TEMPLATE_BATCH];
+    const f64* inputs[DAG_TEMPLATE_BATCH];
+    f64* outputs[DAG_TEMPLATE_BATCH];
+    const u8* nodeStates[DAG_TEMPLATE_BATCH];
+    const TickMessage* batchTicks[DAG_TEMPLATE_BATCH];
+    
+    for (u32 base = 0; base < count; base += DAG_TEMPLATE_BATCH) {
+        u32 end = std::min(count, base + DAG_TEMPLATE_BATCH);
+        
+        // Resolve per batch - an arena moves when its session hibernates
+        u32 batchSize = 0;
+        for (u32 i = base; i < end; ++i) {
+            SessionData* session = sessions[i];
+            DAGSessionState* state = (session && session->isActive())
+                ? dagTemplate.resolveState(*session) : nullptr;
+            if (state) {
+                batch[batchSize] = state;
+                batchTicks[batchSize] = &ticks[i];
+                ++batchSize;
+            }
+        }
+        
+        if (batchSize == 0) {
+            continue;
+        }
+        
+        // Node-major: one kernel sweeps the whole batch before the next runs
+        for (u32 n = 0; n < nodeCount; ++n) {
+            const DAGTemplate::CompiledNode& node = dagTemplate.getNode(n);
+            
+            for (u32 i = 0; i < batchSize; ++i) {
+                inputs[i] = (node.input == DAG_TEMPLATE_NO_INPUT)
+                    ? &batchTicks[i]->price
+                    : dagTemplate.slot(batch[i], node.input);
+                outputs[i] = dagTemplate.slot(batch[i], n);
+                nodeStates[i] = batch[i]->nodeStates() + n;
+            }
+            
+            node.kernel(inputs, outputs, nodeStates, batchSize);
+            
+            for (u32 i = 0; i < batchSize; ++i) {
+                batch[i]->nodeStates()[n] = static_cast<u8>(NodeState::COMPLETED);
+            }
+            dagTemplate.recordNodeExecutions(n, batchSize);
+        }
+        
+        u64 now = __rdtsc();
+        for (u32 i = 0; i < batchSize; ++i) {
+            batch[i]->executions++;
+            batch[i]->lastExecutionTime = now;
+        }
+        
+        executed += batchSize;
+    }
+    
+    totalExecutions.fetch_add(executed, std::memory_order_relaxed);
+    return executed;
+}
+
 // Execute single node
 bool DAGExecutor::executeNode(DAGNode* node, ExecutionContext* context) noexcept {
     if (!node || !context) {
         return false;
     }
     
-    // Get execution record
-    tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::const_accessor dagAccessor;
-    if (!executionRecords.find(dagAccessor, context->dagId)) {
-        return false;
+    AsyncNodeBody asyncBody = findAsyncNodeBody(node->nodeType);
+    u32 errorCode = 0;
+    {
+        // Get execution record
+        NodeRecordMap* nodeRecords = context->records;
+        if (!nodeRecords) {
+            return false;
+        }
+        
+        NodeRecordMap::accessor nodeAccessor;
+        if (!nodeRecords->find(nodeAccessor, node->nodeId)) {
+            return false;
+        }
+        
+        NodeExecutionRecord& record = nodeAccessor->second;
+        
+        // Check if ready
+        if (record.state != NodeExecutionState::READY) {
+            return false;
+        }
+        
+        // Mark as executing
+        record.state = NodeExecutionState::EXECUTING;
+        record.stats.startTime = getRDTSC();
+        
+        if (!asyncBody) {
+            // Execute node logic
+            executeNodeInternal(node, record, context);
+            
+            // Update timing
+            record.stats.endTime = getRDTSC();
+            
+            // Mark complete or failed - a failure is counted by
+            // handleNodeFailure once no retry is left
+            errorCode = record.stats.errorCode;
+            if (errorCode == 0) {
+                record.state = NodeExecutionState::COMPLETED;
+                context->nodesCompleted.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                record.state = NodeExecutionState::FAILED;
+            }
+        }
     }
     
-    auto* nodeRecords = dagAccessor->second;
-    tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>::accessor nodeAccessor;
-    if (!nodeRecords->find(nodeAccessor, node->nodeId)) {
-        return false;
+    // Coroutine bodies run outside the record lock and are completed by
+    // finishAsyncNode on whichever worker resumes them last
+    if (asyncBody) {
+        return startAsyncNode(node, context, asyncBody);
     }
     
-    NodeExecutionRecord& record = nodeAccessor->second;
-    
-    // Check if ready
-    if (record.state != NodeExecutionState::READY) {
+    // Record lock released - both of these lock records again
+    if (errorCode != 0) {
+        handleNodeFailure(node->nodeId, context, errorCode);
         return false;
     }
     
-    // Mark as executing
-    record.state = NodeExecutionState::EXECUTING;
-    record.stats.startTime = getRDTSC();
-    
-    // Execute node logic
-    executeNodeInternal(node, record, context);
-    
-    // Update timing
-    record.stats.endTime = getRDTSC();
-    
-    // Mark complete or failed
-    if (record.stats.errorCode == 0) {
-        record.state = NodeExecutionState::COMPLETED;
-        context->nodesCompleted.fetch_add(1, std::memory_order_relaxed);
-    } else {
-        record.state = NodeExecutionState::FAILED;
-        context->nodesFailed.fetch_add(1, std::memory_order_relaxed);
-        handleNodeFailure(node->nodeId, context, record.stats.errorCode);
-    }
-    
-    return record.state == NodeExecutionState::COMPLETED;
+    updateDependencies(node->nodeId, context->dag, context);
+    return true;
 }
 
 // Cancel execution
@@ -233,57 +700,74 @@ void DAGExecutor::cancelExecution(u64 executionId) noexcept {
 }
 
 // Execute DAG asynchronously
-u64 DAGExecutor::executeDagAsync(DAGInstance* dag, const ExecutionContext& context) noexcept {
-    if (!dag) return 0;
+ExecutionHandle DAGExecutor::executeDagAsync(DAGInstance* dag, const ExecutionContext& context) noexcept {
+    // Registered before launch, so the id is waitable the moment we return
+    ExecutionContext* execContext = beginExecution(dag, context, true);
+    if (!execContext) {
+        return ExecutionHandle();
+    }
     
-    u64 executionId = nextExecutionId.fetch_add(1, std::memory_order_relaxed);
+    ExecutionHandle handle(execContext->completion);
     
-    // Launch async execution
-    workers.run([this, dag, context, executionId]() {
-        ExecutionContext mutableContext = context;
-        mutableContext.executionId = executionId;
-        this->executeDag(dag, mutableContext);
-    });
+    // No workers to hand it to - run it here, the handle comes back ready
+    if (!running.load(std::memory_order_acquire)) {
+        runExecution(dag, execContext);
+        return handle;
+    }
     
-    return executionId;
+    pendingExecutions.push(PendingExecution{dag, execContext});
+    return handle;
 }
 
-// Wait for execution
-bool DAGExecutor::waitForExecution(u64 executionId, u64 timeoutCycles) noexcept {
-    u64 startTime = getRDTSC();
+// Internal: Start one queued async execution on the calling thread
+bool DAGExecutor::runPendingExecution() noexcept {
+    PendingExecution pending;
+    if (!pendingExecutions.try_pop(pending)) {
+        return false;
+    }
     
-    while (true) {
+    runExecution(pending.dag, pending.context);
+    return true;
+}
+
+// Wait for execution - one map lookup for the completion, then sleep on it
+bool DAGExecutor::waitForExecution(u64 executionId, u64 timeoutCycles) noexcept {
+    ExecutionHandle handle;
+    {
         tbb::concurrent_hash_map<u64, ExecutionContext*, DAGExecutor::U64HashCompare>::const_accessor accessor;
         if (!activeExecutions.find(accessor, executionId)) {
             // Execution completed
             return true;
         }
         
-        if (timeoutCycles > 0) {
-            u64 elapsed = getRDTSC() - startTime;
-            if (elapsed > timeoutCycles) {
-                return false;  // Timeout
-            }
-        }
-        
-        _mm_pause();
+        // finalizeExecution erases the entry before dropping the executor's
+        // reference, so the completion is alive while we hold the accessor
+        ExecutionCompletion* completion = accessor->second->completion;
+        completion->references.fetch_add(1, std::memory_order_relaxed);
+        handle = ExecutionHandle(completion);
+    }
+    
+    u64 timeoutNs = 0;
+    if (timeoutCycles > 0) {
+        timeoutNs = std::max<u64>(1, timeoutCycles / NOMINAL_CYCLES_PER_NS);
     }
+    return handle.wait(timeoutNs);
 }
 
 // Get execution result
 bool DAGExecutor::getExecutionResult(u64 executionId, ExecutionResult& result) noexcept {
-    // Check if execution exists in records
-    tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::const_accessor dagAccessor;
-    
     // Find the DAG associated with this execution
     bool found = false;
     DAGId targetDagId = INVALID_DAG_ID;
+    NodeRecordMap* nodeRecords = nullptr;
     
-    // Search through execution contexts to find the DAG
+    // Search through execution contexts to find the DAG - finalizeExecution
+    // erases the entry before the records move, so the accessor keeps them
     tbb::concurrent_hash_map<u64, ExecutionContext*, DAGExecutor::U64HashCompare>::const_accessor ctxAccessor;
     if (activeExecutions.find(ctxAccessor, executionId)) {
         ExecutionContext* ctx = ctxAccessor->second;
         targetDagId = ctx->dagId;
+        nodeRecords = ctx->records;
         
         // Fill result from context
         result.success = (ctx->nodesFailed.load() == 0);
@@ -301,9 +785,7 @@ bool DAGExecutor::getExecutionResult(u64 executionId, ExecutionResult& result) n
     }
     
     // Get detailed stats from execution records
-    if (executionRecords.find(dagAccessor, targetDagId)) {
-        auto* nodeRecords = dagAccessor->second;
-        
+    if (nodeRecords) {
         // Aggregate stats from all nodes
         result.totalMessages = 0;
         result.totalBytes = 0;
@@ -324,15 +806,16 @@ bool DAGExecutor::scheduleNode(NodeId nodeId, ExecutionContext* context, Executi
     }
     
     // Update node state to READY
-    tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::const_accessor dagAccessor;
-    if (executionRecords.find(dagAccessor, context->dagId)) {
-        auto* nodeRecords = dagAccessor->second;
-        tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>::accessor nodeAccessor;
+    if (NodeRecordMap* nodeRecords = context->records) {
+        NodeRecordMap::accessor nodeAccessor;
         if (nodeRecords->find(nodeAccessor, nodeId)) {
             nodeAccessor->second.state = NodeExecutionState::READY;
         }
     }
     
+    // The entry keeps the execution open until a worker has popped it
+    context->references.fetch_add(1, std::memory_order_relaxed);
+    
     // Add to appropriate queue
     ExecutionQueueEntry entry(nodeId, context, priority);
     u32 queueIndex = static_cast<u32>(priority);
@@ -343,6 +826,12 @@ bool DAGExecutor::scheduleNode(NodeId nodeId, ExecutionContext* context, Executi
 
 // Process all queues
 void DAGExecutor::processQueues() noexcept {
+    while (runPendingExecution()) {
+        // Start queued async executions first
+    }
+    
+    processSleepingNodes();
+    
     for (u32 priority = 0; priority < 5; ++priority) {
         while (processQueue(priority)) {
             // Keep processing
@@ -354,15 +843,32 @@ void DAGExecutor::processQueues() noexcept {
 bool DAGExecutor::processQueue(u32 priorityLevel) noexcept {
     if (priorityLevel >= 5) return false;
     
+    // Entries carry raw context pointers that finalizeExecution retires -
+    // stay in the epoch for as long as the entry is being worked on
+    EpochGuard guard;
+    
     ExecutionQueueEntry entry;
     if (!queues[priorityLevel].try_pop(entry)) {
         return false;
     }
     
-    // Find the node in DAG
-    // PSYCHOTIC TODO: Need to get DAGInstance from context
-    // For now, return true to indicate work was found
+    // A suspended async node whose wait is over - carry on where it left off
+    if (entry.frame) {
+        AARENDOCORE_TRACE_SCOPE(EXECUTOR, EXECUTOR_NODE, entry.nodeId.value, entry.context->executionId);
+        entry.frame->coroutine.resume();
+        return true;
+    }
+    
+    // Entries of a cancelled execution only give back their reference
+    ExecutionContext* context = entry.context;
+    if (context->dag && !context->cancelled.load(std::memory_order_acquire)) {
+        DAGNode* node = context->dag->getNode(entry.nodeId);
+        if (node) {
+            executeNode(node, context);
+        }
+    }
     
+    releaseExecution(context);
     return true;
 }
 
@@ -387,19 +893,19 @@ bool DAGExecutor::updateDependencies(NodeId completedNode, DAGInstance* dag, Exe
         
         if (hasInput) {
             // Decrement pending dependencies
-            tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::const_accessor dagAccessor;
-            if (executionRecords.find(dagAccessor, context->dagId)) {
-                auto* nodeRecords = dagAccessor->second;
-                tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>::accessor nodeAccessor;
+            u32 pending = 0;
+            if (NodeRecordMap* nodeRecords = context->records) {
+                NodeRecordMap::accessor nodeAccessor;
                 if (nodeRecords->find(nodeAccessor, node->nodeId)) {
-                    u32 pending = nodeAccessor->second.pendingDependencies.fetch_sub(1, std::memory_order_acq_rel);
-                    
-                    // If all dependencies satisfied, schedule node
-                    if (pending == 1) {  // Was 1, now 0
-                        scheduleNode(node->nodeId, context, getNodePriority(node));
-                    }
+                    pending = nodeAccessor->second.pendingDependencies.fetch_sub(1, std::memory_order_acq_rel);
                 }
             }
+            
+            // If all dependencies satisfied, schedule node - after the
+            // record lock is released, scheduleNode takes it itself
+            if (pending == 1) {  // Was 1, now 0
+                scheduleNode(node->nodeId, context, getNodePriority(node));
+            }
         }
     }
     
@@ -460,13 +966,13 @@ bool DAGExecutor::sendToDownstream(NodeId sourceNode, NodeId targetNode, const M
 
 // Get node statistics
 bool DAGExecutor::getNodeStats(DAGId dagId, NodeId nodeId, NodeExecutionStats& stats) noexcept {
-    tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::const_accessor dagAccessor;
+    tbb::concurrent_hash_map<DAGId, NodeRecordMap*, DAGIdHashCompare>::const_accessor dagAccessor;
     if (!executionRecords.find(dagAccessor, dagId)) {
         return false;
     }
     
-    auto* nodeRecords = dagAccessor->second;
-    tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>::const_accessor nodeAccessor;
+    NodeRecordMap* nodeRecords = dagAccessor->second;
+    NodeRecordMap::const_accessor nodeAccessor;
     if (!nodeRecords->find(nodeAccessor, nodeId)) {
         return false;
     }
@@ -498,6 +1004,8 @@ void DAGExecutor::stopWorkers() noexcept {
 void DAGExecutor::executeNodeInternal(DAGNode* node, NodeExecutionRecord& record, ExecutionContext* context) noexcept {
     UNREFERENCED_PARAMETER(context);
     
+    AARENDOCORE_TRACE_SCOPE(EXECUTOR, EXECUTOR_NODE, node->nodeId.value, context->executionId);
+    
     // Get messages from broker if available
     Message inputMsg;
     if (broker) {
@@ -606,49 +1114,90 @@ void DAGExecutor::executeNodeInternal(DAGNode* node, NodeExecutionRecord& record
 
 // Handle node failure
 void DAGExecutor::handleNodeFailure(NodeId nodeId, ExecutionContext* context, u32 errorCode) noexcept {
-    // Get node execution record
-    tbb::concurrent_hash_map<DAGId, tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*, IdHashCompare<DAGId>>::const_accessor dagAccessor;
-    if (!executionRecords.find(dagAccessor, context->dagId)) {
-        return;
-    }
+    bool retry = false;
+    bool failed = false;
+    {
+        // Get node execution record
+        NodeRecordMap* nodeRecords = context->records;
+        if (!nodeRecords) {
+            return;
+        }
     
-    auto* nodeRecords = dagAccessor->second;
-    tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>::accessor nodeAccessor;
-    if (!nodeRecords->find(nodeAccessor, nodeId)) {
-        return;
-    }
+        NodeRecordMap::accessor nodeAccessor;
+        if (!nodeRecords->find(nodeAccessor, nodeId)) {
+            return;
+        }
     
-    NodeExecutionRecord& record = nodeAccessor->second;
+        NodeExecutionRecord& record = nodeAccessor->second;
     
-    // Check retry count
-    if (record.stats.retryCount < MAX_RETRY_COUNT) {
-        // Retry the node
-        record.stats.retryCount++;
-        record.state = NodeExecutionState::READY;
+        // Check retry count
+        if (record.stats.retryCount < MAX_RETRY_COUNT) {
+            // Retry the node - with a clean error so the next attempt can succeed
+            record.stats.retryCount++;
+            record.stats.errorCode = 0;
+            record.state = NodeExecutionState::READY;
+            retry = true;
+        } else {
+            // Max retries exceeded, mark as permanently failed - the only
+            // place a node counts as failed, whatever its attempts
+            record.state = NodeExecutionState::FAILED;
+            record.stats.errorCode = errorCode;
+            context->nodesFailed.fetch_add(1, std::memory_order_relaxed);
+            failed = true;
         
-        // Re-schedule with lower priority
-        ExecutionPriority retryPriority = ExecutionPriority::LOW;
-        scheduleNode(nodeId, context, retryPriority);
-    } else {
-        // Max retries exceeded, mark as permanently failed
-        record.state = NodeExecutionState::FAILED;
-        record.stats.errorCode = errorCode;
-        
-        // Send to dead letter queue if broker available
-        if (broker) {
-            MessageEnvelope envelope;
-            envelope.message = record.lastOutput;
-            envelope.topic = TopicId(static_cast<u32>(nodeId.value));
-            envelope.priority = MessagePriority::LOW;
-            envelope.deliveryMode = DeliveryMode::AT_MOST_ONCE;
-            envelope.retryCount = record.stats.retryCount;
+            // Send to dead letter queue if broker available
+            if (broker) {
+                MessageEnvelope envelope;
+                envelope.message = record.lastOutput;
+                envelope.topic = TopicId(static_cast<u32>(nodeId.value));
+                envelope.priority = MessagePriority::LOW;
+                envelope.deliveryMode = DeliveryMode::AT_MOST_ONCE;
+                envelope.retryCount = record.stats.retryCount;
             
-            broker->sendToDeadLetter(envelope, errorCode);
+                broker->sendToDeadLetter(envelope, errorCode);
+            }
+        
+            // Cancel execution if critical node failed
+            if (context->priority == ExecutionPriority::CRITICAL) {
+                context->cancelled.store(true, std::memory_order_release);
+            }
+        }
+    }
+    
+    // Re-schedule with lower priority - outside the record lock, which
+    // scheduleNode takes itself
+    if (retry) {
+        scheduleNode(nodeId, context, ExecutionPriority::LOW);
+    } else if (failed) {
+        failDependents(nodeId, context, errorCode);
+    }
+}
+
+// Internal: A permanently failed node's successors can never become ready -
+// fail them too, so the execution still accounts for every node
+void DAGExecutor::failDependents(NodeId failedNode, ExecutionContext* context, u32 errorCode) noexcept {
+    DAGNode* node = context->dag ? context->dag->getNode(failedNode) : nullptr;
+    if (!node) {
+        return;
+    }
+    
+    for (u32 i = 0; i < node->outDegree.load(std::memory_order_relaxed); ++i) {
+        const NodeId successor = node->successors[i];
+        bool skipped = false;
+        if (NodeRecordMap* nodeRecords = context->records) {
+            NodeRecordMap::accessor nodeAccessor;
+            if (nodeRecords->find(nodeAccessor, successor) &&
+                nodeAccessor->second.state == NodeExecutionState::PENDING) {
+                // Another failed predecessor may have got here first
+                nodeAccessor->second.state = NodeExecutionState::FAILED;
+                nodeAccessor->second.stats.errorCode = errorCode;
+                skipped = true;
+            }
         }
         
-        // Cancel execution if critical node failed
-        if (context->priority == ExecutionPriority::CRITICAL) {
-            context->cancelled.store(true, std::memory_order_release);
+        if (skipped) {
+            context->nodesFailed.fetch_add(1, std::memory_order_relaxed);
+            failDependents(successor, context, errorCode);
         }
     }
 }
@@ -658,19 +1207,226 @@ void DAGExecutor::finalizeExecution(ExecutionContext* context, DAGInstance* dag)
     UNREFERENCED_PARAMETER(dag);
     
     // Remove from active executions
-    tbb::concurrent_hash_map<u64, ExecutionContext*, DAGExecutor::U64HashCompare>::accessor accessor;
-    if (activeExecutions.find(accessor, context->executionId)) {
-        activeExecutions.erase(accessor);
+    {
+        tbb::concurrent_hash_map<u64, ExecutionContext*, DAGExecutor::U64HashCompare>::accessor accessor;
+        if (activeExecutions.find(accessor, context->executionId)) {
+            activeExecutions.erase(accessor);
+        }
+    }
+    
+    // Wake waiters and run the continuation - after the erase, so a woken
+    // waitForExecution caller never finds the execution still registered
+    ExecutionCompletion* completion = context->completion;
+    if (completion) {
+        ExecutionStatus status = ExecutionStatus::COMPLETED;
+        if (context->cancelled.load(std::memory_order_acquire)) {
+            status = ExecutionStatus::CANCELLED;
+        } else if (context->nodesFailed.load(std::memory_order_relaxed) > 0) {
+            status = ExecutionStatus::FAILED;
+        }
+        
+        completion->nodesCompleted = context->nodesCompleted.load(std::memory_order_relaxed);
+        completion->nodesFailed = context->nodesFailed.load(std::memory_order_relaxed);
+        completion->durationCycles = getRDTSC() - context->startTimestamp;
+        signalCompletion(completion, status);
+        releaseCompletion(completion);
+    }
+    
+    // Publish this run's records as the DAG's last run for getNodeStats -
+    // no node touches them once the last reference is gone
+    if (NodeRecordMap* nodeRecords = context->records) {
+        context->records = nullptr;
+        tbb::concurrent_hash_map<DAGId, NodeRecordMap*, DAGIdHashCompare>::accessor dagAccessor;
+        if (!executionRecords.insert(dagAccessor, context->dagId)) {
+            delete dagAccessor->second;
+        }
+        dagAccessor->second = nodeRecords;
+    }
+    
+    // Queued entries and workers may still hold the context - free it
+    // once every thread has left the epoch it was visible in
+    GetEpochManager().retire(context, reclaimContext, &getContextPool());
+}
+
+// Internal: Drop one reference - the last one out finalizes the execution
+void DAGExecutor::releaseExecution(ExecutionContext* context) noexcept {
+    if (context->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        finalizeExecution(context, context->dag);
+    }
+}
+
+// ============================================================================
+// ASYNC NODES
+// ============================================================================
+
+// Register an async body for a unit type - replaces an earlier registration
+bool DAGExecutor::registerAsyncNodeBody(ProcessingUnitType type, AsyncNodeBody body) noexcept {
+    if (!body) {
+        return false;
+    }
+    
+    const u32 key = static_cast<u32>(type);
+    const u32 count = std::min(asyncBodyCount.load(std::memory_order_acquire), MAX_ASYNC_NODE_TYPES);
+    for (u32 i = 0; i < count; ++i) {
+        if (asyncBodies[i].type.load(std::memory_order_acquire) == key) {
+            asyncBodies[i].body.store(body, std::memory_order_release);
+            return true;
+        }
+    }
+    
+    u32 slot = asyncBodyCount.fetch_add(1, std::memory_order_acq_rel);
+    if (slot >= MAX_ASYNC_NODE_TYPES) {
+        asyncBodyCount.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    // Type last - a reader that matches it finds the body
+    asyncBodies[slot].body.store(body, std::memory_order_relaxed);
+    asyncBodies[slot].type.store(key, std::memory_order_release);
+    return true;
+}
+
+// Internal: Body registered for a unit type, nullptr for synchronous nodes
+AsyncNodeBody DAGExecutor::findAsyncNodeBody(ProcessingUnitType type) noexcept {
+    const u32 key = static_cast<u32>(type);
+    const u32 count = std::min(asyncBodyCount.load(std::memory_order_acquire), MAX_ASYNC_NODE_TYPES);
+    for (u32 i = 0; i < count; ++i) {
+        if (asyncBodies[i].type.load(std::memory_order_acquire) == key) {
+            return asyncBodies[i].body.load(std::memory_order_acquire);
+        }
+    }
+    return nullptr;
+}
+
+// Internal: Create an async node's coroutine and run it to its first
+// suspension. The record is EXECUTING and its lock already released.
+bool DAGExecutor::startAsyncNode(DAGNode* node, ExecutionContext* context, AsyncNodeBody body) noexcept {
+    AsyncNodeFrame* frame = new(std::nothrow) AsyncNodeFrame();
+    NodeTask task;
+    if (frame) {
+        frame->node.node = node;
+        frame->node.context = context;
+        frame->executor = this;
+        frame->priority = getNodePriority(node);
+        frame->timer.context = frame;
+        
+        // Input is the first predecessor's output
+        if (node->inDegree.load(std::memory_order_relaxed) > 0) {
+            if (NodeRecordMap* nodeRecords = context->records) {
+                NodeRecordMap::const_accessor inputAccessor;
+                if (nodeRecords->find(inputAccessor, node->predecessors[0])) {
+                    frame->node.input = inputAccessor->second.lastOutput;
+                }
+            }
+        }
+        
+        task = body(frame->node);
+    }
+    
+    if (!task.valid()) {
+        delete frame;
+        Message empty;
+        return completeAsyncNode(node, context, ASYNC_NODE_ERROR_NO_FRAME, empty);
     }
     
-    // Clean up context
-    delete context;
+    frame->coroutine = task.release();
+    frame->coroutine.promise().frame = frame;
+    
+    // The frame keeps the execution open until the body has finished
+    context->references.fetch_add(1, std::memory_order_relaxed);
+    
+    AARENDOCORE_TRACE_SCOPE(EXECUTOR, EXECUTOR_NODE, node->nodeId.value, context->executionId);
+    frame->coroutine.resume();  // To the first await that is not ready - or the end
+    return true;
+}
+
+// Internal: Record an async node's outcome and release what depends on it
+bool DAGExecutor::completeAsyncNode(DAGNode* node, ExecutionContext* context, u32 errorCode,
+                                    const Message& output) noexcept {
+    if (NodeRecordMap* nodeRecords = context->records) {
+        NodeRecordMap::accessor nodeAccessor;
+        if (nodeRecords->find(nodeAccessor, node->nodeId)) {
+            NodeExecutionRecord& record = nodeAccessor->second;
+            record.stats.endTime = getRDTSC();
+            if (errorCode == 0) {
+                record.lastOutput = output;
+                record.stats.messagesProcessed++;
+                record.stats.bytesProcessed += sizeof(Message);
+                record.state = NodeExecutionState::COMPLETED;
+            } else {
+                record.stats.errorCode = errorCode;
+                record.state = NodeExecutionState::FAILED;
+            }
+        }
+    }
+    
+    if (errorCode != 0) {
+        handleNodeFailure(node->nodeId, context, errorCode);
+        return false;
+    }
+    
+    context->nodesCompleted.fetch_add(1, std::memory_order_relaxed);
+    updateDependencies(node->nodeId, context->dag, context);
+    return true;
+}
+
+// Finish an async node from its final suspension point, on whichever worker
+// resumed it last. Destroys the coroutine.
+void DAGExecutor::finishAsyncNode(AsyncNodeFrame* frame) noexcept {
+    DAGNode* node = frame->node.node;
+    ExecutionContext* context = frame->node.context;
+    
+    completeAsyncNode(node, context, frame->node.errorCode, frame->node.output);
+    
+    frame->coroutine.destroy();
+    delete frame;
+    releaseExecution(context);
+}
+
+// Put a suspended async node back on its queue - from the thread that
+// completed its wait, which never runs the node itself
+void DAGExecutor::resumeAsyncNode(AsyncNodeFrame* frame) noexcept {
+    ExecutionQueueEntry entry(frame, frame->node.node->nodeId, frame->node.context, frame->priority);
+    queues[static_cast<u32>(frame->priority)].push(entry);
+}
+
+// Park an async node in the sleep wheel
+void DAGExecutor::sleepAsyncNode(AsyncNodeFrame* frame, u64 durationNs) noexcept {
+    const u64 deadline = getRDTSC() + durationNs * NOMINAL_CYCLES_PER_NS;
+    
+    sleepLock.lock();
+    sleepWheel.schedule(&frame->timer, deadline);
+    sleepingNodes.fetch_add(1, std::memory_order_release);
+    sleepLock.unlock();
+}
+
+// Requeue every async node whose sleep is over. Cheap when none sleep; a
+// worker that finds the wheel taken leaves it to the holder.
+u32 DAGExecutor::processSleepingNodes() noexcept {
+    if (sleepingNodes.load(std::memory_order_acquire) == 0) {
+        return 0;
+    }
+    if (!sleepLock.try_lock()) {
+        return 0;
+    }
+    
+    u32 fired = 0;
+    sleepWheel.advance(getRDTSC());
+    while (TimerNode* timer = sleepWheel.popExpired()) {
+        resumeAsyncNode(static_cast<AsyncNodeFrame*>(timer->context));
+        ++fired;
+    }
+    sleepingNodes.fetch_sub(fired, std::memory_order_relaxed);
+    sleepLock.unlock();
+    
+    return fired;
 }
 
 // Worker loop
 void DAGExecutor::workerLoop() noexcept {
     while (running.load(std::memory_order_acquire)) {
-        bool foundWork = false;
+        bool foundWork = runPendingExecution();
+        foundWork |= processSleepingNodes() > 0;
         
         // Process queues by priority
         for (u32 priority = 0; priority < 5; ++priority) {
@@ -694,4 +1450,145 @@ ExecutionPriority DAGExecutor::getNodePriority(DAGNode* node) noexcept {
     return ExecutionPriority::NORMAL;
 }
 
+// ============================================================================
+// EXPORTS
+// ============================================================================
+
+static u64 steadyNowNs() noexcept {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestExecutionWakeup(u32 rounds, u64* signalNs) {
+    if (rounds == 0) {
+        rounds = 1000;  // Default 1K wakeups
+    }
+    
+    std::atomic<ExecutionCompletion*> published{nullptr};
+    std::atomic<u64> wokenAt{0};
+    std::atomic<bool> stop{false};
+    
+    // Waiter: take the next completion and sleep on it like waitForExecution
+    std::thread waiter([&]() {
+        for (u32 i = 0; i < rounds; ++i) {
+            ExecutionCompletion* completion = nullptr;
+            while (!(completion = published.load(std::memory_order_acquire))) {
+                if (stop.load(std::memory_order_acquire)) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+            published.store(nullptr, std::memory_order_relaxed);
+            
+            ExecutionHandle handle(completion);
+            handle.wait();
+            wokenAt.store(steadyNowNs(), std::memory_order_release);
+        }
+    });
+    
+    u64 totalWakeNs = 0;
+    u64 totalSignalNs = 0;
+    u32 completed = 0;
+    for (; completed < rounds; ++completed) {
+        ExecutionCompletion* completion = createCompletion(2);
+        if (!completion) {
+            break;
+        }
+        wokenAt.store(0, std::memory_order_relaxed);
+        published.store(completion, std::memory_order_release);
+        
+        // Long enough for the waiter to give up spinning and sleep
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        
+        const u64 start = steadyNowNs();
+        signalCompletion(completion, ExecutionStatus::COMPLETED);
+        const u64 signalled = steadyNowNs();
+        releaseCompletion(completion);
+        
+        u64 woken = 0;
+        while ((woken = wokenAt.load(std::memory_order_acquire)) == 0) {
+            std::this_thread::yield();
+        }
+        totalWakeNs += woken - start;
+        totalSignalNs += signalled - start;
+    }
+    stop.store(true, std::memory_order_release);
+    waiter.join();
+    
+    if (completed == 0) {
+        return 0;
+    }
+    if (signalNs) {
+        *signalNs = totalSignalNs / completed;
+    }
+    return totalWakeNs / completed;
+}
+
+// Persistence writer stand-ins for the overlap benchmark - same work, one
+// suspends for the write and one holds the worker through it
+static std::atomic<u64> g_overlapLatencyNs{0};
+
+static NodeTask suspendingPersistenceWrite(AsyncNodeContext& node) noexcept {
+    co_await AsyncSleep(g_overlapLatencyNs.load(std::memory_order_relaxed));
+    node.output = node.input;
+}
+
+static NodeTask blockingPersistenceWrite(AsyncNodeContext& node) noexcept {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(g_overlapLatencyNs.load(std::memory_order_relaxed)));
+    node.output = node.input;
+    co_return;
+}
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestAsyncNodeOverlap(u32 cpuNodes, u32 slowNodes,
+                                                               u64 latencyNs, u32 suspend) {
+    if (cpuNodes + slowNodes == 0 || cpuNodes + slowNodes > DAGTopology::MAX_NODES) {
+        cpuNodes = 64;
+        slowNodes = 8;
+    }
+    if (latencyNs == 0) {
+        latencyNs = 1000000;  // Default 1ms storage write
+    }
+    constexpr u32 ROUNDS = 10;
+    
+    // Independent nodes, writers first - nothing orders them but the worker
+    DAGTopology topology;
+    for (u32 i = 0; i < cpuNodes + slowNodes; ++i) {
+        DAGTopology::NodeDescriptor descriptor;
+        descriptor.nodeId = NodeId(i + 1);  // 0 is INVALID_NODE_ID
+        descriptor.type = (i < slowNodes) ? ProcessingUnitType::PERSISTENCE_WRITER
+                                          : ProcessingUnitType::STREAM_NORMALIZER;
+        topology.addNode(descriptor);
+    }
+    
+    DAGBuilder builder;
+    DAGInstance* dag = builder.buildDAG(topology);
+    DAGExecutor* executor = new(std::nothrow) DAGExecutor();
+    if (!dag || !executor) {
+        delete dag;
+        delete executor;
+        return 0;
+    }
+    
+    // No workers - the calling thread runs every node, like one busy core
+    g_overlapLatencyNs.store(latencyNs, std::memory_order_relaxed);
+    executor->registerAsyncNodeBody(ProcessingUnitType::PERSISTENCE_WRITER,
+                                    suspend ? suspendingPersistenceWrite : blockingPersistenceWrite);
+    
+    u64 totalNs = 0;
+    u32 completed = 0;
+    for (u32 round = 0; round < ROUNDS; ++round) {
+        ExecutionContext context;
+        const u64 start = steadyNowNs();
+        if (executor->executeDag(dag, context) == 0) {
+            break;
+        }
+        totalNs += steadyNowNs() - start;
+        ++completed;
+    }
+    
+    delete executor;
+    delete dag;
+    return completed ? totalNs / completed : 0;
+}
+
 AARENDOCORE_NAMESPACE_END
\ No newline at end of file
@@ -7,7 +7,10 @@
 //   - Core_DAGTypes.h (NodeId, DAGId, ExecutionMode)
 //   - Core_DAGNode.h (DAGNode)
 //   - Core_DAGBuilder.h (DAGInstance)
+//   - Core_DAGTemplate.h (DAGTemplate, DAGSessionState)
 //   - Core_MessageBroker.h (MessageBroker)
+//   - Core_Atomic.h (Spinlock)
+//   - Core_TimerWheel.h (TimerWheel for sleeping async nodes)
 // ORIGIN: NEW - DAG execution engine
 //
 // PSYCHOTIC PRECISION: LOCK-FREE, PARALLEL DAG EXECUTION
@@ -22,7 +25,11 @@
 #include "Core_DAGTypes.h"
 #include "Core_DAGNode.h"
 #include "Core_DAGBuilder.h"
+#include "Core_DAGTemplate.h"
 #include "Core_MessageBroker.h"
+#include "Core_Atomic.h"
+#include "Core_TimerWheel.h"
+#include <coroutine>
 #include <tbb/concurrent_queue.h>
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/parallel_for.h>
@@ -66,9 +73,18 @@ struct alignas(64) NodeExecutionStats {
         , reserved{} {}
 };
 
+struct ExecutionCompletion;
+struct AsyncNodeFrame;
+struct NodeExecutionRecord;
+
+// Node records of one execution, by node
+using NodeRecordMap = tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, NodeIdHashCompare>;
+
 // ============================================================================
 // EXECUTION CONTEXT - Session context for execution
 // ============================================================================
+// Two cache lines: the executor-owned fields (references, completion, dag,
+// records) follow the caller's and are never copied from them.
 struct alignas(64) ExecutionContext {
     DAGId dagId;              // 8 bytes
     SessionId sessionId;      // 8 bytes
@@ -79,7 +95,11 @@ struct alignas(64) ExecutionContext {
     ExecutionPriority priority; // 4 bytes
     u32 executionMode;         // 4 bytes - mode flags
     AtomicBool cancelled;      // 1 byte
-    u8 padding[15];           // Padding to 64 bytes
+    u8 padding[3];            // Padding to 52 bytes
+    AtomicU32 references;     // 4 bytes - runner, queued entries, suspended nodes
+    ExecutionCompletion* completion; // 8 bytes - signalled by finalizeExecution
+    DAGInstance* dag;         // 8 bytes - the DAG queued entries belong to
+    NodeRecordMap* records;   // 8 bytes - this run's node records
     
     ExecutionContext() noexcept 
         : dagId(INVALID_DAG_ID)
@@ -91,9 +111,14 @@ struct alignas(64) ExecutionContext {
         , priority(ExecutionPriority::NORMAL)
         , executionMode(0)  // Default mode
         , cancelled(false)
-        , padding{} {}
+        , padding{}
+        , references(0)
+        , completion(nullptr)
+        , dag(nullptr)
+        , records(nullptr) {}
         
-    // Copy constructor - needed for atomics
+    // Copy constructor - needed for atomics. The completion, references and
+    // DAG belong to the executor's own copy, so they are never carried over.
     ExecutionContext(const ExecutionContext& other) noexcept 
         : dagId(other.dagId)
         , sessionId(other.sessionId)
@@ -104,7 +129,11 @@ struct alignas(64) ExecutionContext {
         , priority(other.priority)
         , executionMode(other.executionMode)
         , cancelled(other.cancelled.load())
-        , padding{} {}
+        , padding{}
+        , references(0)
+        , completion(nullptr)
+        , dag(nullptr)
+        , records(nullptr) {}
 };
 
 // ============================================================================
@@ -133,18 +162,29 @@ struct ExecutionQueueEntry {
     ExecutionContext* context;
     ExecutionPriority priority;
     u64 scheduledTime;  // RDTSC when scheduled
+    AsyncNodeFrame* frame;  // Suspended async node to resume, nullptr to start the node
     
     ExecutionQueueEntry() noexcept 
         : nodeId(INVALID_NODE_ID)
         , context(nullptr)
         , priority(ExecutionPriority::NORMAL)
-        , scheduledTime(0) {}
+        , scheduledTime(0)
+        , frame(nullptr) {}
         
     ExecutionQueueEntry(NodeId id, ExecutionContext* ctx, ExecutionPriority prio) noexcept
         : nodeId(id)
         , context(ctx)
         , priority(prio)
-        , scheduledTime(__rdtsc()) {}
+        , scheduledTime(__rdtsc())
+        , frame(nullptr) {}
+        
+    ExecutionQueueEntry(AsyncNodeFrame* suspended, NodeId id, ExecutionContext* ctx,
+                        ExecutionPriority prio) noexcept
+        : nodeId(id)
+        , context(ctx)
+        , priority(prio)
+        , scheduledTime(__rdtsc())
+        , frame(suspended) {}
 };
 
 // ============================================================================
@@ -169,6 +209,257 @@ struct ExecutionResult {
         , errorMessage{} {}
 };
 
+// ============================================================================
+// EXECUTION COMPLETION - Signalled once when an execution finalizes
+// ============================================================================
+// Waiters spin briefly, then sleep on the status word (futex/WaitOnAddress).
+// The finalizing thread stores the status and only makes the wake syscall
+// if someone is asleep, so an unwatched execution costs two atomics.
+enum class ExecutionStatus : u32 {
+    PENDING = 0,     // Still running
+    COMPLETED = 1,   // Every node completed
+    FAILED = 2,      // At least one node failed
+    CANCELLED = 3    // Cancelled or timed out
+};
+
+class ExecutionHandle;
+
+// Runs once, on the finalizing thread (or inline in then() if the execution
+// already finished). Keep it short - chaining the next executeDagAsync is
+// the intended use.
+typedef void (*ExecutionContinuation)(const ExecutionHandle& handle, void* userData);
+
+struct alignas(64) ExecutionCompletion {
+    std::atomic<u32> status;            // ExecutionStatus - the word waiters sleep on
+    std::atomic<u32> sleepers;          // Waiters inside WaitOnWord
+    std::atomic<u32> references;        // Handles plus the executor's own
+    std::atomic<u32> continuationState; // Empty, arming, armed or fired
+    u64 executionId;
+    u64 durationCycles;                 // Written before status leaves PENDING
+    u32 nodesCompleted;
+    u32 nodesFailed;
+    ExecutionContinuation continuation;
+    void* continuationData;
+    
+    ExecutionCompletion() noexcept
+        : status(static_cast<u32>(ExecutionStatus::PENDING))
+        , sleepers(0)
+        , references(0)
+        , continuationState(0)
+        , executionId(0)
+        , durationCycles(0)
+        , nodesCompleted(0)
+        , nodesFailed(0)
+        , continuation(nullptr)
+        , continuationData(nullptr) {}
+};
+
+// ============================================================================
+// EXECUTION HANDLE - Reference-counted view of one execution's completion
+// ============================================================================
+class ExecutionHandle {
+private:
+    ExecutionCompletion* completion;
+    
+public:
+    ExecutionHandle() noexcept : completion(nullptr) {}
+    explicit ExecutionHandle(ExecutionCompletion* adopted) noexcept : completion(adopted) {}  // Takes over one reference
+    ExecutionHandle(const ExecutionHandle& other) noexcept;
+    ExecutionHandle(ExecutionHandle&& other) noexcept : completion(other.completion) { other.completion = nullptr; }
+    ExecutionHandle& operator=(const ExecutionHandle& other) noexcept;
+    ExecutionHandle& operator=(ExecutionHandle&& other) noexcept;
+    ~ExecutionHandle() noexcept;
+    
+    // Invalid if the execution could not be started
+    bool valid() const noexcept { return completion != nullptr; }
+    u64 getExecutionId() const noexcept { return completion ? completion->executionId : 0; }
+    ExecutionStatus getStatus() const noexcept;
+    bool isReady() const noexcept { return getStatus() != ExecutionStatus::PENDING; }
+    
+    // Spin, then sleep until finished. timeoutNs = 0 waits without limit.
+    // Returns true if the execution finished.
+    bool wait(u64 timeoutNs = 0) const noexcept;
+    
+    // Totals of a finished execution; false while still pending
+    bool getResult(ExecutionResult& result) const noexcept;
+    
+    // Run continuation(handle, userData) once the execution finishes - right
+    // away if it already has. One pending continuation per execution; false
+    // if another is still waiting to fire or the handle is invalid.
+    bool then(ExecutionContinuation continuation, void* userData) const noexcept;
+};
+
+// ============================================================================
+// ASYNC NODES - Coroutine node bodies
+// ============================================================================
+// A node that waits on something slow - a storage write, an alert gateway,
+// another DAG - is written as a coroutine returning NodeTask and registered
+// for its unit type. An await that is not ready suspends the node and frees
+// the worker; whatever completes the wait pushes the node back onto the
+// executor's queues and a worker resumes it there. CPU-bound nodes keep
+// running to completion on the worker that popped them.
+
+constexpr u32 ASYNC_NODE_ERROR_NO_FRAME = 0xA001;     // Coroutine frame allocation failed
+constexpr u32 ASYNC_NODE_ERROR_EXCEPTION = 0xA002;    // Body let an exception escape
+
+// Origin: What an async body reads and writes - owned by the executor and
+// valid until the body returns
+struct AsyncNodeContext {
+    DAGNode* node;
+    ExecutionContext* context;
+    Message input;            // First predecessor's output, empty for entry nodes
+    Message output;           // Becomes the record's lastOutput on success
+    u32 errorCode;            // Non-zero fails the node (retried, then dead-lettered)
+    
+    AsyncNodeContext() noexcept 
+        : node(nullptr)
+        , context(nullptr)
+        , input()
+        , output()
+        , errorCode(0) {}
+    
+    // Execution cancelled or timed out - the body decides how to wind down
+    bool isCancelled() const noexcept {
+        return context->cancelled.load(std::memory_order_acquire);
+    }
+};
+
+// Origin: Return type of an async node body. Created suspended; the executor
+// resumes it on a worker and destroys it once it has run to the end.
+class NodeTask {
+public:
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+    
+    // Hands the finished node back to the executor from its last suspension
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(Handle coroutine) const noexcept;
+        void await_resume() const noexcept {}
+    };
+    
+    struct promise_type {
+        AsyncNodeFrame* frame = nullptr;    // Set before the first resume
+        
+        NodeTask get_return_object() noexcept { return NodeTask(Handle::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept;
+        
+        // Frames come from nothrow new - a failed allocation is an empty task
+        static NodeTask get_return_object_on_allocation_failure() noexcept { return NodeTask(); }
+    };
+    
+    NodeTask() noexcept : coroutine() {}
+    explicit NodeTask(Handle handle) noexcept : coroutine(handle) {}
+    NodeTask(NodeTask&& other) noexcept : coroutine(other.coroutine) { other.coroutine = nullptr; }
+    NodeTask& operator=(NodeTask&& other) noexcept {
+        if (this != &other) {
+            if (coroutine) coroutine.destroy();
+            coroutine = other.coroutine;
+            other.coroutine = nullptr;
+        }
+        return *this;
+    }
+    ~NodeTask() noexcept {
+        if (coroutine) coroutine.destroy();
+    }
+    
+    NodeTask(const NodeTask&) = delete;
+    NodeTask& operator=(const NodeTask&) = delete;
+    
+    bool valid() const noexcept { return static_cast<bool>(coroutine); }
+    
+    // The executor takes over the frame
+    Handle release() noexcept {
+        Handle handle = coroutine;
+        coroutine = nullptr;
+        return handle;
+    }
+    
+private:
+    Handle coroutine;
+};
+
+// Signature of a registered async node body
+typedef NodeTask (*AsyncNodeBody)(AsyncNodeContext& node);
+
+// Origin: co_await AsyncSleep(ns) - the node waits in the executor's timer
+// wheel, not on a worker. Resolution is the wheel tick (~5us).
+struct AsyncSleep {
+    u64 durationNs;
+    
+    explicit AsyncSleep(u64 ns) noexcept : durationNs(ns) {}
+    
+    bool await_ready() const noexcept { return durationNs == 0; }
+    void await_suspend(NodeTask::Handle coroutine) const noexcept;
+    void await_resume() const noexcept {}
+};
+
+// Origin: co_await handle - resumes once another DAG's execution has finished
+// and yields its status. Uses the handle's single continuation slot; if that
+// is already taken the node does not suspend and sees PENDING.
+class ExecutionAwaiter {
+public:
+    explicit ExecutionAwaiter(const ExecutionHandle& execution) noexcept : handle(execution) {}
+    
+    bool await_ready() const noexcept { return !handle.valid() || handle.isReady(); }
+    bool await_suspend(NodeTask::Handle coroutine) const noexcept;
+    ExecutionStatus await_resume() const noexcept {
+        return handle.valid() ? handle.getStatus() : ExecutionStatus::CANCELLED;
+    }
+    
+private:
+    ExecutionHandle handle;     // Keeps the completion alive across the suspension
+};
+
+inline ExecutionAwaiter operator co_await(const ExecutionHandle& handle) noexcept {
+    return ExecutionAwaiter(handle);
+}
+
+// Origin: One-shot I/O completion an async node awaits. The I/O layer calls
+// signal() from its own thread - completion port, callback or polling loop.
+// A node stays suspended until its event fires, and the execution stays open
+// with it, so the I/O layer must signal failures too (with an error result).
+class AsyncNodeEvent {
+public:
+    AsyncNodeEvent() noexcept : state(EVENT_EMPTY), result(0) {}
+    
+    AsyncNodeEvent(const AsyncNodeEvent&) = delete;
+    AsyncNodeEvent& operator=(const AsyncNodeEvent&) = delete;
+    
+    // Store the result and requeue the waiting node, if any. Once per arm.
+    void signal(u64 value) noexcept;
+    
+    bool isSignalled() const noexcept {
+        return state.load(std::memory_order_acquire) == EVENT_SIGNALLED;
+    }
+    
+    // Rearm for another wait - only while no node is suspended on it
+    void reset() noexcept {
+        result = 0;
+        state.store(EVENT_EMPTY, std::memory_order_release);
+    }
+    
+    struct Awaiter {
+        AsyncNodeEvent& event;
+        
+        bool await_ready() const noexcept { return event.isSignalled(); }
+        bool await_suspend(NodeTask::Handle coroutine) const noexcept;
+        u64 await_resume() const noexcept { return event.result; }
+    };
+    
+    Awaiter operator co_await() noexcept { return Awaiter{*this}; }
+    
+private:
+    static constexpr uptr EVENT_EMPTY = 0;
+    static constexpr uptr EVENT_SIGNALLED = 1;
+    
+    std::atomic<uptr> state;    // EMPTY, SIGNALLED or the waiting AsyncNodeFrame*
+    u64 result;                 // Written before state, read after it
+};
+
 // ============================================================================
 // DAG EXECUTOR - Main execution engine
 // ============================================================================
@@ -177,6 +468,28 @@ private:
     // Execution queues by priority - PSYCHOTIC: 5 priority levels!
     tbb::concurrent_queue<ExecutionQueueEntry> queues[5];
     
+    // Async executions waiting for a worker - picked up by workerLoop, not
+    // by a task of their own that the spinning workers would starve
+    struct PendingExecution {
+        DAGInstance* dag;
+        ExecutionContext* context;
+    };
+    tbb::concurrent_queue<PendingExecution> pendingExecutions;
+    
+    // Async node bodies by unit type - written at startup, scanned per node
+    struct AsyncNodeBinding {
+        std::atomic<u32> type;
+        std::atomic<AsyncNodeBody> body;
+    };
+    static constexpr u32 MAX_ASYNC_NODE_TYPES = 16;
+    AsyncNodeBinding asyncBodies[MAX_ASYNC_NODE_TYPES];
+    AtomicU32 asyncBodyCount;
+    
+    // Async nodes inside AsyncSleep - any worker fires the wheel
+    TimerWheel sleepWheel;
+    Spinlock sleepLock;
+    AtomicU32 sleepingNodes;
+    
     // Hash compare for u64
     struct U64HashCompare {
         std::size_t hash(const u64& key) const noexcept {
@@ -190,10 +503,10 @@ private:
     // Active executions
     tbb::concurrent_hash_map<u64, ExecutionContext*, U64HashCompare> activeExecutions;
     
-    // Node execution records per DAG
-    tbb::concurrent_hash_map<DAGId, 
-        tbb::concurrent_hash_map<NodeId, NodeExecutionRecord, IdHashCompare<NodeId>>*,
-        IdHashCompare<DAGId>> executionRecords;
+    // Node records of each DAG's last finished run, for getNodeStats - runs
+    // in flight keep theirs on their ExecutionContext, so two runs of one
+    // DAG never share records
+    tbb::concurrent_hash_map<DAGId, NodeRecordMap*, DAGIdHashCompare> executionRecords;
     
     // Worker threads
     tbb::task_group workers;
@@ -211,6 +524,8 @@ private:
     static constexpr u32 MAX_PARALLEL_NODES = 1024;
     static constexpr u32 MAX_RETRY_COUNT = 3;
     static constexpr u64 EXECUTION_TIMEOUT_CYCLES = 10000000000ULL; // ~3 seconds at 3GHz
+    static constexpr u64 NOMINAL_CYCLES_PER_NS = 3;  // Same 3GHz assumption for cycle timeouts
+    static constexpr u32 ASYNC_SLEEP_TICK_SHIFT = 14;  // ~5us wheel ticks on the TSC
     
 public:
     // Constructor/Destructor
@@ -219,6 +534,13 @@ public:
     
     // Initialization
     bool initialize(MessageBroker* msgBroker = nullptr) noexcept;
+    
+    // No workers - the owning thread drives processQueues (runtime shards)
+    bool initializeInline(MessageBroker* msgBroker) noexcept;
+    
+    // Build the process-wide context and completion pools now - otherwise
+    // the first execution pays for them
+    static void prewarmPools() noexcept;
     void shutdown() noexcept;
     
     // DAG Execution
@@ -226,16 +548,34 @@ public:
     bool executeNode(DAGNode* node, ExecutionContext* context) noexcept;
     void cancelExecution(u64 executionId) noexcept;
     
-    // Async execution
-    u64 executeDagAsync(DAGInstance* dag, const ExecutionContext& context) noexcept;
+    // Async execution - the handle completes when the last node finalizes
+    ExecutionHandle executeDagAsync(DAGInstance* dag, const ExecutionContext& context) noexcept;
     bool waitForExecution(u64 executionId, u64 timeoutCycles = 0) noexcept;
     bool getExecutionResult(u64 executionId, ExecutionResult& result) noexcept;
     
+    // Templated execution - ticks[i] runs through the template state of
+    // sessions[i], node by node across the batch. State is resolved from the
+    // session on every call; sessions that are not active or carry no state
+    // of this template are skipped. In actor mode call it from the owner.
+    // Returns the number of sessions executed.
+    u32 executeTemplateBatch(const DAGTemplate& dagTemplate, SessionData* const* sessions,
+                             const TickMessage* ticks, u32 count) noexcept;
+    
     // Node scheduling
     bool scheduleNode(NodeId nodeId, ExecutionContext* context, ExecutionPriority priority) noexcept;
     void processQueues() noexcept;
     bool processQueue(u32 priorityLevel) noexcept;
     
+    // Async nodes - every node of a registered type runs as a coroutine.
+    // Register at startup, before executions reach nodes of that type.
+    bool registerAsyncNodeBody(ProcessingUnitType type, AsyncNodeBody body) noexcept;
+    
+    // Async node plumbing for the awaitables - any thread
+    void resumeAsyncNode(AsyncNodeFrame* frame) noexcept;
+    void sleepAsyncNode(AsyncNodeFrame* frame, u64 durationNs) noexcept;
+    void finishAsyncNode(AsyncNodeFrame* frame) noexcept;
+    u32 processSleepingNodes() noexcept;
+    
     // Dependency management
     bool updateDependencies(NodeId completedNode, DAGInstance* dag, ExecutionContext* context) noexcept;
     bool checkNodeReady(NodeId nodeId, DAGInstance* dag) noexcept;
@@ -255,9 +595,17 @@ public:
     
 private:
     // Internal execution
+    ExecutionContext* beginExecution(DAGInstance* dag, const ExecutionContext& context, bool withHandle) noexcept;
+    u64 runExecution(DAGInstance* dag, ExecutionContext* execContext) noexcept;
+    bool runPendingExecution() noexcept;
     void executeNodeInternal(DAGNode* node, NodeExecutionRecord& record, ExecutionContext* context) noexcept;
     void handleNodeFailure(NodeId nodeId, ExecutionContext* context, u32 errorCode) noexcept;
+    void failDependents(NodeId failedNode, ExecutionContext* context, u32 errorCode) noexcept;
     void finalizeExecution(ExecutionContext* context, DAGInstance* dag) noexcept;
+    void releaseExecution(ExecutionContext* context) noexcept;
+    AsyncNodeBody findAsyncNodeBody(ProcessingUnitType type) noexcept;
+    bool startAsyncNode(DAGNode* node, ExecutionContext* context, AsyncNodeBody body) noexcept;
+    bool completeAsyncNode(DAGNode* node, ExecutionContext* context, u32 errorCode, const Message& output) noexcept;
     
     // Worker thread function
     void workerLoop() noexcept;
@@ -273,6 +621,21 @@ private:
 // PSYCHOTIC: Single global executor for entire system
 DAGExecutor& getGlobalDAGExecutor() noexcept;
 
+// ============================================================================
+// EXPORTS
+// ============================================================================
+extern "C" {
+    // Completion signal to a sleeping waiter, round trip. Returns average ns
+    // from signal to the waiter running; signalNs gets the signaller's cost.
+    AARENDOCORE_API u64 AARendoCore_TestExecutionWakeup(u32 rounds, u64* signalNs);
+    
+    // One DAG of cpuNodes normalizers and slowNodes persistence writers that
+    // each wait latencyNs - suspended in AsyncSleep, or blocking the worker
+    // when suspend is 0. Returns average ns per DAG execution.
+    AARENDOCORE_API u64 AARendoCore_TestAsyncNodeOverlap(u32 cpuNodes, u32 slowNodes,
+                                                        u64 latencyNs, u32 suspend);
+}
+
 AARENDOCORE_NAMESPACE_END
 
 #endif // AARENDOCORE_CORE_DAGEXECUTOR_H
\ No newline at end of file
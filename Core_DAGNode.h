@@ -5,6 +5,7 @@
 //   - Core_Types.h (u32, u64, AtomicU32, AtomicU64)
 //   - Core_DAGTypes.h (NodeId, DAGId, ProcessingUnitId, etc)
 //   - Core_MessageTypes.h (Message)
+//   - Core_ObjectPool.h (ObjectPool)
 // ORIGIN: NEW - Defines the fundamental DAG node structure
 //
 // PSYCHOTIC PRECISION: NODE IS EXACTLY 256 BYTES (4 CACHE LINES)
@@ -18,6 +19,7 @@
 #include "Core_Alignment.h"     // LEVEL 2: Alignment
 #include "Core_MessageTypes.h"  // LEVEL 3: Message types
 #include "Core_DAGTypes.h"      // LEVEL 4: DAG types
+#include "Core_ObjectPool.h"    // Tagged free list behind DAGNodePool
 
 AARENDOCORE_NAMESPACE_BEGIN
 
@@ -264,72 +266,31 @@ struct alignas(256) DAGNode {
 template<size_t MaxNodes = 100000>
 class DAGNodePool {
 private:
-    alignas(AARENDOCORE_PAGE_SIZE) DAGNode nodes[MaxNodes];  // Pre-allocated nodes
-    AtomicU64 allocatedCount;  // Number of allocated nodes
-    AtomicU64 freeListHead;    // Head of free list (using nodeId.value as next pointer)
+    ObjectPool<DAGNode> pool;  // Tagged index free list + per-thread caches
     
 public:
-    DAGNodePool() noexcept 
-        : allocatedCount(0)
-        , freeListHead(UINT64_MAX) {  // Empty free list
-        // Nodes are default-constructed
+    DAGNodePool() noexcept {
+        pool.initialize(static_cast<u32>(MaxNodes), -1, AARENDOCORE_PAGE_SIZE);
     }
     
-    // Allocate a node from pool
+    // Allocate a node from pool - freshly constructed
     DAGNode* allocate() noexcept {
-        // First try free list
-        u64 head = freeListHead.load(std::memory_order_acquire);
-        while (head != UINT64_MAX) {
-            DAGNode* node = &nodes[head];
-            u64 next = node->reserved1;  // Using reserved1 as next pointer
-            if (freeListHead.compare_exchange_weak(head, next,
-                                                  std::memory_order_release,
-                                                  std::memory_order_acquire)) {
-                node->resetStats();
-                node->state.store(static_cast<u32>(NodeState::UNINITIALIZED));
-                return node;
-            }
-        }
-        
-        // Free list empty, allocate new
-        u64 index = allocatedCount.fetch_add(1, std::memory_order_relaxed);
-        if (index >= MaxNodes) {
-            allocatedCount.fetch_sub(1, std::memory_order_relaxed);
-            return nullptr;  // Pool exhausted
-        }
-        
-        return &nodes[index];
+        return pool.create();
     }
     
     // Return node to pool
     void deallocate(DAGNode* node) noexcept {
-        if (!node) return;
-        
-        // Calculate index
-        size_t index = node - nodes;
-        if (index >= MaxNodes) return;  // Not from this pool
-        
-        // Reset node
-        *node = DAGNode();  // Reset to default state
-        
-        // Add to free list
-        u64 head = freeListHead.load(std::memory_order_acquire);
-        do {
-            node->reserved1 = head;  // Store next pointer
-        } while (!freeListHead.compare_exchange_weak(head, index,
-                                                    std::memory_order_release,
-                                                    std::memory_order_acquire));
+        pool.destroy(node);  // Ignores nodes not from this pool
     }
     
     // Get allocated count
     u64 getAllocatedCount() const noexcept {
-        return allocatedCount.load(std::memory_order_relaxed);
+        return pool.getAllocatedCount();
     }
     
     // Check if pool is exhausted
     bool isExhausted() const noexcept {
-        return allocatedCount.load(std::memory_order_relaxed) >= MaxNodes &&
-               freeListHead.load(std::memory_order_relaxed) == UINT64_MAX;
+        return pool.isExhausted();
     }
 };
 
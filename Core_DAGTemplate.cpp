@@ -0,0 +1,201 @@
+//===--- Core_DAGTemplate.cpp - Shared DAG Templates ----------------------===//
+//
+// COMPILATION LEVEL: 8 (After DAGBuilder, Session)
+// ORIGIN: Implementation of Core_DAGTemplate.h
+//
+// PSYCHOTIC PRECISION: ONE SCHEDULE, MILLIONS OF 32-BYTE SLOTS
+//===----------------------------------------------------------------------===//
+
+#include "Core_DAGTemplate.h"
+#include "Core_Memory.h"
+#include <immintrin.h>
+#include <cstring>
+#include <new>
+
+AARENDOCORE_NAMESPACE_BEGIN
+
+// ============================================================================
+// BATCHED KERNELS
+// ============================================================================
+// Same arithmetic as DAGExecutor::executeNodeInternal, but over a whole
+// batch of sessions and on slots: tick [price, volume, bid, ask] in,
+// bar-shaped [open, high, low, close] or [value, 0, 0, 0] out.
+
+namespace {
+
+constexpr u8 SLOT_COMPLETED = static_cast<u8>(NodeState::COMPLETED);
+
+// Entry nodes - copy the tick fields in
+void kernelPassthrough(const f64* const* inputs, f64* const* outputs,
+                       [[maybe_unused]] const u8* const* states, u32 count) noexcept {
+    for (u32 i = 0; i < count; ++i) {
+        _mm256_store_pd(outputs[i], _mm256_loadu_pd(inputs[i]));
+    }
+}
+
+// Min-max normalization to [-1, 1], all four fields in one FMA
+void kernelNormalize(const f64* const* inputs, f64* const* outputs,
+                     [[maybe_unused]] const u8* const* states, u32 count) noexcept {
+    constexpr f64 min = -100.0;
+    constexpr f64 max = 100.0;
+    const __m256d scale = _mm256_set1_pd(2.0 / (max - min));
+    const __m256d offset = _mm256_set1_pd(-min * 2.0 / (max - min) - 1.0);
+
+    for (u32 i = 0; i < count; ++i) {
+        _mm256_store_pd(outputs[i], _mm256_fmadd_pd(_mm256_loadu_pd(inputs[i]), scale, offset));
+    }
+}
+
+// Running OHLC over the first input value - the slot is the bar
+void kernelAggregate(const f64* const* inputs, f64* const* outputs,
+                     const u8* const* states, u32 count) noexcept {
+    for (u32 i = 0; i < count; ++i) {
+        __m256d value = _mm256_broadcast_sd(inputs[i]);
+        if (*states[i] != SLOT_COMPLETED) {
+            _mm256_store_pd(outputs[i], value);  // First value opens the bar
+            continue;
+        }
+
+        __m256d bar = _mm256_load_pd(outputs[i]);
+        __m256d next = _mm256_blend_pd(bar, _mm256_max_pd(bar, value), 0x2);   // high
+        next = _mm256_blend_pd(next, _mm256_min_pd(bar, value), 0x4);         // low
+        next = _mm256_blend_pd(next, value, 0x8);                             // close
+        _mm256_store_pd(outputs[i], next);
+    }
+}
+
+// Trend of a bar: 1 bullish, 2 bearish, 0 neutral
+void kernelDetectPattern(const f64* const* inputs, f64* const* outputs,
+                         [[maybe_unused]] const u8* const* states, u32 count) noexcept {
+    for (u32 i = 0; i < count; ++i) {
+        f64 open = inputs[i][0];
+        f64 close = inputs[i][3];
+        f64 pattern = (close > open) ? 1.0 : (close < open) ? 2.0 : 0.0;
+        _mm256_store_pd(outputs[i], _mm256_set_pd(0.0, 0.0, 0.0, pattern));
+    }
+}
+
+// Linear extrapolation of a bar's close
+void kernelPredict(const f64* const* inputs, f64* const* outputs,
+                   [[maybe_unused]] const u8* const* states, u32 count) noexcept {
+    for (u32 i = 0; i < count; ++i) {
+        f64 open = inputs[i][0];
+        f64 close = inputs[i][3];
+        f64 slope = (close - open) / 3.0;
+        _mm256_store_pd(outputs[i], _mm256_set_pd(0.0, 0.0, 0.0, close + slope));
+    }
+}
+
+} // anonymous namespace
+
+TemplateKernel getTemplateKernel(ProcessingUnitType type) noexcept {
+    switch (type) {
+        case ProcessingUnitType::MARKET_DATA_RECEIVER: return kernelPassthrough;
+        case ProcessingUnitType::STREAM_NORMALIZER:    return kernelNormalize;
+        case ProcessingUnitType::AGGREGATOR:           return kernelAggregate;
+        case ProcessingUnitType::PATTERN_DETECTOR:     return kernelDetectPattern;
+        case ProcessingUnitType::ML_PREDICTOR:         return kernelPredict;
+        default:                                       return nullptr;
+    }
+}
+
+// ============================================================================
+// DAG TEMPLATE IMPLEMENTATION
+// ============================================================================
+
+// Constructor - arrays sized once, filled by the builder
+DAGTemplate::DAGTemplate(DAGId id, u32 count) noexcept
+    : templateId(id)
+    , schedule(nullptr)
+    , nodeExecutions(nullptr)
+    , nodeCount(count)
+    , slotsOffset(0)
+    , stateSize(0) {
+    // Header, one state byte per node padded to a slot boundary, then the slots
+    slotsOffset = static_cast<u32>(sizeof(DAGSessionState) + AlignUp(static_cast<usize>(count), 32));
+    stateSize = slotsOffset + count * DAG_TEMPLATE_SLOT_VALUES * static_cast<u32>(sizeof(f64));
+
+    if (count == 0) {
+        return;
+    }
+
+    schedule = static_cast<CompiledNode*>(
+        AllocateAligned(sizeof(CompiledNode) * count, AARENDOCORE_CACHE_LINE_SIZE));
+    nodeExecutions = static_cast<AtomicU64*>(
+        AllocateAligned(sizeof(AtomicU64) * count, AARENDOCORE_CACHE_LINE_SIZE));
+
+    if (nodeExecutions) {
+        for (u32 i = 0; i < count; ++i) {
+            new(&nodeExecutions[i]) AtomicU64(0);
+        }
+    }
+}
+
+// Destructor
+DAGTemplate::~DAGTemplate() noexcept {
+    if (schedule) {
+        FreeAligned(schedule);
+    }
+    if (nodeExecutions) {
+        FreeAligned(nodeExecutions);
+    }
+}
+
+// Carve a state block out of the session's memory
+DAGSessionState* DAGTemplate::createState(SessionData& session) const noexcept {
+    void* memory = session.allocate(stateSize, 32);
+    if (!memory) {
+        return nullptr;
+    }
+
+    usize offset = static_cast<byte*>(memory) - session.memoryPool->data();
+    if (offset >= 0xFFFFFFFFULL) {
+        return nullptr;
+    }
+
+    DAGSessionState* state = static_cast<DAGSessionState*>(memory);
+    resetState(state);
+    session.templateState = static_cast<u32>(offset) + 1;
+    return state;
+}
+
+// Current address of the session's state - the arena may have moved since
+// createState (hibernate/rehydrate, checkpoint restore), the offset has not
+DAGSessionState* DAGTemplate::resolveState(SessionData& session) const noexcept {
+    MemoryPool* arena = session.memoryPool;
+    u32 offset = session.templateState;
+    if (offset == 0 || !arena || !arena->is_initialized() ||
+        static_cast<usize>(offset - 1) + stateSize > arena->used()) {
+        return nullptr;
+    }
+
+    DAGSessionState* state = reinterpret_cast<DAGSessionState*>(arena->data() + (offset - 1));
+    return ownsState(state) ? state : nullptr;
+}
+
+// Back to never-executed
+void DAGTemplate::resetState(DAGSessionState* state) const noexcept {
+    if (!state) {
+        return;
+    }
+
+    std::memset(state, 0, stateSize);
+    state->templateId = templateId.value;
+    state->nodeCount = nodeCount;
+}
+
+// Output slot of a node by id
+const f64* DAGTemplate::getOutput(const DAGSessionState* state, NodeId nodeId) const noexcept {
+    if (!ownsState(state)) {
+        return nullptr;
+    }
+
+    for (u32 i = 0; i < nodeCount; ++i) {
+        if (schedule[i].nodeId == nodeId) {
+            return slot(state, i);
+        }
+    }
+    return nullptr;
+}
+
+AARENDOCORE_NAMESPACE_END
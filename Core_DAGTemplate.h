@@ -0,0 +1,154 @@
+//===--- Core_DAGTemplate.h - Shared DAG Templates ------------------------===//
+//
+// COMPILATION LEVEL: 8 (After DAGBuilder, Session)
+// DEPENDENCIES:
+//   - Core_Types.h (u32, u64, f64)
+//   - Core_DAGTypes.h (DAGId, NodeId, ProcessingUnitType)
+//   - Core_MessageTypes.h (TickMessage)
+//   - Core_Session.h (SessionData::allocate)
+// ORIGIN: NEW - One compiled DAG shared by millions of sessions
+//
+// A DAGInstance costs a 256-byte DAGNode per node plus execution records,
+// which is fine for a handful of DAGs and infeasible per session. A
+// template compiles a topology once - schedule, edges and node kernels -
+// and each session carries only a DAGSessionState: one state byte and one
+// 32-byte value slot per node, carved from the session's own memory. The
+// session keeps its offset, not its address - hibernation and checkpoint
+// restore bring the arena back somewhere else.
+//
+// The executor runs a batch of sessions through the schedule node by node,
+// so one kernel stays hot in the instruction cache while it sweeps every
+// session, and each slot is exactly one AVX2 register.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_DAGTEMPLATE_H
+#define AARENDOCORE_CORE_DAGTEMPLATE_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include "Core_DAGTypes.h"
+#include "Core_MessageTypes.h"
+#include "Core_Session.h"
+
+AARENDOCORE_NAMESPACE_BEGIN
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+static constexpr u32 DAG_TEMPLATE_BATCH = 64;       // Sessions per node sweep
+static constexpr u32 DAG_TEMPLATE_SLOT_VALUES = 4;  // f64 per node slot (one ymm)
+static constexpr u32 DAG_TEMPLATE_NO_INPUT = 0xFFFFFFFF;
+
+// Origin: Batched node kernel - count sessions, one input and output slot each.
+// states[i] is NodeState as a byte; COMPLETED means the slot holds a value.
+typedef void (*TemplateKernel)(const f64* const* inputs, f64* const* outputs,
+                               const u8* const* states, u32 count);
+
+// ============================================================================
+// SESSION STATE BLOCK - Per-session part of a templated DAG
+// ============================================================================
+// Origin: Header of a variable-size block allocated by DAGTemplate::createState
+// Scope: Lives in the owning session's memory pool, found through
+//        SessionData::templateState - never cache the address across batches
+// Layout: header | u8 nodeStates[nodeCount] (padded to 32) | f64 slots[nodeCount][4]
+struct alignas(32) DAGSessionState {
+    u64 templateId;             // DAGId of the template that laid it out
+    u32 nodeCount;
+    u32 executions;             // Ticks run through the whole schedule
+    u64 lastExecutionTime;      // RDTSC at the end of the last run
+    u64 reserved;
+
+    u8* nodeStates() noexcept {
+        return reinterpret_cast<u8*>(this + 1);
+    }
+
+    const u8* nodeStates() const noexcept {
+        return reinterpret_cast<const u8*>(this + 1);
+    }
+};
+
+static_assert(sizeof(DAGSessionState) == 32, "DAGSessionState header must stay 32 bytes");
+
+// ============================================================================
+// DAG TEMPLATE - Compiled, shared, immutable
+// ============================================================================
+// Origin: Built by DAGBuilder::buildTemplate from a DAGTopology
+// Scope: Shared read-only by every session and executor thread
+class DAGTemplate {
+public:
+    // Origin: One node of the compiled schedule, in topological order
+    struct CompiledNode {
+        NodeId nodeId;
+        ProcessingUnitType type;
+        u32 input;              // Schedule index of the feeding node, or NO_INPUT
+        TemplateKernel kernel;
+    };
+
+private:
+    DAGId templateId;
+    CompiledNode* schedule;     // nodeCount entries, topological order
+    AtomicU64* nodeExecutions;  // Per node, bumped once per batch
+    u32 nodeCount;
+    u32 slotsOffset;            // From block start to the first slot
+    u32 stateSize;              // Whole block, multiple of 32
+
+public:
+    DAGTemplate(DAGId id, u32 count) noexcept;
+    ~DAGTemplate() noexcept;
+
+    DAGTemplate(const DAGTemplate&) = delete;
+    DAGTemplate& operator=(const DAGTemplate&) = delete;
+
+    // Builder side - false if the arrays could not be allocated
+    bool isAllocated() const noexcept { return schedule && nodeExecutions; }
+    void setNode(u32 index, const CompiledNode& node) noexcept { schedule[index] = node; }
+
+    // Per-session state - allocated from the session's arena and recorded
+    // as an offset in the session, so the bytes travel with the arena.
+    // The returned address is only good until the session next hibernates;
+    // resolveState finds it again, nullptr if absent or another template's.
+    DAGSessionState* createState(SessionData& session) const noexcept;
+    DAGSessionState* resolveState(SessionData& session) const noexcept;
+    void resetState(DAGSessionState* state) const noexcept;
+    bool ownsState(const DAGSessionState* state) const noexcept {
+        return state && state->templateId == templateId.value && state->nodeCount == nodeCount;
+    }
+
+    // Slot of one node - DAG_TEMPLATE_SLOT_VALUES values, 32-byte aligned
+    f64* slot(DAGSessionState* state, u32 index) const noexcept {
+        return reinterpret_cast<f64*>(reinterpret_cast<u8*>(state) + slotsOffset) +
+               index * DAG_TEMPLATE_SLOT_VALUES;
+    }
+
+    const f64* slot(const DAGSessionState* state, u32 index) const noexcept {
+        return reinterpret_cast<const f64*>(reinterpret_cast<const u8*>(state) + slotsOffset) +
+               index * DAG_TEMPLATE_SLOT_VALUES;
+    }
+
+    // Output of a node by id, nullptr if the node is not in the template
+    const f64* getOutput(const DAGSessionState* state, NodeId nodeId) const noexcept;
+
+    // Queries
+    DAGId getId() const noexcept { return templateId; }
+    u32 getNodeCount() const noexcept { return nodeCount; }
+    u32 getStateSize() const noexcept { return stateSize; }
+    const CompiledNode& getNode(u32 index) const noexcept { return schedule[index]; }
+    u64 getNodeExecutions(u32 index) const noexcept {
+        return nodeExecutions[index].load(std::memory_order_relaxed);
+    }
+    void recordNodeExecutions(u32 index, u32 count) const noexcept {
+        nodeExecutions[index].fetch_add(count, std::memory_order_relaxed);
+    }
+};
+
+// ============================================================================
+// KERNEL REGISTRY
+// ============================================================================
+
+// Batched kernel for a unit type, nullptr if the type has none yet
+TemplateKernel getTemplateKernel(ProcessingUnitType type) noexcept;
+
+AARENDOCORE_NAMESPACE_END
+
+#endif // AARENDOCORE_CORE_DAGTEMPLATE_H
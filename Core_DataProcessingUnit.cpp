@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "Core_DataProcessingUnit.h"
+#include "Core_Trace.h"
 #include <cstring>
 #include <algorithm>
 #include <malloc.h>
@@ -26,6 +27,8 @@ DataProcessingUnit::DataProcessingUnit(i32 numaNode) noexcept
                         CAP_ZERO_COPY | CAP_LOCK_FREE,
                         numaNode)
     , dataConfig_{}
+    , publishedDataConfig_()
+    , dataConfigVersion_(0)
     , dataBuffer_(nullptr)
     , bufferPos_(0)
     , dataQueue_(nullptr)
@@ -98,6 +101,10 @@ ProcessResult DataProcessingUnit::processTick([[maybe_unused]] SessionId session
         return ProcessResult::FAILED;
     }
     
+    AARENDOCORE_TRACE_SCOPE(DATA_UNIT, UNIT_PROCESS_TICK, getId(), tick.timestamp);
+    
+    adoptDataConfig();
+    
     // Convert tick to generic data
     // tickData: Origin - Local buffer for tick data, Scope: Function
     u8 tickData[sizeof(Tick)];
@@ -133,6 +140,11 @@ ProcessResult DataProcessingUnit::processBatch([[maybe_unused]] SessionId sessio
     
     transitionState(ProcessingUnitState::PROCESSING);
     
+    AARENDOCORE_TRACE_SCOPE(DATA_UNIT, UNIT_PROCESS_BATCH, getId(), count);
+    
+    // Batch boundary - the whole batch runs under one configuration
+    adoptDataConfig();
+    
     // processedCount: Origin - Local counter, Scope: Function
     usize processedCount = 0;
     
@@ -165,6 +177,8 @@ ProcessResult DataProcessingUnit::processBatch([[maybe_unused]] SessionId sessio
 // Origin: Process stream data
 ProcessResult DataProcessingUnit::processStream([[maybe_unused]] SessionId sessionId,
                                                 const StreamData& streamData) noexcept {
+    adoptDataConfig();
+    
     // Validate stream data type
     if (streamData.dataType != dataConfig_.dataTypeId && dataConfig_.dataTypeId != 0) {
         return ProcessResult::SKIP;
@@ -195,15 +209,29 @@ ResultCode DataProcessingUnit::configureData(const DataProcessingConfig& config)
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
     
-    // Update configuration
-    dataConfig_ = config;
+    // Publish only - the processing thread adopts it at its next boundary
+    if (publishedDataConfig_.publish(config) == 0) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
+    
+    return ResultCode::SUCCESS;
+}
+
+// Origin: Adopt the latest published data configuration
+void DataProcessingUnit::adoptDataConfig() noexcept {
+    // previousBufferSize: Origin - Buffer size before adoption, Scope: function
+    const u32 previousBufferSize = dataConfig_.bufferSize;
     
-    // Reset buffers if size changed
-    if (config.bufferSize != dataConfig_.bufferSize) {
+    if (!publishedDataConfig_.refresh(dataConfig_, dataConfigVersion_)) {
+        return;
+    }
+    
+    // Reset buffers if size changed - on the thread that writes them
+    if (dataConfig_.bufferSize != previousBufferSize) {
         clearBuffers();
     }
     
-    return ResultCode::SUCCESS;
+    AARENDOCORE_TRACE_INSTANT(DATA_UNIT, UNIT_CONFIG_ADOPTED, getId(), dataConfigVersion_);
 }
 
 // Origin: Process raw data with FULL implementation
@@ -212,6 +240,8 @@ ProcessResult DataProcessingUnit::processRawData(const void* data, usize size) n
         return ProcessResult::FAILED;
     }
     
+    adoptDataConfig();
+    
     // Validate if enabled
     if (dataConfig_.enableValidation && !validateData(data, size)) {
         errorsCount_.fetch_add(1, std::memory_order_relaxed);
@@ -88,9 +88,15 @@ private:
     // MEMBER VARIABLES
     // ======================================================================
     
-    // Origin: Member - Data configuration, Scope: Instance lifetime
+    // Origin: Member - Data configuration in use, Scope: Adopted at batch boundaries
     DataProcessingConfig dataConfig_;
     
+    // Origin: Member - Latest configureData snapshot, Scope: Instance lifetime
+    VersionedConfig<DataProcessingConfig> publishedDataConfig_;
+    
+    // Origin: Member - Version dataConfig_ was copied from, Scope: Processing thread
+    u64 dataConfigVersion_;
+    
     // Origin: Member - Generic data buffer, Scope: Instance lifetime
     alignas(CACHE_LINE_SIZE) u8* dataBuffer_;
     
@@ -115,6 +121,9 @@ private:
     // PRIVATE METHODS
     // ======================================================================
     
+    // Origin: Pick up a configureData published since the last batch
+    void adoptDataConfig() noexcept;
+    
     // Origin: Process generic data
     // Input: data - Data pointer, size - Data size
     // Output: true if processed
@@ -168,7 +177,8 @@ public:
     // DATA-SPECIFIC METHODS
     // ======================================================================
     
-    // Origin: Configure data processing
+    // Origin: Configure data processing - safe while processing, takes
+    // effect at the start of the next call into the unit
     // Input: config - Data configuration
     // Output: ResultCode
     ResultCode configureData(const DataProcessingConfig& config) noexcept;
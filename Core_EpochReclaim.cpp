@@ -0,0 +1,609 @@
+//===--- Core_EpochReclaim.cpp - Epoch-Based Memory Reclamation ---------===//
+//
+// COMPILATION LEVEL: 1
+// ORIGIN: Implementation for Core_EpochReclaim.h
+// DEPENDENCIES: Core_EpochReclaim.h
+// DEPENDENTS: None
+//
+// An object retired in epoch E was unlinked before E was read, so only
+// readers that entered in E-1 or E can still hold it. The global epoch
+// moves only when every active reader has seen the current one; once it
+// reaches E+2 both of those generations are gone and the object is freed.
+//===----------------------------------------------------------------------===//
+
+#include "Core_EpochReclaim.h"
+#include <immintrin.h>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace AARendoCoreGLM {
+
+namespace {
+
+constexpr u64 EPOCH_ACTIVE = 1;
+
+thread_local void* t_epochRecord = nullptr;
+
+// Threads that found every slot taken - readers counted as a group
+thread_local bool t_epochUnregistered = false;
+thread_local u32 t_unregisteredNesting = 0;
+thread_local u32 t_unregisteredRetires = 0;
+
+// Origin: Hands the thread's slot back when the thread ends
+struct EpochThreadExit {
+    bool registered = false;
+    ~EpochThreadExit() {
+        if (registered) {
+            GetEpochManager().releaseThread();
+        }
+    }
+};
+
+thread_local EpochThreadExit t_epochExit;
+
+} // anonymous namespace
+
+// ==========================================================================
+// SETUP
+// ==========================================================================
+
+EpochManager::EpochManager() noexcept
+    : globalEpoch_(2)   // Start at 2 so "epoch + 2 <= global" never underflows
+    , totalRetired_(0)
+    , totalReclaimed_(0)
+    , totalLeaked_(0)
+    , unregisteredThreads_(0)
+    , unregisteredReaders_(0)
+    , orphans_(nullptr)
+    , highWater_(0) {
+    for (u32 i = 0; i < MAX_EPOCH_THREADS; ++i) {
+        records_[i].state.store(0, std::memory_order_relaxed);
+        records_[i].claimed.store(0, std::memory_order_relaxed);
+        records_[i].nesting = 0;
+        records_[i].sinceCollect = 0;
+        records_[i].retired = nullptr;
+        records_[i].head = 0;
+        records_[i].tail = 0;
+        records_[i].overflow = nullptr;
+        records_[i].overflowCount = 0;
+    }
+}
+
+EpochManager::~EpochManager() noexcept {
+    // No readers remain at teardown - run every pending destructor
+    for (u32 i = 0; i < MAX_EPOCH_THREADS; ++i) {
+        ThreadRecord& record = records_[i];
+        if (!record.retired) {
+            continue;
+        }
+        while (record.head < record.tail) {
+            RetiredObject& item = record.retired[record.head % EPOCH_RETIRE_CAPACITY];
+            item.reclaim(item.object, item.context);
+            ++record.head;
+        }
+        for (u32 j = 0; j < record.overflowCount; ++j) {
+            record.overflow[j].reclaim(record.overflow[j].object, record.overflow[j].context);
+        }
+        delete[] record.retired;
+        delete[] record.overflow;
+        record.retired = nullptr;
+        record.overflow = nullptr;
+        record.overflowCount = 0;
+    }
+
+    OrphanBatch* batch = orphans_.exchange(nullptr, std::memory_order_acquire);
+    while (batch) {
+        OrphanBatch* next = batch->next;
+        for (u32 i = 0; i < batch->count; ++i) {
+            batch->items[i].reclaim(batch->items[i].object, batch->items[i].context);
+        }
+        delete[] batch->items;
+        delete batch;
+        batch = next;
+    }
+}
+
+EpochManager::ThreadRecord* EpochManager::threadRecord() noexcept {
+    if (AARENDOCORE_LIKELY(t_epochRecord != nullptr)) {
+        return static_cast<ThreadRecord*>(t_epochRecord);
+    }
+    if (t_epochUnregistered) {
+        return nullptr;
+    }
+
+    for (u32 i = 0; i < MAX_EPOCH_THREADS; ++i) {
+        u32 expected = 0;
+        if (records_[i].claimed.load(std::memory_order_relaxed) != 0 ||
+            !records_[i].claimed.compare_exchange_strong(expected, 1,
+                                                          std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        ThreadRecord* record = &records_[i];
+        if (!record->retired) {
+            // Once per slot for the process lifetime, never per retire
+            record->retired = new(std::nothrow) RetiredObject[EPOCH_RETIRE_CAPACITY];
+            if (!record->retired) {
+                record->claimed.store(0, std::memory_order_release);
+                continue;
+            }
+        }
+
+        u32 high = highWater_.load(std::memory_order_relaxed);
+        while (high < i + 1 &&
+               !highWater_.compare_exchange_weak(high, i + 1, std::memory_order_acq_rel)) {
+        }
+
+        t_epochRecord = record;
+        t_epochExit.registered = true;
+        return record;
+    }
+
+    // More live threads than slots - waiting for one to exit could wait on
+    // the caller itself, so this thread runs unregistered for good
+    t_epochUnregistered = true;
+    unregisteredThreads_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void EpochManager::releaseThread() noexcept {
+    ThreadRecord* record = static_cast<ThreadRecord*>(t_epochRecord);
+    if (!record) {
+        return;
+    }
+
+    // No waiting at exit - a thread joined from inside a critical section
+    // would never see its retirements expire. Free what already has, hand
+    // the rest to whoever collects next.
+    tryAdvance();
+    reclaim(record);
+    orphanRecord(record);
+
+    record->nesting = 0;
+    record->sinceCollect = 0;
+    record->state.store(0, std::memory_order_release);
+    record->claimed.store(0, std::memory_order_release);
+    t_epochRecord = nullptr;
+}
+
+// ==========================================================================
+// READ SIDE
+// ==========================================================================
+
+void EpochManager::enter() noexcept {
+    ThreadRecord* record = threadRecord();
+    if (AARENDOCORE_UNLIKELY(!record)) {
+        // Unregistered readers hold the epoch still as a group
+        if (t_unregisteredNesting++ == 0) {
+            unregisteredReaders_.fetch_add(1, std::memory_order_seq_cst);
+        }
+        return;
+    }
+    if (record->nesting++ != 0) {
+        return;
+    }
+
+    // PSYCHOTIC: The announcement must be visible before any pointer load -
+    // the one store->load order x86 does not give for free. A seq_cst store
+    // is a single XCHG, cheaper than MOV + MFENCE.
+    record->state.store((globalEpoch_.load(std::memory_order_relaxed) << 1) | EPOCH_ACTIVE,
+                        std::memory_order_seq_cst);
+}
+
+void EpochManager::exit() noexcept {
+    ThreadRecord* record = static_cast<ThreadRecord*>(t_epochRecord);
+    if (AARENDOCORE_UNLIKELY(!record)) {
+        AARENDOCORE_ASSERT(t_unregisteredNesting > 0);
+        if (--t_unregisteredNesting == 0) {
+            unregisteredReaders_.fetch_sub(1, std::memory_order_release);
+        }
+        return;
+    }
+    AARENDOCORE_ASSERT(record->nesting > 0);
+
+    if (--record->nesting == 0) {
+        record->state.store(0, std::memory_order_release);
+    }
+}
+
+// ==========================================================================
+// WRITE SIDE
+// ==========================================================================
+
+void EpochManager::retire(void* object, ReclaimFunc reclaimFunc, void* context) noexcept {
+    if (!object || !reclaimFunc) {
+        return;
+    }
+
+    ThreadRecord* record = threadRecord();
+    if (AARENDOCORE_UNLIKELY(!record)) {
+        RetiredObject retiredItem = { object, reclaimFunc, context, stamp() };
+        totalRetired_.fetch_add(1, std::memory_order_relaxed);
+        orphan(&retiredItem, 1);
+        if (++t_unregisteredRetires >= EPOCH_RECLAIM_BATCH) {
+            t_unregisteredRetires = 0;
+            tryAdvance();
+            reclaimOrphans();
+        }
+        return;
+    }
+
+    if (record->overflowCount > 0 || record->tail - record->head >= EPOCH_RETIRE_CAPACITY) {
+        tryAdvance();
+        reclaim(record);
+    }
+
+    // Ring full outside a section - other readers leave, so a grace period
+    // completes and the wait is finite
+    if (record->nesting == 0) {
+        while (record->tail - record->head >= EPOCH_RETIRE_CAPACITY) {
+            tryAdvance();
+            if (reclaim(record) == 0) {
+                _mm_pause();
+            }
+        }
+    }
+
+    RetiredObject retiredItem = { object, reclaimFunc, context, stamp() };
+    totalRetired_.fetch_add(1, std::memory_order_relaxed);
+
+    // PSYCHOTIC: Inside a section our own announcement pins the epoch, so
+    // waiting for room would never end. Spill behind the ring instead;
+    // reclaim() moves the overflow back in order as the ring drains.
+    if (record->overflowCount > 0 || record->tail - record->head >= EPOCH_RETIRE_CAPACITY) {
+        if (!record->overflow) {
+            record->overflow = new(std::nothrow) RetiredObject[EPOCH_OVERFLOW_CAPACITY];
+        }
+        if (record->overflow && record->overflowCount < EPOCH_OVERFLOW_CAPACITY) {
+            record->overflow[record->overflowCount++] = retiredItem;
+        } else {
+            orphan(&retiredItem, 1);  // Stamped, so order no longer matters
+        }
+        return;
+    }
+
+    record->retired[record->tail % EPOCH_RETIRE_CAPACITY] = retiredItem;
+    ++record->tail;
+
+    // Amortize: one scan of the thread records per batch of retirements
+    if (++record->sinceCollect >= EPOCH_RECLAIM_BATCH) {
+        record->sinceCollect = 0;
+        tryAdvance();
+        reclaim(record);
+        reclaimOrphans();
+    }
+}
+
+u32 EpochManager::collect() noexcept {
+    ThreadRecord* record = threadRecord();
+    tryAdvance();
+    u32 freed = reclaimOrphans();
+    return record ? freed + reclaim(record) : freed;
+}
+
+void EpochManager::drain() noexcept {
+    ThreadRecord* record = threadRecord();
+    AARENDOCORE_ASSERT(record ? record->nesting == 0 : t_unregisteredNesting == 0);
+
+    // Orphans included - ours may sit among them
+    while ((record && (record->head < record->tail || record->overflowCount > 0)) ||
+           orphans_.load(std::memory_order_acquire) != nullptr) {
+        if (collect() == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+u64 EpochManager::safeEpoch() noexcept {
+    tryAdvance();
+    // stamp + 2 <= global  <=>  stamp < global - 1
+    return globalEpoch_.load(std::memory_order_acquire) - 1;
+}
+
+bool EpochManager::tryAdvance() noexcept {
+    u64 epoch = globalEpoch_.load(std::memory_order_acquire);
+    const u32 high = highWater_.load(std::memory_order_acquire);
+
+    // Their entry epochs are unknown - any one inside holds the epoch
+    if (unregisteredReaders_.load(std::memory_order_seq_cst) != 0) {
+        return false;
+    }
+
+    for (u32 i = 0; i < high; ++i) {
+        const u64 state = records_[i].state.load(std::memory_order_acquire);
+        if ((state & EPOCH_ACTIVE) && (state >> 1) != epoch) {
+            return false;  // A reader is still in the previous epoch
+        }
+    }
+
+    // Losing the race means someone else advanced - same outcome
+    globalEpoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+    return true;
+}
+
+u32 EpochManager::reclaim(ThreadRecord* record) noexcept {
+    const u64 epoch = globalEpoch_.load(std::memory_order_acquire);
+    u32 freed = 0;
+
+    // Retirements are in epoch order - stop at the first one still visible.
+    // Overflow entries are newer than the ring, so they refill it in order.
+    for (;;) {
+        while (record->head < record->tail) {
+            RetiredObject& item = record->retired[record->head % EPOCH_RETIRE_CAPACITY];
+            if (item.epoch + 2 > epoch) {
+                break;
+            }
+            item.reclaim(item.object, item.context);
+            ++record->head;
+            ++freed;
+        }
+
+        if (record->overflowCount == 0 || record->tail - record->head >= EPOCH_RETIRE_CAPACITY) {
+            break;
+        }
+        spillOverflow(record);
+    }
+
+    if (freed > 0) {
+        totalReclaimed_.fetch_add(freed, std::memory_order_relaxed);
+    }
+    return freed;
+}
+
+void EpochManager::spillOverflow(ThreadRecord* record) noexcept {
+    u32 room = static_cast<u32>(EPOCH_RETIRE_CAPACITY - (record->tail - record->head));
+    u32 moved = (record->overflowCount < room) ? record->overflowCount : room;
+
+    for (u32 i = 0; i < moved; ++i) {
+        record->retired[record->tail % EPOCH_RETIRE_CAPACITY] = record->overflow[i];
+        ++record->tail;
+    }
+
+    record->overflowCount -= moved;
+    std::memmove(record->overflow, record->overflow + moved,
+                 sizeof(RetiredObject) * record->overflowCount);
+}
+
+// ==========================================================================
+// ORPHANS
+// ==========================================================================
+// PSYCHOTIC PRECISION: Retirements nobody's ring can hold - an exiting
+// thread's backlog, an overflow that filled, an unregistered thread's -
+// go on one global stack of stamped batches. Collectors take the whole
+// stack with one exchange (no ABA), free what expired and push back the
+// rest. Only a failed allocation leaves an object unfreed, and that is
+// counted in getTotalLeaked().
+
+bool EpochManager::orphan(const RetiredObject* items, u32 count) noexcept {
+    OrphanBatch* batch = new(std::nothrow) OrphanBatch;
+    RetiredObject* copy = batch ? new(std::nothrow) RetiredObject[count] : nullptr;
+    if (!copy) {
+        delete batch;
+        AARENDOCORE_ASSERT(false);
+        totalLeaked_.fetch_add(count, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::memcpy(copy, items, sizeof(RetiredObject) * count);
+    batch->items = copy;
+    batch->count = count;
+    pushOrphans(batch);
+    return true;
+}
+
+void EpochManager::orphanRecord(ThreadRecord* record) noexcept {
+    const u32 pending = static_cast<u32>(record->tail - record->head) + record->overflowCount;
+    if (pending == 0) {
+        return;
+    }
+
+    OrphanBatch* batch = new(std::nothrow) OrphanBatch;
+    RetiredObject* items = batch ? new(std::nothrow) RetiredObject[pending] : nullptr;
+    if (!items) {
+        // No memory - they stay in the slot for its next owner, or teardown
+        delete batch;
+        return;
+    }
+
+    u32 count = 0;
+    for (; record->head < record->tail; ++record->head) {
+        items[count++] = record->retired[record->head % EPOCH_RETIRE_CAPACITY];
+    }
+    for (u32 i = 0; i < record->overflowCount; ++i) {
+        items[count++] = record->overflow[i];
+    }
+    record->overflowCount = 0;
+
+    batch->items = items;
+    batch->count = count;
+    pushOrphans(batch);
+}
+
+void EpochManager::pushOrphans(OrphanBatch* batch) noexcept {
+    OrphanBatch* head = orphans_.load(std::memory_order_relaxed);
+    do {
+        batch->next = head;
+    } while (!orphans_.compare_exchange_weak(head, batch, std::memory_order_release,
+                                             std::memory_order_relaxed));
+}
+
+u32 EpochManager::reclaimOrphans() noexcept {
+    if (orphans_.load(std::memory_order_relaxed) == nullptr) {
+        return 0;
+    }
+
+    OrphanBatch* batch = orphans_.exchange(nullptr, std::memory_order_acquire);
+    const u64 epoch = globalEpoch_.load(std::memory_order_acquire);
+    u32 freed = 0;
+
+    while (batch) {
+        OrphanBatch* next = batch->next;
+
+        u32 kept = 0;
+        for (u32 i = 0; i < batch->count; ++i) {
+            RetiredObject& item = batch->items[i];
+            if (item.epoch + 2 <= epoch) {
+                item.reclaim(item.object, item.context);
+                ++freed;
+            } else {
+                batch->items[kept++] = item;
+            }
+        }
+
+        if (kept == 0) {
+            delete[] batch->items;
+            delete batch;
+        } else {
+            batch->count = kept;
+            pushOrphans(batch);
+        }
+        batch = next;
+    }
+
+    if (freed > 0) {
+        totalReclaimed_.fetch_add(freed, std::memory_order_relaxed);
+    }
+    return freed;
+}
+
+EpochManager& GetEpochManager() noexcept {
+    static EpochManager manager;
+    return manager;
+}
+
+// ==========================================================================
+// LOOKUP BENCHMARK
+// ==========================================================================
+
+namespace {
+
+constexpr u32 BENCH_SLOTS = 1024;
+constexpr u64 BENCH_MAGIC = 0xA5A5C0DEF00DBEEFull;
+
+struct alignas(64) BenchObject {
+    u64 key;
+    u64 magic;
+};
+
+struct alignas(64) BenchSlotLock {
+    std::atomic<bool> locked{false};
+    void lock() noexcept {
+        while (locked.exchange(true, std::memory_order_acquire)) {
+            _mm_pause();
+        }
+    }
+    void unlock() noexcept { locked.store(false, std::memory_order_release); }
+};
+
+} // anonymous namespace
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestEpochLookupPerformance(
+    u32 readerThreads, u32 lookupsPerReader, u32 useEpoch, u64* reclaimed) {
+    if (readerThreads == 0 || readerThreads > 64) {
+        readerThreads = 4;
+    }
+    if (lookupsPerReader == 0) {
+        lookupsPerReader = 1000000;  // Default 1M lookups per reader
+    }
+
+    std::atomic<BenchObject*>* table = new(std::nothrow) std::atomic<BenchObject*>[BENCH_SLOTS];
+    BenchSlotLock* locks = new(std::nothrow) BenchSlotLock[BENCH_SLOTS];
+    if (!table || !locks) {
+        delete[] table;
+        delete[] locks;
+        return 0;
+    }
+
+    for (u32 i = 0; i < BENCH_SLOTS; ++i) {
+        table[i].store(new BenchObject{i, BENCH_MAGIC}, std::memory_order_relaxed);
+    }
+
+    EpochManager& epochs = GetEpochManager();
+    const u64 reclaimedBefore = epochs.getTotalReclaimed();
+    std::atomic<u32> readersDone{0};
+    std::atomic<u64> totalNs{0};
+    std::atomic<u64> corrupt{0};
+
+    // Churn: replace objects as fast as possible while readers look them up
+    std::thread churn([&]() {
+        u64 seed = 0x9E3779B97F4A7C15ull;
+        while (readersDone.load(std::memory_order_acquire) < readerThreads) {
+            seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+            const u32 slot = static_cast<u32>(seed) & (BENCH_SLOTS - 1);
+            BenchObject* fresh = new BenchObject{slot, BENCH_MAGIC};
+
+            if (useEpoch) {
+                BenchObject* old = table[slot].exchange(fresh, std::memory_order_acq_rel);
+                EpochRetire(old);
+            } else {
+                locks[slot].lock();
+                BenchObject* old = table[slot].exchange(fresh, std::memory_order_acq_rel);
+                old->magic = 0;  // Poison - a lock-free reader would now see it
+                locks[slot].unlock();
+                delete old;
+            }
+        }
+        if (useEpoch) {
+            epochs.drain();
+        }
+    });
+
+    std::thread* readers = new std::thread[readerThreads];
+    for (u32 r = 0; r < readerThreads; ++r) {
+        readers[r] = std::thread([&, r]() {
+            u64 seed = 0xD1B54A32D192ED03ull * (r + 1);
+            u64 bad = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (u32 i = 0; i < lookupsPerReader; ++i) {
+                seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+                const u32 slot = static_cast<u32>(seed) & (BENCH_SLOTS - 1);
+
+                if (useEpoch) {
+                    EpochGuard guard;
+                    const BenchObject* object = table[slot].load(std::memory_order_acquire);
+                    bad += (object->magic != BENCH_MAGIC || object->key != slot);
+                } else {
+                    locks[slot].lock();
+                    const BenchObject* object = table[slot].load(std::memory_order_acquire);
+                    bad += (object->magic != BENCH_MAGIC || object->key != slot);
+                    locks[slot].unlock();
+                }
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+            totalNs.fetch_add(static_cast<u64>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()),
+                std::memory_order_relaxed);
+            corrupt.fetch_add(bad, std::memory_order_relaxed);
+            readersDone.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    for (u32 r = 0; r < readerThreads; ++r) {
+        readers[r].join();
+    }
+    churn.join();
+    delete[] readers;
+
+    for (u32 i = 0; i < BENCH_SLOTS; ++i) {
+        delete table[i].load(std::memory_order_relaxed);
+    }
+    delete[] table;
+    delete[] locks;
+
+    if (reclaimed) {
+        *reclaimed = epochs.getTotalReclaimed() - reclaimedBefore;
+    }
+
+    // A torn read means reclamation is broken - report it as a failed run
+    if (corrupt.load() != 0) {
+        return 0;
+    }
+
+    return totalNs.load() / (static_cast<u64>(readerThreads) * lookupsPerReader);
+}
+
+} // namespace AARendoCoreGLM
@@ -0,0 +1,168 @@
+//===--- Core_EpochReclaim.h - Epoch-Based Memory Reclamation -----------===//
+//
+// COMPILATION LEVEL: 1 (Depends on Platform and Types only)
+// ORIGIN: NEW - Lock-free readers for topics, sessions and DAG executions
+// DEPENDENCIES: Core_Platform.h, Core_Types.h
+// DEPENDENTS: MessageBroker, SessionManager, DAGExecutor
+//
+// Readers enter an epoch, follow raw pointers with plain loads, and leave.
+// Writers unlink an object and retire() it; it is freed only after every
+// thread has passed through two epoch changes, so no reader can still hold
+// it. Retired objects sit in per-thread rings and are reclaimed in batches
+// - no locks, refcounts or allocation on either side of the hot path.
+// Threads beyond MAX_EPOCH_THREADS run unregistered on a slower shared path
+// instead of waiting for a slot; what an exiting thread still holds is
+// handed to a global orphan list rather than waited for.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_EPOCHRECLAIM_H
+#define AARENDOCORE_CORE_EPOCHRECLAIM_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include <atomic>
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// CONFIGURATION
+// ==========================================================================
+
+constexpr u32 MAX_EPOCH_THREADS = 512;          // Registered threads at once - a full pool plus callers
+constexpr u32 EPOCH_RETIRE_CAPACITY = 8192;     // Deferred frees per thread
+constexpr u32 EPOCH_OVERFLOW_CAPACITY = 8192;   // Spill when the ring fills inside a section
+constexpr u32 EPOCH_RECLAIM_BATCH = 64;         // Retires between reclaim passes
+
+// Origin: Deferred destructor - object plus caller context (pool, owner)
+typedef void (*ReclaimFunc)(void* object, void* context);
+
+// ==========================================================================
+// EPOCH MANAGER
+// ==========================================================================
+
+// Origin: Classic three-epoch EBR (Fraser) with per-thread limbo rings
+// Scope: Process-wide singleton, threads register on first use
+class EpochManager {
+public:
+    EpochManager() noexcept;
+    ~EpochManager() noexcept;
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    // Critical section - nestable, pointers read inside stay valid until exit
+    void enter() noexcept;
+    void exit() noexcept;
+
+    // Defer reclaim(object, context) until no reader can hold object.
+    // The caller must already have unlinked it from every shared structure.
+    // Never waits inside a critical section - the caller's own announcement
+    // would hold the epoch, so a full ring spills to a bounded overflow list
+    // and from there to the orphan list.
+    void retire(void* object, ReclaimFunc reclaim, void* context = nullptr) noexcept;
+
+    // Try to advance the epoch and free this thread's expired retirements
+    u32 collect() noexcept;
+
+    // Block until everything this thread retired has been freed, orphans
+    // included. Must be called outside any critical section.
+    void drain() noexcept;
+
+    // Pool-owned deferral - for pools that keep retired slots on their own
+    // limbo list. Stamp an object after unlinking it; it may be reused once
+    // its stamp is below safeEpoch().
+    u64 stamp() const noexcept { return globalEpoch_.load(std::memory_order_seq_cst); }
+    u64 safeEpoch() noexcept;
+
+    u64 getEpoch() const noexcept { return globalEpoch_.load(std::memory_order_relaxed); }
+    u64 getTotalRetired() const noexcept { return totalRetired_.load(std::memory_order_relaxed); }
+    u64 getTotalReclaimed() const noexcept { return totalReclaimed_.load(std::memory_order_relaxed); }
+    u64 getTotalLeaked() const noexcept { return totalLeaked_.load(std::memory_order_relaxed); }
+    u64 getUnregisteredThreads() const noexcept { return unregisteredThreads_.load(std::memory_order_relaxed); }
+
+    // Internal - thread exit orphans its pending retirements, never waits
+    void releaseThread() noexcept;
+
+private:
+    struct RetiredObject {
+        void* object;
+        ReclaimFunc reclaim;
+        void* context;
+        u64 epoch;
+    };
+
+    struct alignas(64) ThreadRecord {
+        std::atomic<u64> state;         // (epoch << 1) | 1 while inside, 0 outside
+        std::atomic<u32> claimed;       // Slot owned by a live thread
+        u32 nesting;
+        u32 sinceCollect;
+        RetiredObject* retired;         // Ring, allocated once per slot
+        u64 head;                       // Oldest retirement
+        u64 tail;                       // Next free
+        RetiredObject* overflow;        // Newer than the ring, on first spill
+        u32 overflowCount;
+    };
+
+    struct OrphanBatch {
+        OrphanBatch* next;
+        RetiredObject* items;
+        u32 count;
+    };
+
+    ThreadRecord* threadRecord() noexcept;
+    bool tryAdvance() noexcept;
+    u32 reclaim(ThreadRecord* record) noexcept;
+    void spillOverflow(ThreadRecord* record) noexcept;
+    bool orphan(const RetiredObject* items, u32 count) noexcept;
+    void orphanRecord(ThreadRecord* record) noexcept;
+    void pushOrphans(OrphanBatch* batch) noexcept;
+    u32 reclaimOrphans() noexcept;
+
+    alignas(64) std::atomic<u64> globalEpoch_;
+    alignas(64) std::atomic<u64> totalRetired_;
+    std::atomic<u64> totalReclaimed_;
+    std::atomic<u64> totalLeaked_;      // Orphan allocation failed - never freed
+    std::atomic<u64> unregisteredThreads_;
+    alignas(64) std::atomic<u32> unregisteredReaders_;  // Inside a section, no slot
+    alignas(64) std::atomic<OrphanBatch*> orphans_;
+    std::atomic<u32> highWater_;        // Slots ever claimed - bounds the scan
+    ThreadRecord records_[MAX_EPOCH_THREADS];
+};
+
+// Process-wide instance
+EpochManager& GetEpochManager() noexcept;
+
+// ==========================================================================
+// RAII HELPERS
+// ==========================================================================
+
+// Origin: Scope guard for a read-side critical section
+class EpochGuard {
+public:
+    EpochGuard() noexcept { GetEpochManager().enter(); }
+    ~EpochGuard() noexcept { GetEpochManager().exit(); }
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+// Origin: Retire an object allocated with new
+template<typename T>
+inline void EpochRetire(T* object) noexcept {
+    GetEpochManager().retire(object, [](void* p, void*) { delete static_cast<T*>(p); });
+}
+
+// ==========================================================================
+// EXPORTS
+// ==========================================================================
+
+extern "C" {
+    // Lookups under create/destroy churn: epoch readers vs lock-holding readers.
+    // Returns average ns per lookup; reclaimed counts objects freed by EBR.
+    AARENDOCORE_API u64 AARendoCore_TestEpochLookupPerformance(
+        u32 readerThreads, u32 lookupsPerReader, u32 useEpoch, u64* reclaimed);
+}
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_EPOCHRECLAIM_H
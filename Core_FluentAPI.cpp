@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "Core_FluentAPI.h"
+#include "Core_Trace.h"
 #include <algorithm>  // std::find
 
 AARENDOCORE_NAMESPACE_BEGIN
@@ -189,6 +190,10 @@ void FluentAPI::stop() noexcept {
 bool FluentAPI::processTick(u32 streamId, const Tick& tick) noexcept {
     if (!isStarted_) return false;
     
+    // Outermost span of a tick's journey - synchronizer, callback and
+    // whatever the callback publishes nest inside it
+    AARENDOCORE_TRACE_SCOPE(API, API_PROCESS_TICK, streamId, tick.timestamp);
+    
     // Update stream with tick
     if (synchronizer_ && !synchronizer_->updateStream(streamId, tick)) {
         if (onError_) onError_("Failed to update stream with tick");
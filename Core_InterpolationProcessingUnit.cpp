@@ -2,13 +2,15 @@
 //
 // COMPILATION LEVEL: 4
 // ORIGIN: Implementation for Core_InterpolationProcessingUnit.h
-// DEPENDENCIES: Core_InterpolationProcessingUnit.h, Core_AVX2Math.h
+// DEPENDENCIES: Core_InterpolationProcessingUnit.h, Core_AVX2Math.h, Core_SIMDDispatch.h
 // DEPENDENTS: None
 //
 // FULL interpolation implementation - EVERY METHOD WITH PSYCHOTIC PRECISION!
 //===----------------------------------------------------------------------===//
 
 #include "Core_InterpolationProcessingUnit.h"
+#include "Core_SIMDDispatch.h"
+#include "Core_Trace.h"
 #include <cstring>
 #include <algorithm>
 #include <cmath>
@@ -27,6 +29,8 @@ InterpolationProcessingUnit::InterpolationProcessingUnit(i32 numaNode) noexcept
                         CAP_STATEFUL | CAP_LOCK_FREE | CAP_ZERO_COPY,
                         numaNode)
     , interpConfig_{}
+    , publishedInterpConfig_()
+    , interpConfigVersion_(0)
     , stats_{}
     , streamBuffers_{}
     , bufferPositions_{}
@@ -124,8 +128,19 @@ InterpolationProcessingUnit::~InterpolationProcessingUnit() noexcept {
 // ==========================================================================
 
 // Origin: Process single tick - add to interpolation buffer
-ProcessResult InterpolationProcessingUnit::processTick([[maybe_unused]] SessionId sessionId,
+ProcessResult InterpolationProcessingUnit::processTick(SessionId sessionId,
                                                        const Tick& tick) noexcept {
+    AARENDOCORE_TRACE_SCOPE(INTERPOLATION_UNIT, UNIT_PROCESS_TICK, getId(), tick.timestamp);
+    
+    // A single tick is its own batch boundary
+    adoptInterpConfig();
+    
+    return processTickInBatch(sessionId, tick);
+}
+
+// Origin: Add tick to interpolation buffer under the adopted configuration
+ProcessResult InterpolationProcessingUnit::processTickInBatch([[maybe_unused]] SessionId sessionId,
+                                                              const Tick& tick) noexcept {
     // Determine stream (for now use stream 0)
     u32 streamId = 0;
     
@@ -211,6 +226,11 @@ ProcessResult InterpolationProcessingUnit::processBatch([[maybe_unused]] Session
         return ProcessResult::FAILED;
     }
     
+    AARENDOCORE_TRACE_SCOPE(INTERPOLATION_UNIT, UNIT_PROCESS_BATCH, getId(), count);
+    
+    // Batch boundary - the whole batch runs under one configuration
+    adoptInterpConfig();
+    
     // Convert ticks to interpolated points
     InterpolatedPoint* points = static_cast<InterpolatedPoint*>(
         _aligned_malloc(count * sizeof(InterpolatedPoint), 32));
@@ -320,6 +340,9 @@ ProcessResult InterpolationProcessingUnit::processStream([[maybe_unused]] Sessio
     
     const f64* values = reinterpret_cast<const f64*>(&streamData.payload[8]);
     
+    // The packet is one batch
+    adoptInterpConfig();
+    
     // Process as time series
     for (u32 i = 0; i < pointCount; ++i) {
         Tick tick;
@@ -328,7 +351,7 @@ ProcessResult InterpolationProcessingUnit::processStream([[maybe_unused]] Sessio
         tick.volume = 0.0;
         tick.flags = 0;
         
-        processTick(sessionId, tick);
+        processTickInBatch(sessionId, tick);
     }
     
     return ProcessResult::SUCCESS;
@@ -348,19 +371,40 @@ ResultCode InterpolationProcessingUnit::configureInterpolation(
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
     
-    interpConfig_ = config;
+    // Publish only - the processing thread adopts it at its next boundary
+    if (publishedInterpConfig_.publish(config) == 0) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
+    
+    return ResultCode::SUCCESS;
+}
+
+// Origin: Adopt the latest published interpolation configuration
+void InterpolationProcessingUnit::adoptInterpConfig() noexcept {
+    if (!publishedInterpConfig_.refresh(interpConfig_, interpConfigVersion_)) {
+        return;
+    }
     
-    // Reset statistics
+    // Reset statistics - they describe the configuration that produced them
     stats_.pointsInterpolated.store(0, std::memory_order_relaxed);
     stats_.gapsDetected.store(0, std::memory_order_relaxed);
     
-    return ResultCode::SUCCESS;
+    AARENDOCORE_TRACE_INSTANT(INTERPOLATION_UNIT, UNIT_CONFIG_ADOPTED, getId(), interpConfigVersion_);
 }
 
-// Origin: Interpolate single stream with FULL implementation
-u32 InterpolationProcessingUnit::interpolateStream(u32 streamId, u64 startTime, 
+// Origin: Interpolate single stream
+u32 InterpolationProcessingUnit::interpolateStream(u32 streamId, u64 startTime,
                                                    u64 endTime,
                                                    InterpolatedPoint* output) noexcept {
+    adoptInterpConfig();
+    
+    return interpolateStreamInBatch(streamId, startTime, endTime, output);
+}
+
+// Origin: Interpolate single stream with FULL implementation
+u32 InterpolationProcessingUnit::interpolateStreamInBatch(u32 streamId, u64 startTime, 
+                                                          u64 endTime,
+                                                          InterpolatedPoint* output) noexcept {
     if (streamId >= MAX_STREAMS || !output || endTime <= startTime) {
         return 0;
     }
@@ -449,6 +493,9 @@ u32 InterpolationProcessingUnit::interpolateMultiStream(const u32* streamIds, u3
         return 0;
     }
     
+    // All streams of one call share a configuration
+    adoptInterpConfig();
+    
     u32 totalInterpolated = 0;
     
     if (interpConfig_.enableCrossStream && count > 1) {
@@ -460,7 +507,7 @@ u32 InterpolationProcessingUnit::interpolateMultiStream(const u32* streamIds, u3
         // Independent stream interpolation
         for (u32 i = 0; i < count; ++i) {
             if (streamIds[i] < MAX_STREAMS && outputs[i]) {
-                u32 interpolated = interpolateStream(
+                u32 interpolated = interpolateStreamInBatch(
                     streamIds[i], startTime, endTime, outputs[i]);
                 totalInterpolated += interpolated;
             }
@@ -671,55 +718,32 @@ u32 InterpolationProcessingUnit::interpolateAVX2(const InterpolatedPoint* points
         return 0;
     }
     
+    // Values are strided inside InterpolatedPoint - gather them into
+    // contiguous chunks (overlapping by one point) for the midpoint kernel
+    constexpr u32 CHUNK = 256;
+    alignas(64) f64 values[CHUNK];
+    alignas(64) f64 midValues[CHUNK];
+    
+    const SIMDKernels& kernels = GetSIMDKernels();
     u32 interpolated = 0;
     
-    // Process 4 points at a time
-    for (u32 i = 0; i <= count - 4; i += 4) {
-        // Load values
-        __m256d values = _mm256_set_pd(
-            points[i + 3].value,
-            points[i + 2].value,
-            points[i + 1].value,
-            points[i + 0].value
-        );
-        
-        // Load timestamps as doubles
-        __m256d timestamps = _mm256_set_pd(
-            static_cast<f64>(points[i + 3].timestamp),
-            static_cast<f64>(points[i + 2].timestamp),
-            static_cast<f64>(points[i + 1].timestamp),
-            static_cast<f64>(points[i + 0].timestamp)
-        );
-        
-        // Calculate intervals
-        __m256d intervals = _mm256_set_pd(
-            static_cast<f64>(points[i + 3].timestamp - points[i + 2].timestamp),
-            static_cast<f64>(points[i + 2].timestamp - points[i + 1].timestamp),
-            static_cast<f64>(points[i + 1].timestamp - points[i + 0].timestamp),
-            0.0
-        );
-        
-        // Linear interpolation for midpoints
-        __m256d midValues = _mm256_mul_pd(
-            _mm256_add_pd(values, _mm256_permute4x64_pd(values, 0x39)),
-            _mm256_set1_pd(0.5)
-        );
+    for (u32 base = 0; base + 1 < count; base += CHUNK - 1) {
+        const u32 n = std::min(CHUNK, count - base);
+        for (u32 j = 0; j < n; ++j) {
+            values[j] = points[base + j].value;
+        }
         
-        // Store results
-        alignas(32) f64 results[4];
-        _mm256_store_pd(results, midValues);
+        kernels.midpoints(values, midValues, n);
         
         // Create interpolated points
-        for (u32 j = 0; j < 3; ++j) {
-            if (interpolated < count) {
-                output[interpolated].timestamp = 
-                    (points[i + j].timestamp + points[i + j + 1].timestamp) / 2;
-                output[interpolated].value = results[j];
-                output[interpolated].confidence = 0.9;
-                output[interpolated].methodUsed = InterpolationMethod::LINEAR;
-                output[interpolated].isOriginal = false;
-                interpolated++;
-            }
+        for (u32 j = 0; j + 1 < n; ++j) {
+            output[interpolated].timestamp =
+                (points[base + j].timestamp + points[base + j + 1].timestamp) / 2;
+            output[interpolated].value = midValues[j];
+            output[interpolated].confidence = 0.9;
+            output[interpolated].methodUsed = InterpolationMethod::LINEAR;
+            output[interpolated].isOriginal = false;
+            interpolated++;
         }
     }
     
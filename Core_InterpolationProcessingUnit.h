@@ -187,9 +187,15 @@ private:
     // MEMBER VARIABLES - PSYCHOTICALLY ALIGNED
     // ======================================================================
     
-    // Origin: Member - Interpolation configuration, Scope: Instance lifetime
+    // Origin: Member - Interpolation configuration in use, Scope: Adopted at batch boundaries
     InterpolationConfig interpConfig_;
     
+    // Origin: Member - Latest configureInterpolation snapshot, Scope: Instance lifetime
+    VersionedConfig<InterpolationConfig> publishedInterpConfig_;
+    
+    // Origin: Member - Version interpConfig_ was copied from, Scope: Processing thread
+    u64 interpConfigVersion_;
+    
     // Origin: Member - Interpolation statistics, Scope: Instance lifetime
     mutable InterpolationStatistics stats_;
     
@@ -243,6 +249,16 @@ private:
     f64 akimaInterpolate(const InterpolatedPoint* points, 
                         f64 t) const noexcept;
     
+    // Origin: Pick up a configureInterpolation published since the last batch
+    void adoptInterpConfig() noexcept;
+    
+    // Origin: processTick body without adopting a new configuration
+    ProcessResult processTickInBatch(SessionId sessionId, const Tick& tick) noexcept;
+    
+    // Origin: interpolateStream body without adopting a new configuration
+    u32 interpolateStreamInBatch(u32 streamId, u64 startTime, u64 endTime,
+                                 InterpolatedPoint* output) noexcept;
+    
     // Origin: Detect gaps in time series
     // Input: streamId - Stream to check
     // Output: Number of gaps detected
@@ -306,7 +322,8 @@ public:
     // INTERPOLATION-SPECIFIC METHODS
     // ======================================================================
     
-    // Origin: Configure interpolation
+    // Origin: Configure interpolation - safe while processing, takes effect
+    // (and restarts the statistics) at the start of the next batch
     // Input: config - Interpolation configuration
     // Output: ResultCode
     ResultCode configureInterpolation(const InterpolationConfig& config) noexcept;
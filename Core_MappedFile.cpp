@@ -0,0 +1,243 @@
+//===--- Core_MappedFile.cpp - Memory-Mapped File -------------------------===//
+//
+// COMPILATION LEVEL: 1
+// ORIGIN: Implementation for Core_MappedFile.h
+// DEPENDENCIES: Core_MappedFile.h
+// DEPENDENTS: None
+//===----------------------------------------------------------------------===//
+
+#include "Core_MappedFile.h"
+
+#if AARENDOCORE_PLATFORM_WINDOWS
+    #include <windows.h>
+    #include <winioctl.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace AARendoCoreGLM {
+
+MappedFile::MappedFile() noexcept
+    : view_(nullptr)
+    , size_(0)
+#if AARENDOCORE_PLATFORM_WINDOWS
+    , file_(nullptr)
+    , mapping_(nullptr) {
+#else
+    , fd_(-1) {
+#endif
+}
+
+MappedFile::~MappedFile() noexcept {
+    close();
+}
+
+#if AARENDOCORE_PLATFORM_WINDOWS
+
+// ==========================================================================
+// WINDOWS
+// ==========================================================================
+
+bool MappedFile::open(const char* path, u64 minSize, bool truncate) noexcept {
+    if (file_ || !path) {
+        return false;
+    }
+
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                              nullptr, truncate ? CREATE_ALWAYS : OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // Sparse, so extending the file does not zero-fill it on disk
+    DWORD returned = 0;
+    DeviceIoControl(file, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &returned, nullptr);
+
+    LARGE_INTEGER current;
+    if (!GetFileSizeEx(file, &current)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    file_ = file;
+    u64 size = static_cast<u64>(current.QuadPart);
+    if (!map(size > minSize ? size : minSize)) {
+        CloseHandle(file);
+        file_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() noexcept {
+    unmap();
+    if (file_) {
+        CloseHandle(static_cast<HANDLE>(file_));
+        file_ = nullptr;
+    }
+}
+
+bool MappedFile::map(u64 size) noexcept {
+    if (size == 0) {
+        return false;
+    }
+
+    // Mapping past the end extends the file
+    HANDLE mapping = CreateFileMappingA(static_cast<HANDLE>(file_), nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(size >> 32),
+                                        static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+    if (!mapping) {
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    mapping_ = mapping;
+    view_ = static_cast<u8*>(view);
+    size_ = size;
+    return true;
+}
+
+void MappedFile::unmap() noexcept {
+    if (view_) {
+        UnmapViewOfFile(view_);
+        view_ = nullptr;
+    }
+    if (mapping_) {
+        CloseHandle(static_cast<HANDLE>(mapping_));
+        mapping_ = nullptr;
+    }
+    size_ = 0;
+}
+
+bool MappedFile::flush(u64 offset, u64 length, bool sync) noexcept {
+    if (!view_ || offset >= size_) {
+        return false;
+    }
+    if (length > size_ - offset) {
+        length = size_ - offset;
+    }
+
+    if (!FlushViewOfFile(view_ + offset, static_cast<SIZE_T>(length))) {
+        return false;
+    }
+    return !sync || FlushFileBuffers(static_cast<HANDLE>(file_)) != FALSE;
+}
+
+#else
+
+// ==========================================================================
+// POSIX
+// ==========================================================================
+
+bool MappedFile::open(const char* path, u64 minSize, bool truncate) noexcept {
+    if (fd_ >= 0 || !path) {
+        return false;
+    }
+
+    int fd = ::open(path, O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    fd_ = fd;
+    u64 size = static_cast<u64>(info.st_size);
+    if (!map(size > minSize ? size : minSize)) {
+        ::close(fd);
+        fd_ = -1;
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() noexcept {
+    unmap();
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool MappedFile::map(u64 size) noexcept {
+    if (size == 0) {
+        return false;
+    }
+
+    // ftruncate leaves a hole - no blocks until written
+    struct stat info;
+    if (fstat(fd_, &info) != 0) {
+        return false;
+    }
+    if (static_cast<u64>(info.st_size) < size &&
+        ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+        return false;
+    }
+
+    void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+
+    view_ = static_cast<u8*>(view);
+    size_ = size;
+    return true;
+}
+
+void MappedFile::unmap() noexcept {
+    if (view_) {
+        munmap(view_, size_);
+        view_ = nullptr;
+    }
+    size_ = 0;
+}
+
+bool MappedFile::flush(u64 offset, u64 length, bool sync) noexcept {
+    if (!view_ || offset >= size_) {
+        return false;
+    }
+    if (length > size_ - offset) {
+        length = size_ - offset;
+    }
+
+    // msync wants a page-aligned start
+    u64 start = offset & ~static_cast<u64>(PAGE_SIZE - 1);
+    return msync(view_ + start, length + (offset - start),
+                 sync ? MS_SYNC : MS_ASYNC) == 0;
+}
+
+#endif
+
+bool MappedFile::grow(u64 newSize) noexcept {
+    if (!view_) {
+        return false;
+    }
+    if (newSize <= size_) {
+        return true;
+    }
+
+    u64 oldSize = size_;
+    unmap();
+    if (map(newSize)) {
+        return true;
+    }
+
+    // Keep the old view usable if the new size cannot be had
+    map(oldSize);
+    return false;
+}
+
+} // namespace AARendoCoreGLM
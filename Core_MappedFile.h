@@ -0,0 +1,67 @@
+//===--- Core_MappedFile.h - Memory-Mapped File ---------------------------===//
+//
+// COMPILATION LEVEL: 1 (Depends on Platform and Types only)
+// ORIGIN: NEW - Backing store for session checkpoints
+// DEPENDENCIES: Core_Platform.h, Core_Types.h
+// DEPENDENTS: SessionManager
+//
+// One read-write view over a whole file. The file is sparse where the OS
+// allows it, so a large table costs only the pages actually written.
+// Growing the file remaps it - every pointer into the old view dies.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_MAPPEDFILE_H
+#define AARENDOCORE_CORE_MAPPEDFILE_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// MAPPED FILE
+// ==========================================================================
+
+// Origin: Thin CreateFileMapping / mmap wrapper
+// Scope: Single owner - callers serialize open, grow and close
+class MappedFile {
+public:
+    MappedFile() noexcept;
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Open (creating if needed) and map. A file smaller than minSize is
+    // extended with zeros; an existing larger file is mapped whole unless
+    // truncate discards its contents first.
+    bool open(const char* path, u64 minSize, bool truncate = false) noexcept;
+    void close() noexcept;
+
+    // Extend the file and remap. No-op when already at least newSize.
+    bool grow(u64 newSize) noexcept;
+
+    // Write dirty pages of [offset, offset+length) back; sync waits for disk
+    bool flush(u64 offset, u64 length, bool sync) noexcept;
+
+    u8* data() const noexcept { return view_; }
+    u64 size() const noexcept { return size_; }
+    bool isOpen() const noexcept { return view_ != nullptr; }
+
+private:
+    bool map(u64 size) noexcept;
+    void unmap() noexcept;
+
+    u8* view_;
+    u64 size_;
+#if AARENDOCORE_PLATFORM_WINDOWS
+    void* file_;            // HANDLE
+    void* mapping_;         // HANDLE
+#else
+    int fd_;
+#endif
+};
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_MAPPEDFILE_H
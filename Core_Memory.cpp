@@ -153,25 +153,48 @@ void MemoryPool::reset() noexcept {
     lock_.unlock();
 }
 
+bool MemoryPool::restore(const void* data, usize size) noexcept {
+    if (!memory_ || size > size_ || (size && !data)) {
+        return false;
+    }
+    
+    lock_.lock();
+    std::memcpy(memory_, data, size);
+    offset_.store(size, MemoryOrderRelaxed);
+    lock_.unlock();
+    
+    return true;
+}
+
 void MemoryPool::release() noexcept {
-    if (memory_) {
-        lock_.lock();
-        
-        // Update stats
-        AtomicAdd(g_memoryStats.totalFreed, size_);
-        // Subtract from current usage - but AtomicU64 can't be negative, so we use fetch_sub directly
-        g_memoryStats.currentUsage.fetch_sub(size_, MemoryOrderRelaxed);
-        AtomicIncrement(g_memoryStats.freeCount);
-        
-        FreeAligned(memory_);
-        memory_ = nullptr;
-        size_ = 0;
-        offset_.store(0);
-        
-        lock_.unlock();
+    byte* memory = detach();
+    if (memory) {
+        FreeAligned(memory);
     }
 }
 
+byte* MemoryPool::detach() noexcept {
+    if (!memory_) {
+        return nullptr;
+    }
+    
+    lock_.lock();
+    
+    // Update stats - counted as freed now, whenever the caller frees it
+    AtomicAdd(g_memoryStats.totalFreed, size_);
+    // Subtract from current usage - but AtomicU64 can't be negative, so we use fetch_sub directly
+    g_memoryStats.currentUsage.fetch_sub(size_, MemoryOrderRelaxed);
+    AtomicIncrement(g_memoryStats.freeCount);
+    
+    byte* memory = memory_;
+    memory_ = nullptr;
+    size_ = 0;
+    offset_.store(0);
+    
+    lock_.unlock();
+    return memory;
+}
+
 // ============================================================================
 // ALIGNED ALLOCATION IMPLEMENTATION
 // ============================================================================
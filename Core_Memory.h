@@ -43,7 +43,7 @@ private:
     byte* memory_;                     // Pool memory
     usize size_;                       // Total pool size
     AtomicU64 offset_;                 // Current allocation offset
-    Spinlock lock_;                    // For thread safety
+    McsLock lock_;                     // For thread safety - FIFO, no line bouncing
     u32 alignment_;                    // Default alignment
     
 public:
@@ -74,8 +74,19 @@ public:
     usize available() const noexcept { return size_ - used(); }
     bool is_initialized() const noexcept { return memory_ != nullptr; }
     
+    // Allocated prefix [data(), data() + used()) - for checkpointing
+    const byte* data() const noexcept { return memory_; }
+    byte* data() noexcept { return memory_; }
+    
+    // Replace contents with a saved prefix - allocations keep their offsets
+    bool restore(const void* data, usize size) noexcept;
+    
     // Release pool memory
     void release() noexcept;
+    
+    // Hand the backing memory to the caller (FreeAligned) and leave the pool
+    // uninitialized - for frees deferred past concurrent readers
+    byte* detach() noexcept;
 };
 
 // ============================================================================
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "Core_MessageBroker.h"
+#include "Core_Trace.h"
 #include <cstring>
 #include <immintrin.h>  // For _mm_pause()
 
@@ -17,6 +18,66 @@
 
 AARENDOCORE_NAMESPACE_BEGIN
 
+// ============================================================================
+// LOAD SHEDDING HELPERS
+// ============================================================================
+namespace {
+
+// Percent watermark -> depth limit. CRITICAL is pinned to full capacity so a
+// misconfigured table can never shed it.
+u64 watermarkDepth(const SheddingWatermarks& watermarks, u32 level, u64 capacity) noexcept {
+    if (level == 0) {
+        return capacity;
+    }
+    u32 percent = watermarks.depthPercent[level];
+    if (percent > 100) percent = 100;
+    return (capacity * percent) / 100;
+}
+
+u32 priorityLevel(MessagePriority priority) noexcept {
+    u32 level = static_cast<u32>(priority);
+    return (level < PRIORITY_LEVELS) ? level : PRIORITY_LEVELS - 1;
+}
+
+// Window whose handler is running on this thread. The delivery path holds the
+// subscriber's write accessor, so an ack from inside the handler must not
+// look the subscription up again.
+thread_local InFlightWindow* t_deliveringWindow = nullptr;
+
+bool applyAcknowledgement(InFlightWindow* window, u64 sequence) noexcept {
+    if (sequence >= window->nextSequence) {
+        return false;  // Acking something never sent
+    }
+    
+    if (sequence <= window->ackedThrough) {
+        return true;  // Duplicate or stale ack
+    }
+    
+    // PSYCHOTIC: O(1) regardless of range - the slots are simply reusable now.
+    // The ack timer is left armed and finds nothing to resend when it fires.
+    window->ackedThrough = sequence;
+    
+    if (window->stalled && !window->full()) {
+        window->stalled = false;
+        if (window->stallCounter) {
+            window->stallCounter->fetch_sub(1, std::memory_order_release);
+        }
+    }
+    
+    return true;
+}
+
+// Deferred topic teardown - runs once no publisher can still hold the pointer
+void reclaimTopic(void* object, [[maybe_unused]] void* context) noexcept {
+    TopicInfo* info = static_cast<TopicInfo*>(object);
+    delete info->buffer;
+    delete info->express;
+    delete info->conflation;
+    delete info;
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // GLOBAL MESSAGE BROKER INSTANCE
 // ============================================================================
@@ -37,7 +98,25 @@ MessageBroker::MessageBroker() noexcept
     , deadLetterQueue()
     , nextTopicId(1)  // Start from 1, 0 is invalid
     , nextSubscriptionId(1)
-    , stats{0, 0, 0, 0} {
+    , stats{0, 0, 0, 0, 0, 0}
+    , brokerShedDepth{}
+    , redeliveryWheel()
+    , redeliveryLock()
+    , redeliverySlots()
+    , ackWheel() {
+    for (u32 i = 0; i < TOPIC_INDEX_SIZE; ++i) {
+        topicIndex[i].store(nullptr, std::memory_order_relaxed);
+    }
+    setBrokerWatermarks(DEFAULT_SHEDDING_WATERMARKS);
+    
+    redeliveryWheel.initialize(createTimestamp(), REDELIVERY_TICK_SHIFT);
+    ackWheel.initialize(createTimestamp(), REDELIVERY_TICK_SHIFT);
+    if (redeliverySlots.initialize(MAX_PENDING_REDELIVERIES, -1, alignof(RedeliverySlot), false)) {
+        for (u32 i = 0; i < MAX_PENDING_REDELIVERIES; ++i) {
+            RedeliverySlot* slot = new(redeliverySlots.at(i)) RedeliverySlot();
+            slot->timer.context = slot;
+        }
+    }
 }
 
 // Destructor
@@ -45,6 +124,14 @@ MessageBroker::~MessageBroker() noexcept {
     // Clean up all topic buffers
     topics.clear();  // TopicInfo pointers will be cleaned up
     
+    for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+        delete it->second.window;
+    }
+    
+    for (u32 i = 0; i < redeliverySlots.getCapacity(); ++i) {
+        redeliverySlots.at(i)->~RedeliverySlot();
+    }
+    
     // Note: In production, we'd properly deallocate MessageRingBuffer instances
     // But with pre-allocated pools, they're managed separately
 }
@@ -55,10 +142,6 @@ TopicId MessageBroker::createTopic(const char* name, MessagePriority minPriority
         return INVALID_TOPIC_ID;
     }
     
-    // Generate new topic ID
-    u32 id = nextTopicId.fetch_add(1, std::memory_order_relaxed);
-    TopicId topicId(id);
-    
     // Create topic info
     TopicInfo* info = new TopicInfo();  // PSYCHOTIC: In production, use pre-allocated pool!
     std::strncpy(info->name, name, 63);
@@ -67,13 +150,74 @@ TopicId MessageBroker::createTopic(const char* name, MessagePriority minPriority
     
     // Allocate ring buffer - PSYCHOTIC: Should be from pre-allocated pool!
     info->buffer = new MessageRingBuffer<65536>();
+    info->express = new MessageRingBuffer<EXPRESS_LANE_SIZE>();
+    
+    for (u32 level = 0; level < PRIORITY_LEVELS; ++level) {
+        info->shedDepth[level] = static_cast<u32>(
+            watermarkDepth(DEFAULT_SHEDDING_WATERMARKS, level, MessageRingBuffer<65536>::BUFFER_SIZE));
+    }
     
     // Insert into registry
-    topics.insert(std::make_pair(topicId, info));
+    TopicId topicId = registerTopic(info);
+    if (topicId == INVALID_TOPIC_ID) {
+        reclaimTopic(info, nullptr);  // Never published, free directly
+    }
+    
+    return topicId;
+}
+
+// Create a conflated (last-value) topic
+TopicId MessageBroker::createConflatedTopic(const char* name, u32 keyCapacity,
+                                            MessagePriority minPriority) noexcept {
+    if (!name || topics.size() >= MAX_TOPICS ||
+        keyCapacity == 0 || keyCapacity > MAX_CONFLATION_KEYS) {
+        return INVALID_TOPIC_ID;
+    }
+    
+    TopicInfo* info = new TopicInfo();
+    std::strncpy(info->name, name, 63);
+    info->name[63] = '\0';
+    info->minPriority = minPriority;
+    info->mode = TopicMode::CONFLATED;
+    
+    // One slot per key, rounded up to whole dirty-bitmap words - no ring
+    info->conflation = new ConflationTable((keyCapacity + 63) & ~63u);
+    
+    TopicId topicId = registerTopic(info);
+    if (topicId == INVALID_TOPIC_ID) {
+        reclaimTopic(info, nullptr);
+    }
     
     return topicId;
 }
 
+// Internal: Assign an id whose index slot is free and publish the topic
+TopicId MessageBroker::registerTopic(TopicInfo* info) noexcept {
+    // PSYCHOTIC: 4x more slots than topics - a collision costs one more id
+    for (u32 attempt = 0; attempt < TOPIC_INDEX_SIZE; ++attempt) {
+        u32 id = nextTopicId.fetch_add(1, std::memory_order_relaxed);
+        if (id == INVALID_TOPIC_ID.value) {
+            continue;  // Wrapped - 0 is reserved
+        }
+        
+        info->id = TopicId(id);
+        TopicInfo* expected = nullptr;
+        if (topicIndex[id & TOPIC_INDEX_MASK].compare_exchange_strong(
+                expected, info, std::memory_order_acq_rel)) {
+            topics.insert(std::make_pair(info->id, info));
+            return info->id;
+        }
+    }
+    
+    return INVALID_TOPIC_ID;
+}
+
+// Internal: Lock-free topic lookup - valid until the caller's EpochGuard ends
+TopicInfo* MessageBroker::lookupTopic(TopicId topic) const noexcept {
+    TopicInfo* info = topicIndex[topic.value & TOPIC_INDEX_MASK].load(std::memory_order_acquire);
+    return (info && info->id == topic) ? info : nullptr;
+}
+
 // Delete a topic
 bool MessageBroker::deleteTopic(TopicId topic) noexcept {
     tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor accessor;
@@ -89,15 +233,25 @@ bool MessageBroker::deleteTopic(TopicId topic) noexcept {
         tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::accessor subAccessor;
         if (subscribers.find(subAccessor, subId)) {
             subAccessor->second.active = false;
+            if (subAccessor->second.window) {
+                subAccessor->second.window->stallCounter = nullptr;
+            }
         }
     }
     
-    // Remove from registry
+    // Remove from registry - new publishers stop finding it here
+    topicIndex[topic.value & TOPIC_INDEX_MASK].store(nullptr, std::memory_order_release);
     topics.erase(accessor);
     
-    // Clean up buffers (in production, return to pool)
-    delete info->buffer;
-    delete info;
+    // Undelivered messages leave the broker-wide queue budget. A publisher
+    // that passed the active check just before may still land one message.
+    if (info->buffer) {
+        stats.queuedMessages.fetch_sub(info->buffer->depth() + info->express->depth(),
+                                       std::memory_order_relaxed);
+    }
+    
+    // Publishers inside an EpochGuard may still hold info - free after grace
+    GetEpochManager().retire(info, reclaimTopic);
     
     return true;
 }
@@ -110,14 +264,16 @@ bool MessageBroker::topicExists(TopicId topic) const noexcept {
 
 // Publish a message to a topic
 bool MessageBroker::publish(TopicId topic, const Message& msg, MessagePriority priority) noexcept {
-    tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor accessor;
-    if (!topics.find(accessor, topic)) {
+    AARENDOCORE_TRACE_SCOPE(BROKER, BROKER_PUBLISH, topic.value, priority);
+    
+    // PSYCHOTIC: No map lock on the hot path - readers never write shared lines
+    EpochGuard guard;
+    TopicInfo* info = lookupTopic(topic);
+    if (!info) {
         stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
         return false;
     }
     
-    TopicInfo* info = accessor->second;
-    
     // Check priority filter
     if (priority > info->minPriority) {
         stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
@@ -130,25 +286,29 @@ bool MessageBroker::publish(TopicId topic, const Message& msg, MessagePriority p
         return false;
     }
     
-    // Reserve slot in ring buffer
-    u64 slot;
-    if (!info->buffer->reserve(slot)) {
-        // Buffer full - send to dead letter queue
+    // Conflated topics key by the first id after the header
+    if (info->mode == TopicMode::CONFLATED) {
+        return conflate(info, msg.tick.symbolId, msg);
+    }
+    
+    // Admit by priority - shedding is intentional, only a full queue dead-letters
+    AdmissionResult result = enqueue(info, msg, priority);
+    if (result == AdmissionResult::SHED) {
+        return false;
+    }
+    if (result == AdmissionResult::FULL) {
+        // Buffer full - retry on the timer wheel, dead letter once out of attempts
         MessageEnvelope envelope;
         envelope.message = msg;
         envelope.topic = topic;
         envelope.priority = priority;
         envelope.expiryTime = createTimestamp() + 1000000000;  // 1 second expiry
-        sendToDeadLetter(envelope, 1);  // Reason: buffer full
-        
-        info->stats.messagesDropped.fetch_add(1, std::memory_order_relaxed);
-        stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        if (!scheduleRedelivery(envelope)) {
+            sendToDeadLetter(envelope, 1);  // Reason: buffer full
+        }
         return false;
     }
     
-    // Write message to buffer
-    info->buffer->write(slot, msg);
-    
     // Update statistics
     info->stats.messagesPublished.fetch_add(1, std::memory_order_relaxed);
     info->stats.bytesTransferred.fetch_add(sizeof(Message), std::memory_order_relaxed);
@@ -164,14 +324,15 @@ bool MessageBroker::publish(TopicId topic, const Message& msg, MessagePriority p
 bool MessageBroker::publishBatch(TopicId topic, const Message* messages, u32 count, MessagePriority priority) noexcept {
     if (!messages || count == 0) return false;
     
-    tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor accessor;
-    if (!topics.find(accessor, topic)) {
+    AARENDOCORE_TRACE_SCOPE(BROKER, BROKER_PUBLISH_BATCH, topic.value, count);
+    
+    EpochGuard guard;
+    TopicInfo* info = lookupTopic(topic);
+    if (!info) {
         stats.totalMessagesDropped.fetch_add(count, std::memory_order_relaxed);
         return false;
     }
     
-    TopicInfo* info = accessor->second;
-    
     // Check priority and active status
     if (priority > info->minPriority || info->active.load(std::memory_order_acquire) == 0) {
         stats.totalMessagesDropped.fetch_add(count, std::memory_order_relaxed);
@@ -179,13 +340,19 @@ bool MessageBroker::publishBatch(TopicId topic, const Message* messages, u32 cou
     }
     
     u32 published = 0;
+    if (info->mode == TopicMode::CONFLATED) {
+        for (u32 i = 0; i < count; ++i) {
+            published += conflate(info, messages[i].tick.symbolId, messages[i]) ? 1 : 0;
+        }
+        return published == count;
+    }
+    
+    AdmissionResult result = AdmissionResult::QUEUED;
     for (u32 i = 0; i < count; ++i) {
-        u64 slot;
-        if (!info->buffer->reserve(slot)) {
-            break;  // Buffer full
+        result = enqueue(info, messages[i], priority);
+        if (result != AdmissionResult::QUEUED) {
+            break;  // Shed or full - the rest of the batch shares the priority
         }
-        
-        info->buffer->write(slot, messages[i]);
         published++;
     }
     
@@ -200,9 +367,16 @@ bool MessageBroker::publishBatch(TopicId topic, const Message* messages, u32 cou
     }
     
     if (published < count) {
-        u32 dropped = count - published;
-        info->stats.messagesDropped.fetch_add(dropped, std::memory_order_relaxed);
-        stats.totalMessagesDropped.fetch_add(dropped, std::memory_order_relaxed);
+        // enqueue() already counted the message that stopped the batch
+        u32 dropped = count - published - 1;
+        if (dropped > 0) {
+            if (result == AdmissionResult::SHED) {
+                info->stats.shedByPriority[priorityLevel(priority)].fetch_add(dropped, std::memory_order_relaxed);
+                stats.totalMessagesShed.fetch_add(dropped, std::memory_order_relaxed);
+            }
+            info->stats.messagesDropped.fetch_add(dropped, std::memory_order_relaxed);
+            stats.totalMessagesDropped.fetch_add(dropped, std::memory_order_relaxed);
+        }
     }
     
     return published == count;
@@ -219,8 +393,69 @@ bool MessageBroker::publishEnvelope(const MessageEnvelope& envelope) noexcept {
     return publish(envelope.topic, envelope.message, envelope.priority);
 }
 
+// Publish to a conflated topic under an explicit key
+bool MessageBroker::publishConflated(TopicId topic, u32 key, const Message& msg,
+                                     MessagePriority priority) noexcept {
+    EpochGuard guard;
+    TopicInfo* info = lookupTopic(topic);
+    if (!info) {
+        stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (info->mode != TopicMode::CONFLATED || priority > info->minPriority ||
+        info->active.load(std::memory_order_acquire) == 0) {
+        stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    return conflate(info, key, msg);
+}
+
+// Snapshot the current value of one key (late joiners, GUI refresh)
+bool MessageBroker::readConflated(TopicId topic, u32 key, Message& outMsg) const noexcept {
+    EpochGuard guard;
+    const TopicInfo* info = lookupTopic(topic);
+    if (!info) {
+        return false;
+    }
+    
+    const ConflationTable* table = info->conflation;
+    if (!table || key >= table->keyCapacity) {
+        return false;
+    }
+    
+    return table->read(key, outMsg);
+}
+
+// Set per-topic shedding watermarks (percent of the main ring)
+bool MessageBroker::setTopicWatermarks(TopicId topic, const SheddingWatermarks& watermarks) noexcept {
+    tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor accessor;
+    if (!topics.find(accessor, topic)) {
+        return false;
+    }
+    
+    TopicInfo* info = accessor->second;
+    if (info->mode != TopicMode::QUEUED) {
+        return false;  // Conflated topics are bounded by key count, nothing to shed
+    }
+    
+    for (u32 level = 0; level < PRIORITY_LEVELS; ++level) {
+        info->shedDepth[level] = static_cast<u32>(
+            watermarkDepth(watermarks, level, MessageRingBuffer<65536>::BUFFER_SIZE));
+    }
+    return true;
+}
+
+// Set broker-wide shedding watermarks (percent of the total queue budget)
+void MessageBroker::setBrokerWatermarks(const SheddingWatermarks& watermarks, u64 queueBudget) noexcept {
+    for (u32 level = 0; level < PRIORITY_LEVELS; ++level) {
+        brokerShedDepth[level].store(watermarkDepth(watermarks, level, queueBudget),
+                                     std::memory_order_relaxed);
+    }
+}
+
 // Subscribe to a topic
-SubscriptionId MessageBroker::subscribe(TopicId topic, MessageHandler handler) noexcept {
+SubscriptionId MessageBroker::subscribe(TopicId topic, MessageHandler handler, DeliveryMode mode) noexcept {
     // Verify topic exists
     tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor topicAccessor;
     if (!topics.find(topicAccessor, topic)) {
@@ -237,6 +472,15 @@ SubscriptionId MessageBroker::subscribe(TopicId topic, MessageHandler handler) n
     info.handler = handler;
     info.active = true;
     
+    // EXACTLY_ONCE needs consumer-side dedup we don't have - treat as AT_LEAST_ONCE
+    info.deliveryMode = (mode == DeliveryMode::AT_MOST_ONCE) ? DeliveryMode::AT_MOST_ONCE
+                                                             : DeliveryMode::AT_LEAST_ONCE;
+    if (info.deliveryMode == DeliveryMode::AT_LEAST_ONCE) {
+        info.window = new InFlightWindow();  // PSYCHOTIC: Once per subscription, never per message
+        info.window->subscription = subId;
+        info.window->stallCounter = &topicAccessor->second->stalledSubscribers;
+    }
+    
     // Add to subscriber registry
     {
         tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::accessor subAccessor;
@@ -246,6 +490,8 @@ SubscriptionId MessageBroker::subscribe(TopicId topic, MessageHandler handler) n
         subAccessor->second.handler = info.handler;
         subAccessor->second.messagesReceived.store(info.messagesReceived.load(std::memory_order_relaxed), std::memory_order_relaxed);
         subAccessor->second.lastDeliveryTime.store(info.lastDeliveryTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        subAccessor->second.deliveryMode = info.deliveryMode;
+        subAccessor->second.window = info.window;
         subAccessor->second.active = info.active;
     }
     
@@ -263,6 +509,7 @@ bool MessageBroker::unsubscribe(SubscriptionId subscription) noexcept {
     }
     
     accessor->second.active = false;
+    releaseWindow(accessor->second);
     
     // Remove from topic's subscriber list
     TopicId topic = accessor->second.topic;
@@ -296,6 +543,31 @@ bool MessageBroker::setMessageFilter(SubscriptionId subscription, u32 messageTyp
     return true;
 }
 
+// Cumulative acknowledgement for an AT_LEAST_ONCE subscription
+bool MessageBroker::acknowledge(SubscriptionId subscription, u64 sequence) noexcept {
+    // Ack from inside this subscription's own handler - accessor already held
+    if (t_deliveringWindow && t_deliveringWindow->subscription == subscription) {
+        return applyAcknowledgement(t_deliveringWindow, sequence);
+    }
+    
+    tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::accessor accessor;
+    if (!subscribers.find(accessor, subscription) || !accessor->second.window) {
+        return false;
+    }
+    
+    return applyAcknowledgement(accessor->second.window, sequence);
+}
+
+// Messages delivered but not yet acknowledged
+u64 MessageBroker::getUnackedCount(SubscriptionId subscription) const noexcept {
+    tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::const_accessor accessor;
+    if (!subscribers.find(accessor, subscription) || !accessor->second.window) {
+        return 0;
+    }
+    
+    return accessor->second.window->inFlight();
+}
+
 // Process all messages in all topics
 void MessageBroker::processMessages() noexcept {
     // PSYCHOTIC: Process each topic
@@ -303,22 +575,73 @@ void MessageBroker::processMessages() noexcept {
         processTopic(it->first);
     }
     
-    // Process dead letters if needed
-    MessageEnvelope envelope;
-    u32 deadLettersProcessed = 0;
-    while (deadLetterQueue.try_pop(envelope) && deadLettersProcessed < 100) {
-        // Try to re-route dead letters
-        if (envelope.retryCount < 3) {
-            envelope.retryCount++;
-            if (!publishEnvelope(envelope)) {
-                // Failed again, put back in dead letter queue
-                deadLetterQueue.push(envelope);
+    // Fire due redeliveries and expiries - dead letters are final
+    processTimers();
+}
+
+// Fire every redelivery/expiry timer that has come due
+u32 MessageBroker::processTimers() noexcept {
+    // PSYCHOTIC: Pop in chunks so topics are never touched under the wheel lock
+    constexpr u32 CHUNK = 64;
+    RedeliverySlot* due[CHUNK];
+    u32 total = 0;
+    
+    const u64 now = createTimestamp();
+    redeliveryLock.lock();
+    redeliveryWheel.advance(now);
+    ackWheel.advance(now);
+    
+    for (;;) {
+        u32 count = 0;
+        while (count < CHUNK) {
+            TimerNode* node = redeliveryWheel.popExpired();
+            if (!node) break;
+            due[count++] = static_cast<RedeliverySlot*>(node->context);
+        }
+        redeliveryLock.unlock();
+        
+        for (u32 i = 0; i < count; ++i) {
+            redeliver(due[i]);
+        }
+        total += count;
+        
+        if (count < CHUNK) {
+            break;
+        }
+        redeliveryLock.lock();
+    }
+    
+    // Ack timeouts - take the id under the lock, a window may be freed after
+    SubscriptionId expired[CHUNK];
+    for (;;) {
+        u32 count = 0;
+        redeliveryLock.lock();
+        while (count < CHUNK) {
+            TimerNode* node = ackWheel.popExpired();
+            if (!node) break;
+            expired[count++] = static_cast<InFlightWindow*>(node->context)->subscription;
+        }
+        redeliveryLock.unlock();
+        
+        for (u32 i = 0; i < count; ++i) {
+            tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::accessor subAccessor;
+            if (subscribers.find(subAccessor, expired[i])) {
+                redeliverUnacked(subAccessor->second);
             }
         }
-        deadLettersProcessed++;
+        total += count;
+        
+        if (count < CHUNK) {
+            return total;
+        }
     }
 }
 
+// Envelopes waiting for redelivery or expiry
+u64 MessageBroker::getPendingRedeliveries() const noexcept {
+    return redeliverySlots.getAllocatedCount();
+}
+
 // Process messages for a specific topic
 void MessageBroker::processTopic(TopicId topic) noexcept {
     tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor accessor;
@@ -331,27 +654,38 @@ void MessageBroker::processTopic(TopicId topic) noexcept {
         return;
     }
     
-    // Process up to 1000 messages per call
+    if (info->mode == TopicMode::CONFLATED) {
+        drainConflated(info);
+        return;
+    }
+    
+    // Process up to 1000 messages per call, express lane first so
+    // CRITICAL/HIGH never wait behind a BULK backlog. Backpressure is per
+    // subscriber: a full AT_LEAST_ONCE window sheds only its own copies
+    // (to the dead-letter queue), the topic keeps draining for the rest.
     Message msg;
     u32 processed = 0;
     
-    while (info->buffer->read(msg) && processed < 1000) {
+    while (processed < 1000 && info->express->read(msg)) {
+        deliverToSubscribers(info, msg);
+        
+        info->stats.messagesDelivered.fetch_add(1, std::memory_order_relaxed);
+        info->stats.lastDeliveryTime.store(createTimestamp(), std::memory_order_relaxed);
+        processed++;
+    }
+    
+    while (processed < 1000 && info->buffer->read(msg)) {
         // Deliver to all subscribers
-        for (const auto& subId : info->subscribers) {
-            if (subId == INVALID_SUBSCRIPTION_ID) continue;
-            
-            tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::accessor subAccessor;
-            if (subscribers.find(subAccessor, subId)) {
-                if (subAccessor->second.active) {
-                    deliverToSubscriber(msg, subAccessor->second);
-                }
-            }
-        }
+        deliverToSubscribers(info, msg);
         
         info->stats.messagesDelivered.fetch_add(1, std::memory_order_relaxed);
         info->stats.lastDeliveryTime.store(createTimestamp(), std::memory_order_relaxed);
         processed++;
     }
+    
+    if (processed > 0) {
+        stats.queuedMessages.fetch_sub(processed, std::memory_order_relaxed);
+    }
 }
 
 // Route a message based on envelope
@@ -414,6 +748,11 @@ bool MessageBroker::getTopicStats(TopicId topic, TopicStats& outStats) const noe
     outStats.bytesTransferred.store(srcStats.bytesTransferred.load(std::memory_order_relaxed), std::memory_order_relaxed);
     outStats.lastPublishTime.store(srcStats.lastPublishTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
     outStats.lastDeliveryTime.store(srcStats.lastDeliveryTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    outStats.messagesConflated.store(srcStats.messagesConflated.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    for (u32 level = 0; level < PRIORITY_LEVELS; ++level) {
+        outStats.publishedByPriority[level].store(srcStats.publishedByPriority[level].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        outStats.shedByPriority[level].store(srcStats.shedByPriority[level].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
     
     return true;
 }
@@ -444,13 +783,18 @@ void MessageBroker::clearDeadLetters() noexcept {
 // Reset broker state
 void MessageBroker::reset() noexcept {
     // Clear all topics
+    for (u32 i = 0; i < TOPIC_INDEX_SIZE; ++i) {
+        topicIndex[i].store(nullptr, std::memory_order_release);
+    }
     for (auto it = topics.begin(); it != topics.end(); ++it) {
-        delete it->second->buffer;
-        delete it->second;
+        GetEpochManager().retire(it->second, reclaimTopic);
     }
     topics.clear();
     
-    // Clear subscribers
+    // Clear subscribers (topics are gone, windows must not touch their counters)
+    for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+        delete it->second.window;
+    }
     subscribers.clear();
     
     // Clear dead letters
@@ -465,6 +809,20 @@ void MessageBroker::reset() noexcept {
     stats.totalMessagesDropped.store(0, std::memory_order_relaxed);
     stats.totalBytesTransferred.store(0, std::memory_order_relaxed);
     stats.deadLetterCount.store(0, std::memory_order_relaxed);
+    stats.totalMessagesShed.store(0, std::memory_order_relaxed);
+    stats.queuedMessages.store(0, std::memory_order_relaxed);
+    setBrokerWatermarks(DEFAULT_SHEDDING_WATERMARKS);
+    
+    // Drop pending redeliveries
+    redeliveryLock.lock();
+    redeliveryWheel.initialize(createTimestamp(), REDELIVERY_TICK_SHIFT);
+    ackWheel.initialize(createTimestamp(), REDELIVERY_TICK_SHIFT);
+    for (u32 i = 0; i < redeliverySlots.getCapacity(); ++i) {
+        redeliverySlots.at(i)->timer.next = nullptr;
+        redeliverySlots.at(i)->timer.prev = nullptr;
+    }
+    redeliverySlots.reset();
+    redeliveryLock.unlock();
 }
 
 // Internal: Deliver message to subscriber
@@ -482,13 +840,61 @@ bool MessageBroker::deliverToSubscriber(const Message& msg, const SubscriberInfo
         }
     }
     
+    // Spans the handler - DAG work it triggers nests underneath
+    AARENDOCORE_TRACE_SCOPE(BROKER, BROKER_DELIVER, subscriber.topic.value, msgType);
+    
+    // One RDTSC per delivery, shared by the window and the stats
+    const u64 now = createTimestamp();
+    
+    // AT_LEAST_ONCE: sequence and keep a copy until acked
+    u64 sequence = 0;
+    InFlightWindow* window = subscriber.window;
+    if (window) {
+        if (window->full()) {
+            // Never overwrite unacked - shed this subscriber's copy only
+            deadLetterForSubscriber(subscriber, msg, 0, 4);  // Reason: window full
+            const_cast<SubscriberInfo&>(subscriber).messagesShed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        
+        sequence = window->record(msg, now);
+        
+        if (window->inFlight() == 1 && !window->timer.isArmed()) {
+            // First unacked message - start the ack timeout. Acks leave the
+            // timer armed, so a subscriber acking as it goes skips the lock.
+            redeliveryLock.lock();
+            if (!window->timer.isArmed()) {
+                ackWheel.schedule(&window->timer, now + ACK_TIMEOUT_CYCLES);
+            }
+            redeliveryLock.unlock();
+        }
+        
+        if (window->full() && window->stallCounter) {
+            window->stalled = true;
+            window->stallCounter->fetch_add(1, std::memory_order_release);
+        }
+    }
+    
     // Call handler
+    if (subscriber.handler.sequencedHandler) {
+        t_deliveringWindow = window;
+        subscriber.handler.sequencedHandler(msg, sequence, subscriber.handler.context);
+        t_deliveringWindow = nullptr;
+        
+        const_cast<SubscriberInfo&>(subscriber).messagesReceived.fetch_add(1, std::memory_order_relaxed);
+        const_cast<SubscriberInfo&>(subscriber).lastDeliveryTime.store(now, std::memory_order_relaxed);
+        
+        return true;
+    }
+    
     if (subscriber.handler.handler) {
+        t_deliveringWindow = window;
         subscriber.handler.handler(msg, subscriber.handler.context);
+        t_deliveringWindow = nullptr;
         
         // Update stats (cast away const for stats update)
         const_cast<SubscriberInfo&>(subscriber).messagesReceived.fetch_add(1, std::memory_order_relaxed);
-        const_cast<SubscriberInfo&>(subscriber).lastDeliveryTime.store(createTimestamp(), std::memory_order_relaxed);
+        const_cast<SubscriberInfo&>(subscriber).lastDeliveryTime.store(now, std::memory_order_relaxed);
         
         return true;
     }
@@ -496,6 +902,117 @@ bool MessageBroker::deliverToSubscriber(const Message& msg, const SubscriberInfo
     return false;
 }
 
+// Internal: Deliver message to every active subscriber of a topic
+void MessageBroker::deliverToSubscribers(TopicInfo* topic, const Message& msg) noexcept {
+    for (const auto& subId : topic->subscribers) {
+        if (subId == INVALID_SUBSCRIPTION_ID) continue;
+        
+        tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>>::accessor subAccessor;
+        if (subscribers.find(subAccessor, subId)) {
+            if (subAccessor->second.active) {
+                deliverToSubscriber(msg, subAccessor->second);
+            }
+        }
+    }
+}
+
+// Internal: Priority admission into a queued topic
+// Broker-wide budget first (one shared load), then the CRITICAL/HIGH express
+// lane, then the main ring under this priority's depth watermark.
+AdmissionResult MessageBroker::enqueue(TopicInfo* topic, const Message& msg, MessagePriority priority) noexcept {
+    const u32 level = priorityLevel(priority);
+    const u64 mainLimit = topic->shedDepth[level];
+    u64 slot;
+    
+    bool admitted = stats.queuedMessages.load(std::memory_order_relaxed) <
+                    brokerShedDepth[level].load(std::memory_order_relaxed);
+    
+    if (admitted) {
+        if (level <= static_cast<u32>(MessagePriority::HIGH) && topic->express->reserve(slot)) {
+            topic->express->write(slot, msg);
+        } else if (topic->buffer->reserve(slot, mainLimit)) {
+            topic->buffer->write(slot, msg);
+        } else if (mainLimit >= MessageRingBuffer<65536>::BUFFER_SIZE) {
+            // Genuinely full, not a watermark - caller dead-letters it
+            topic->stats.messagesDropped.fetch_add(1, std::memory_order_relaxed);
+            stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+            return AdmissionResult::FULL;
+        } else {
+            admitted = false;
+        }
+    }
+    
+    if (!admitted) {
+        topic->stats.shedByPriority[level].fetch_add(1, std::memory_order_relaxed);
+        topic->stats.messagesDropped.fetch_add(1, std::memory_order_relaxed);
+        stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        stats.totalMessagesShed.fetch_add(1, std::memory_order_relaxed);
+        return AdmissionResult::SHED;
+    }
+    
+    topic->stats.publishedByPriority[level].fetch_add(1, std::memory_order_relaxed);
+    stats.queuedMessages.fetch_add(1, std::memory_order_relaxed);
+    return AdmissionResult::QUEUED;
+}
+
+// Internal: Overwrite a key's slot on a conflated topic
+bool MessageBroker::conflate(TopicInfo* topic, u32 key, const Message& msg) noexcept {
+    ConflationTable* table = topic->conflation;
+    if (!table || key >= table->keyCapacity) {
+        topic->stats.messagesDropped.fetch_add(1, std::memory_order_relaxed);
+        stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    // Never fails for capacity: the slot is overwritten, not queued
+    if (table->write(key, msg)) {
+        topic->stats.messagesConflated.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    topic->stats.messagesPublished.fetch_add(1, std::memory_order_relaxed);
+    topic->stats.bytesTransferred.fetch_add(sizeof(Message), std::memory_order_relaxed);
+    topic->stats.lastPublishTime.store(createTimestamp(), std::memory_order_relaxed);
+    
+    stats.totalMessagesRouted.fetch_add(1, std::memory_order_relaxed);
+    stats.totalBytesTransferred.fetch_add(sizeof(Message), std::memory_order_relaxed);
+    
+    return true;
+}
+
+// Internal: Deliver the newest value of every key dirtied since the last drain
+void MessageBroker::drainConflated(TopicInfo* topic) noexcept {
+    ConflationTable* table = topic->conflation;
+    if (!table) {
+        return;
+    }
+    
+    Message msg;
+    u64 delivered = 0;
+    
+    for (u32 word = 0; word < table->dirtyWords; ++word) {
+        if (table->dirty[word].load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        
+        // Claim the word; publishes after this re-dirty it for the next drain
+        u64 bits = table->dirty[word].exchange(0, std::memory_order_acq_rel);
+        while (bits) {
+            const u32 key = (word << 6) + static_cast<u32>(_tzcnt_u64(bits));
+            bits &= bits - 1;
+            
+            if (table->read(key, msg)) {
+                deliverToSubscribers(topic, msg);
+                ++delivered;
+            }
+        }
+    }
+    
+    if (delivered > 0) {
+        topic->stats.messagesDelivered.fetch_add(delivered, std::memory_order_relaxed);
+        topic->stats.lastDeliveryTime.store(createTimestamp(), std::memory_order_relaxed);
+    }
+}
+
 // Internal: Check if message is expired
 bool MessageBroker::isMessageExpired(const MessageEnvelope& envelope) const noexcept {
     if (envelope.expiryTime == 0) {
@@ -505,6 +1022,174 @@ bool MessageBroker::isMessageExpired(const MessageEnvelope& envelope) const noex
     return createTimestamp() > envelope.expiryTime;
 }
 
+// Internal: Park an envelope on the wheel with exponential backoff
+bool MessageBroker::scheduleRedelivery(const MessageEnvelope& envelope) noexcept {
+    if (envelope.retryCount >= MAX_REDELIVERY_ATTEMPTS) {
+        return false;
+    }
+    
+    // Fire at the backoff or at expiry, whichever is first - an expired
+    // envelope is dropped by its own timer, never found by a scan
+    u64 when = createTimestamp() + (REDELIVERY_BACKOFF_CYCLES << envelope.retryCount);
+    if (envelope.expiryTime != 0 && envelope.expiryTime < when) {
+        when = envelope.expiryTime;
+    }
+    
+    RedeliverySlot* slot = redeliverySlots.allocate();
+    if (!slot) {
+        return false;
+    }
+    
+    slot->envelope = envelope;
+    redeliveryLock.lock();
+    redeliveryWheel.schedule(&slot->timer, when);
+    redeliveryLock.unlock();
+    
+    return true;
+}
+
+// Internal: A redelivery timer fired - expire, retry, or dead-letter
+void MessageBroker::redeliver(RedeliverySlot* slot) noexcept {
+    MessageEnvelope& envelope = slot->envelope;
+    
+    tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>>::accessor accessor;
+    if (!topics.find(accessor, envelope.topic)) {
+        stats.totalMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        releaseRedeliverySlot(slot);
+        return;
+    }
+    
+    TopicInfo* info = accessor->second;
+    
+    if (isMessageExpired(envelope)) {
+        info->stats.messagesExpired.fetch_add(1, std::memory_order_relaxed);
+        sendToDeadLetter(envelope, 3);  // Reason: expired
+        releaseRedeliverySlot(slot);
+        return;
+    }
+    
+    envelope.retryCount++;
+    AdmissionResult result = enqueue(info, envelope.message, envelope.priority);
+    
+    if (result == AdmissionResult::QUEUED) {
+        info->stats.messagesPublished.fetch_add(1, std::memory_order_relaxed);
+        info->stats.bytesTransferred.fetch_add(sizeof(Message), std::memory_order_relaxed);
+        info->stats.lastPublishTime.store(createTimestamp(), std::memory_order_relaxed);
+        
+        stats.totalMessagesRouted.fetch_add(1, std::memory_order_relaxed);
+        stats.totalBytesTransferred.fetch_add(sizeof(Message), std::memory_order_relaxed);
+    } else if (result == AdmissionResult::FULL) {
+        // Reuse the same slot for the next attempt
+        if (envelope.retryCount < MAX_REDELIVERY_ATTEMPTS) {
+            u64 when = createTimestamp() + (REDELIVERY_BACKOFF_CYCLES << envelope.retryCount);
+            if (envelope.expiryTime != 0 && envelope.expiryTime < when) {
+                when = envelope.expiryTime;
+            }
+            redeliveryLock.lock();
+            redeliveryWheel.schedule(&slot->timer, when);
+            redeliveryLock.unlock();
+            return;
+        }
+        sendToDeadLetter(envelope, 1);  // Reason: buffer full
+    }
+    
+    releaseRedeliverySlot(slot);
+}
+
+// Internal: Return a redelivery slot to the pool
+void MessageBroker::releaseRedeliverySlot(RedeliverySlot* slot) noexcept {
+    redeliverySlots.deallocate(slot);
+}
+
+// Internal: Ack timeout fired - resend only the unacked range
+void MessageBroker::redeliverUnacked(SubscriberInfo& subscriber) noexcept {
+    InFlightWindow* window = subscriber.window;
+    if (!window || !subscriber.active || window->inFlight() == 0) {
+        return;  // Everything acked since the timer was armed
+    }
+    
+    const u64 now = createTimestamp();
+    const u64 oldest = window->ackedThrough + 1;
+    const u64 oldestSentAt = window->sentAt[static_cast<u32>(oldest) & INFLIGHT_WINDOW_MASK];
+    
+    // Acks moved the window forward - the new head has not timed out yet
+    if (now - oldestSentAt < ACK_TIMEOUT_CYCLES) {
+        redeliveryLock.lock();
+        ackWheel.schedule(&window->timer, oldestSentAt + ACK_TIMEOUT_CYCLES);
+        redeliveryLock.unlock();
+        return;
+    }
+    
+    // The same head unacked after MAX_REDELIVERY_ATTEMPTS rounds - the
+    // subscriber is not coming back for it. Dead-letter the whole range and
+    // free the window so delivery resumes.
+    window->retryAttempts = (window->retryFrom == oldest) ? window->retryAttempts + 1 : 1;
+    window->retryFrom = oldest;
+    
+    if (window->retryAttempts > MAX_REDELIVERY_ATTEMPTS) {
+        for (u64 sequence = oldest; sequence < window->nextSequence; ++sequence) {
+            deadLetterForSubscriber(subscriber, window->messages[static_cast<u32>(sequence) & INFLIGHT_WINDOW_MASK],
+                                    MAX_REDELIVERY_ATTEMPTS, 5);  // Reason: never acked
+        }
+        applyAcknowledgement(window, window->nextSequence - 1);
+        window->retryAttempts = 0;
+        return;
+    }
+    
+    // Go-back-N from the cumulative ack; consumers see duplicates, never gaps
+    u64 resent = 0;
+    t_deliveringWindow = window;
+    for (u64 sequence = oldest; sequence < window->nextSequence; ++sequence) {
+        const u32 slot = static_cast<u32>(sequence) & INFLIGHT_WINDOW_MASK;
+        const Message& msg = window->messages[slot];
+        
+        if (subscriber.handler.sequencedHandler) {
+            subscriber.handler.sequencedHandler(msg, sequence, subscriber.handler.context);
+        } else if (subscriber.handler.handler) {
+            subscriber.handler.handler(msg, subscriber.handler.context);
+        }
+        window->sentAt[slot] = now;
+        ++resent;
+    }
+    t_deliveringWindow = nullptr;
+    
+    subscriber.messagesRedelivered.fetch_add(resent, std::memory_order_relaxed);
+    
+    redeliveryLock.lock();
+    ackWheel.schedule(&window->timer, now + ACK_TIMEOUT_CYCLES);
+    redeliveryLock.unlock();
+}
+
+// Internal: Dead-letter one subscriber's copy of a message
+void MessageBroker::deadLetterForSubscriber(const SubscriberInfo& subscriber, const Message& msg,
+                                            u32 attempts, u32 reason) noexcept {
+    MessageEnvelope envelope;
+    envelope.message = msg;
+    envelope.topic = subscriber.topic;
+    envelope.retryCount = attempts;
+    envelope.deliveryMode = subscriber.deliveryMode;
+    sendToDeadLetter(envelope, reason);
+}
+
+// Internal: Tear down a subscriber's in-flight window
+void MessageBroker::releaseWindow(SubscriberInfo& subscriber) noexcept {
+    InFlightWindow* window = subscriber.window;
+    if (!window) {
+        return;
+    }
+    
+    redeliveryLock.lock();
+    ackWheel.cancel(&window->timer);
+    redeliveryLock.unlock();
+    
+    if (window->stalled && window->stallCounter) {
+        window->stallCounter->fetch_sub(1, std::memory_order_release);
+    }
+    
+    delete window;
+    subscriber.window = nullptr;
+}
+
 // Internal: Update topic statistics
 void MessageBroker::updateTopicStats(TopicInfo* topic, bool delivered, u64 bytes) noexcept {
     if (!topic) return;
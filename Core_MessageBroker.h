@@ -6,6 +6,8 @@
 //   - Core_MessageTypes.h (Message, MessageType)
 //   - Core_DAGTypes.h (NodeId, DAGId)
 //   - Core_StreamMultiplexer.h (for integration)
+//   - Core_TimerWheel.h (expiry and redelivery scheduling)
+//   - Core_ObjectPool.h (redelivery slots)
 // ORIGIN: NEW - Zero-copy pub/sub message broker
 //
 // PSYCHOTIC PRECISION: LOCK-FREE, ZERO-ALLOCATION MESSAGE ROUTING
@@ -19,10 +21,16 @@
 #include "Core_Types.h"
 #include "Core_MessageTypes.h"
 #include "Core_DAGTypes.h"
+#include "Core_Atomic.h"
+#include "Core_TimerWheel.h"
+#include "Core_EpochReclaim.h"
+#include "Core_ObjectPool.h"
 #include <tbb/concurrent_queue.h>
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/concurrent_vector.h>
 #include <atomic>
+#include <cstring>
+#include <immintrin.h>
 
 AARENDOCORE_NAMESPACE_BEGIN
 
@@ -33,6 +41,10 @@ AARENDOCORE_NAMESPACE_BEGIN
 // Invalid topic ID constant  
 constexpr TopicId INVALID_TOPIC_ID(0u);
 
+// Lock-free topic index for the publish path - slot = id & mask, 4x MAX_TOPICS
+constexpr u32 TOPIC_INDEX_SIZE = 4096;                  // Power of 2
+constexpr u32 TOPIC_INDEX_MASK = TOPIC_INDEX_SIZE - 1;
+
 // ============================================================================
 // SUBSCRIPTION ID - Unique subscription identifier
 // ============================================================================
@@ -61,6 +73,38 @@ enum class MessagePriority : u32 {
     BULK = 4        // Lowest priority
 };
 
+constexpr u32 PRIORITY_LEVELS = 5;
+
+// ============================================================================
+// LOAD SHEDDING - Queue-depth watermarks per priority
+// ============================================================================
+// Depth (percent of capacity) at which each priority starts being shed.
+// Indexed by MessagePriority; BULK goes first, CRITICAL/HIGH never shed
+// from the main ring and additionally own a reserved express lane.
+struct SheddingWatermarks {
+    u32 depthPercent[PRIORITY_LEVELS];
+};
+
+constexpr SheddingWatermarks DEFAULT_SHEDDING_WATERMARKS = {{ 100, 100, 80, 65, 50 }};
+
+// Reserved per-topic capacity for CRITICAL/HIGH, drained ahead of the main ring
+constexpr u32 EXPRESS_LANE_SIZE = 4096;
+
+// Outcome of queue admission
+enum class AdmissionResult : u32 {
+    QUEUED = 0,     // Written to the express lane or main ring
+    SHED = 1,       // Rejected by a watermark (intentional, no dead letter)
+    FULL = 2        // No capacity left even for this priority
+};
+
+// ============================================================================
+// TOPIC MODE - Queueing vs last-value conflation
+// ============================================================================
+enum class TopicMode : u32 {
+    QUEUED = 0,     // Every message through the ring buffer
+    CONFLATED = 1   // Newest message per key; older values are overwritten
+};
+
 // ============================================================================
 // DELIVERY MODE - Message delivery guarantees
 // ============================================================================
@@ -95,6 +139,20 @@ struct alignas(128) MessageEnvelope {
         , routingPath{} {}
 };
 
+// ============================================================================
+// REDELIVERY SLOT - Envelope waiting on the broker's timer wheel
+// ============================================================================
+// PSYCHOTIC: Pre-allocated, the timer is intrusive - retries never allocate
+struct alignas(128) RedeliverySlot {
+    TimerNode timer;           // context = this
+    MessageEnvelope envelope;
+};
+
+constexpr u32 MAX_PENDING_REDELIVERIES = 4096;
+constexpr u32 MAX_REDELIVERY_ATTEMPTS = 3;
+constexpr u64 REDELIVERY_BACKOFF_CYCLES = 1ull << 20;   // ~0.3ms, doubles per attempt
+constexpr u32 REDELIVERY_TICK_SHIFT = 14;               // ~5us wheel ticks on the TSC
+
 // ============================================================================
 // TOPIC STATISTICS - Per-topic metrics
 // ============================================================================
@@ -106,7 +164,9 @@ struct alignas(64) TopicStats {
     AtomicU64 bytesTransferred;
     AtomicU64 lastPublishTime;
     AtomicU64 lastDeliveryTime;
-    u64 reserved;  // Padding to 64 bytes
+    AtomicU64 messagesConflated;  // Overwritten before a drain saw them
+    AtomicU64 publishedByPriority[PRIORITY_LEVELS];
+    AtomicU64 shedByPriority[PRIORITY_LEVELS];
     
     TopicStats() noexcept 
         : messagesPublished(0)
@@ -116,7 +176,9 @@ struct alignas(64) TopicStats {
         , bytesTransferred(0)
         , lastPublishTime(0)
         , lastDeliveryTime(0)
-        , reserved(0) {}
+        , messagesConflated(0)
+        , publishedByPriority{}
+        , shedByPriority{} {}
 };
 
 // ============================================================================
@@ -125,20 +187,32 @@ struct alignas(64) TopicStats {
 // PSYCHOTIC: No std::function! Use function pointer + context for speed
 struct MessageHandler {
     typedef void (*HandlerFunc)(const Message& msg, void* context);
+    // AT_LEAST_ONCE subscribers ack by sequence (0 for AT_MOST_ONCE)
+    typedef void (*SequencedHandlerFunc)(const Message& msg, u64 sequence, void* context);
     
     HandlerFunc handler;
+    SequencedHandlerFunc sequencedHandler;
     void* context;
     NodeId targetNode;
     u32 filterMask;  // Message type filter
     
     MessageHandler() noexcept 
         : handler(nullptr)
+        , sequencedHandler(nullptr)
         , context(nullptr)
         , targetNode(INVALID_NODE_ID)
         , filterMask(0xFFFFFFFF) {}  // Accept all by default
         
     MessageHandler(HandlerFunc h, void* ctx) noexcept 
         : handler(h)
+        , sequencedHandler(nullptr)
+        , context(ctx)
+        , targetNode(INVALID_NODE_ID)
+        , filterMask(0xFFFFFFFF) {}
+    
+    MessageHandler(SequencedHandlerFunc h, void* ctx) noexcept 
+        : handler(nullptr)
+        , sequencedHandler(h)
         , context(ctx)
         , targetNode(INVALID_NODE_ID)
         , filterMask(0xFFFFFFFF) {}
@@ -167,14 +241,19 @@ public:
         , readPos(0)
         , committedPos(0) {}
     
-    // Try to reserve space for writing
-    bool reserve(u64& slot) noexcept {
-        u64 pos = writePos.fetch_add(1, std::memory_order_relaxed);
-        u64 readPosLocal = readPos.load(std::memory_order_acquire);
-        
-        if (pos - readPosLocal >= Size) {
-            return false;  // Buffer full
-        }
+    // Try to reserve space for writing while depth stays below limit
+    // PSYCHOTIC: CAS, not fetch_add - a failed reserve must not leave a hole
+    // that later writers would spin on forever in write()
+    bool reserve(u64& slot, u64 limit = Size) noexcept {
+        u64 pos = writePos.load(std::memory_order_relaxed);
+        do {
+            u64 readPosLocal = readPos.load(std::memory_order_acquire);
+            if (pos - readPosLocal >= limit) {
+                return false;  // Buffer full up to the limit
+            }
+        } while (!writePos.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed,
+                                                 std::memory_order_relaxed));
         
         slot = pos;
         return true;
@@ -220,26 +299,181 @@ public:
         u64 r = readPos.load(std::memory_order_relaxed);
         return (w >= r) ? (w - r) : 0;
     }
+    
+    // Reserved + committed slots not yet read (what admission sees)
+    size_t depth() const noexcept {
+        u64 w = writePos.load(std::memory_order_relaxed);
+        u64 r = readPos.load(std::memory_order_relaxed);
+        return (w >= r) ? (w - r) : 0;
+    }
+};
+
+// ============================================================================
+// CONFLATION TABLE - Last-value slots for conflated topics
+// ============================================================================
+// PSYCHOTIC: Memory is bounded by key count, not by how far a consumer lags.
+// Each key owns a seqlock-protected slot; a publish overwrites it and sets the
+// key's dirty bit. A drain swaps each bitmap word with zero, so it visits only
+// keys that changed since the previous drain and sees their newest value.
+constexpr u32 MAX_CONFLATION_KEYS = 16384;
+
+struct alignas(128) ConflatedSlot {
+    AtomicU64 sequence;        // Seqlock: odd while a writer is inside
+    Message message;           // Newest value for this key
+    
+    ConflatedSlot() noexcept : sequence(0), message() {}
+};
+
+struct ConflationTable {
+    ConflatedSlot* slots;      // keyCapacity slots
+    AtomicU64* dirty;          // One bit per key
+    u32 keyCapacity;           // Multiple of 64
+    u32 dirtyWords;            // keyCapacity / 64
+    
+    explicit ConflationTable(u32 capacity) noexcept
+        : slots(new ConflatedSlot[capacity])
+        , dirty(new AtomicU64[capacity / 64])
+        , keyCapacity(capacity)
+        , dirtyWords(capacity / 64) {
+        for (u32 i = 0; i < dirtyWords; ++i) {
+            dirty[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    
+    ~ConflationTable() noexcept {
+        delete[] slots;
+        delete[] dirty;
+    }
+    
+    ConflationTable(const ConflationTable&) = delete;
+    ConflationTable& operator=(const ConflationTable&) = delete;
+    
+    // Overwrite a key's value. Returns true if the previous value was
+    // never drained (i.e. it has just been conflated away).
+    bool write(u32 key, const Message& msg) noexcept {
+        ConflatedSlot& slot = slots[key];
+        
+        // Writers exclude each other by moving the sequence even -> odd
+        u64 seq = slot.sequence.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((seq & 1) == 0 &&
+                slot.sequence.compare_exchange_weak(seq, seq + 1,
+                                                    std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+                break;
+            }
+            _mm_pause();
+            seq = slot.sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        
+        std::memcpy(&slot.message, &msg, sizeof(Message));
+        slot.sequence.store(seq + 2, std::memory_order_release);
+        
+        const u64 bit = 1ULL << (key & 63);
+        return (dirty[key >> 6].fetch_or(bit, std::memory_order_release) & bit) != 0;
+    }
+    
+    // Consistent copy of a key's value. Returns false if never written.
+    bool read(u32 key, Message& out) const noexcept {
+        const ConflatedSlot& slot = slots[key];
+        for (;;) {
+            const u64 before = slot.sequence.load(std::memory_order_acquire);
+            if (before == 0) {
+                return false;
+            }
+            if (before & 1) {
+                _mm_pause();
+                continue;
+            }
+            std::memcpy(&out, &slot.message, sizeof(Message));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                return true;
+            }
+        }
+    }
 };
 
 // ============================================================================
 // TOPIC INFO - Runtime information for a topic
 // ============================================================================
 struct TopicInfo {
+    TopicId id;                                 // Index slot owner check
     char name[64];                              // Topic name
     MessageRingBuffer<65536>* buffer;           // 64K messages per topic
+    MessageRingBuffer<EXPRESS_LANE_SIZE>* express; // CRITICAL/HIGH reserved lane
     tbb::concurrent_vector<SubscriptionId> subscribers;
     TopicStats stats;
     AtomicU32 active;
     MessagePriority minPriority;                // Minimum priority to accept
+    TopicMode mode;                             // Queued or conflated
+    ConflationTable* conflation;                // CONFLATED only (buffer is null)
+    u32 shedDepth[PRIORITY_LEVELS];             // Main-ring depth limit per priority
+    AtomicU32 stalledSubscribers;               // AT_LEAST_ONCE windows full - their copies shed
     
     TopicInfo() noexcept 
-        : name{}
+        : id(INVALID_TOPIC_ID)
+        , name{}
         , buffer(nullptr)
+        , express(nullptr)
         , subscribers()
         , stats()
         , active(1)
-        , minPriority(MessagePriority::BULK) {}
+        , minPriority(MessagePriority::BULK)
+        , mode(TopicMode::QUEUED)
+        , conflation(nullptr)
+        , shedDepth{}
+        , stalledSubscribers(0) {}
+};
+
+// ============================================================================
+// IN-FLIGHT WINDOW - AT_LEAST_ONCE sequencing per subscriber
+// ============================================================================
+// PSYCHOTIC: One allocation per subscription, none per message. Sequences
+// start at 1 and are dense, so seq & mask is the slot and a cumulative ack
+// frees everything up to it in O(1).
+constexpr u32 INFLIGHT_WINDOW_SIZE = 1024;              // Power of 2
+constexpr u32 INFLIGHT_WINDOW_MASK = INFLIGHT_WINDOW_SIZE - 1;
+constexpr u64 ACK_TIMEOUT_CYCLES = 1ull << 24;          // ~5ms at 3GHz
+
+struct alignas(64) InFlightWindow {
+    Message messages[INFLIGHT_WINDOW_SIZE];     // Copies for redelivery
+    u64 sentAt[INFLIGHT_WINDOW_SIZE];           // RDTSC of last (re)delivery
+    TimerNode timer;                            // Ack timeout, context = this
+    SubscriptionId subscription;
+    AtomicU32* stallCounter;                    // Topic's stalledSubscribers, null once deleted
+    u64 nextSequence;                           // Next sequence to assign
+    u64 ackedThrough;                           // Cumulative ack
+    u64 retryFrom;                              // Oldest sequence of the last go-back-N
+    u32 retryAttempts;                          // Go-back-N rounds without the head acked
+    bool stalled;                               // Window full
+    
+    InFlightWindow() noexcept 
+        : messages{}
+        , sentAt{}
+        , timer()
+        , subscription(INVALID_SUBSCRIPTION_ID)
+        , stallCounter(nullptr)
+        , nextSequence(1)
+        , ackedThrough(0)
+        , retryFrom(0)
+        , retryAttempts(0)
+        , stalled(false) {
+        timer.context = this;
+    }
+    
+    u64 inFlight() const noexcept { return nextSequence - 1 - ackedThrough; }
+    bool full() const noexcept { return inFlight() >= INFLIGHT_WINDOW_SIZE; }
+    
+    // Assign the next sequence and keep a copy until acked
+    u64 record(const Message& msg, u64 now) noexcept {
+        const u64 sequence = nextSequence++;
+        const u32 slot = static_cast<u32>(sequence) & INFLIGHT_WINDOW_MASK;
+        std::memcpy(&messages[slot], &msg, sizeof(Message));
+        sentAt[slot] = now;
+        return sequence;
+    }
 };
 
 // ============================================================================
@@ -250,6 +484,10 @@ struct SubscriberInfo {
     MessageHandler handler;
     AtomicU64 messagesReceived;
     AtomicU64 lastDeliveryTime;
+    AtomicU64 messagesRedelivered;
+    AtomicU64 messagesShed;        // Dead-lettered while the window was full
+    DeliveryMode deliveryMode;
+    InFlightWindow* window;        // AT_LEAST_ONCE only
     bool active;
     
     SubscriberInfo() noexcept 
@@ -257,6 +495,10 @@ struct SubscriberInfo {
         , handler()
         , messagesReceived(0)
         , lastDeliveryTime(0)
+        , messagesRedelivered(0)
+        , messagesShed(0)
+        , deliveryMode(DeliveryMode::AT_MOST_ONCE)
+        , window(nullptr)
         , active(false) {}
 };
 
@@ -268,6 +510,10 @@ private:
     // Topic registry - PSYCHOTIC: Using custom hash for TopicId!
     tbb::concurrent_hash_map<TopicId, TopicInfo*, IdHashCompare<TopicId>> topics;
     
+    // Publish-side view of the registry - plain loads under an EpochGuard,
+    // deleted topics are retired through EBR instead of freed in place
+    std::atomic<TopicInfo*> topicIndex[TOPIC_INDEX_SIZE];
+    
     // Subscriber registry
     tbb::concurrent_hash_map<SubscriptionId, SubscriberInfo, IdHashCompare<SubscriptionId>> subscribers;
     
@@ -284,12 +530,25 @@ private:
         AtomicU64 totalMessagesDropped;
         AtomicU64 totalBytesTransferred;
         AtomicU64 deadLetterCount;
+        AtomicU64 totalMessagesShed;
+        AtomicU64 queuedMessages;       // Admitted but not yet delivered, all topics
     } stats;
     
+    // Broker-wide shedding depth per priority (messages across all topics)
+    AtomicU64 brokerShedDepth[PRIORITY_LEVELS];
+    
+    // Redelivery and expiry timers - the wheels share one lock, the slots
+    // come from a lock-free pool and stay constructed between uses
+    TimerWheel redeliveryWheel;
+    Spinlock redeliveryLock;
+    ObjectPool<RedeliverySlot> redeliverySlots;
+    TimerWheel ackWheel;            // AT_LEAST_ONCE ack timeouts, same lock
+    
     // Configuration
     static constexpr u32 MAX_TOPICS = 1024;
     static constexpr u32 MAX_SUBSCRIPTIONS = 65536;
     static constexpr u32 MAX_DEAD_LETTERS = 10000;
+    static constexpr u64 BROKER_QUEUE_BUDGET = 4194304;  // 4M messages = 256MB queued
     
 public:
     // Constructor/Destructor
@@ -298,6 +557,8 @@ public:
     
     // Topic management
     TopicId createTopic(const char* name, MessagePriority minPriority = MessagePriority::BULK) noexcept;
+    TopicId createConflatedTopic(const char* name, u32 keyCapacity = MAX_CONFLATION_KEYS,
+                                 MessagePriority minPriority = MessagePriority::BULK) noexcept;
     bool deleteTopic(TopicId topic) noexcept;
     bool topicExists(TopicId topic) const noexcept;
     
@@ -306,15 +567,33 @@ public:
     bool publishBatch(TopicId topic, const Message* messages, u32 count, MessagePriority priority = MessagePriority::NORMAL) noexcept;
     bool publishEnvelope(const MessageEnvelope& envelope) noexcept;
     
+    // Conflated topics - publish() keys by the first id after the header
+    // (symbolId / streamId / strategyId); these take an explicit key
+    bool publishConflated(TopicId topic, u32 key, const Message& msg,
+                          MessagePriority priority = MessagePriority::NORMAL) noexcept;
+    bool readConflated(TopicId topic, u32 key, Message& outMsg) const noexcept;
+    
+    // Load shedding - per-topic ring watermarks and broker-wide queue budget
+    bool setTopicWatermarks(TopicId topic, const SheddingWatermarks& watermarks) noexcept;
+    void setBrokerWatermarks(const SheddingWatermarks& watermarks,
+                             u64 queueBudget = BROKER_QUEUE_BUDGET) noexcept;
+    
     // Subscribing
-    SubscriptionId subscribe(TopicId topic, MessageHandler handler) noexcept;
+    SubscriptionId subscribe(TopicId topic, MessageHandler handler,
+                             DeliveryMode mode = DeliveryMode::AT_MOST_ONCE) noexcept;
     bool unsubscribe(SubscriptionId subscription) noexcept;
     bool setMessageFilter(SubscriptionId subscription, u32 messageTypeMask) noexcept;
     
+    // AT_LEAST_ONCE - cumulative: acking N acks every sequence <= N
+    bool acknowledge(SubscriptionId subscription, u64 sequence) noexcept;
+    u64 getUnackedCount(SubscriptionId subscription) const noexcept;
+    
     // Message processing
     void processMessages() noexcept;
     void processTopic(TopicId topic) noexcept;
     bool routeMessage(const MessageEnvelope& envelope) noexcept;
+    u32 processTimers() noexcept;
+    u64 getPendingRedeliveries() const noexcept;
     
     // Dead letter queue
     bool sendToDeadLetter(const MessageEnvelope& envelope, u32 reason) noexcept;
@@ -326,6 +605,8 @@ public:
     u64 getTotalMessagesRouted() const noexcept { return stats.totalMessagesRouted.load(); }
     u64 getTotalMessagesDropped() const noexcept { return stats.totalMessagesDropped.load(); }
     u64 getTotalBytesTransferred() const noexcept { return stats.totalBytesTransferred.load(); }
+    u64 getTotalMessagesShed() const noexcept { return stats.totalMessagesShed.load(); }
+    u64 getQueuedMessages() const noexcept { return stats.queuedMessages.load(); }
     
     // Utility
     TopicId getTopicByName(const char* name) const noexcept;
@@ -334,8 +615,21 @@ public:
     
 private:
     // Internal helpers
+    TopicInfo* lookupTopic(TopicId topic) const noexcept;   // Caller holds an EpochGuard
+    TopicId registerTopic(TopicInfo* info) noexcept;
     bool deliverToSubscriber(const Message& msg, const SubscriberInfo& subscriber) noexcept;
+    void deliverToSubscribers(TopicInfo* topic, const Message& msg) noexcept;
+    AdmissionResult enqueue(TopicInfo* topic, const Message& msg, MessagePriority priority) noexcept;
+    bool conflate(TopicInfo* topic, u32 key, const Message& msg) noexcept;
+    void drainConflated(TopicInfo* topic) noexcept;
     bool isMessageExpired(const MessageEnvelope& envelope) const noexcept;
+    bool scheduleRedelivery(const MessageEnvelope& envelope) noexcept;
+    void redeliver(RedeliverySlot* slot) noexcept;
+    void releaseRedeliverySlot(RedeliverySlot* slot) noexcept;
+    void redeliverUnacked(SubscriberInfo& subscriber) noexcept;
+    void deadLetterForSubscriber(const SubscriberInfo& subscriber, const Message& msg,
+                                 u32 attempts, u32 reason) noexcept;
+    void releaseWindow(SubscriberInfo& subscriber) noexcept;
     void updateTopicStats(TopicInfo* topic, bool delivered, u64 bytes) noexcept;
 };
 
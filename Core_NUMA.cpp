@@ -3,6 +3,8 @@
 
 #include "Core_NUMA.h"
 #include <cstdio>
+#include <cstdlib>
+#include <thread>
 
 #if AARENDOCORE_PLATFORM_WINDOWS
     #include <windows.h>
@@ -82,20 +84,35 @@ bool NumaMemoryPool::initialize(u32 nodeCount, usize poolSizePerNode) noexcept {
     
     nodeCount_ = nodeCount;
     
-    // Initialize per-node pools
+    // Initialize per-node pools - in parallel, each zeroed (and so faulted
+    // in) by a thread on its own node instead of all on the caller's
+    struct PoolInit {
+        NodePool* nodes;
+        usize size;
+    } init = { nodes_, poolSizePerNode };
+    
+    u32 nodeIds[MAX_NUMA_NODES];
     for (u32 i = 0; i < nodeCount_; ++i) {
-        if (!nodes_[i].pool.initialize(poolSizePerNode, NUMA_PAGE)) {
-            // Cleanup on failure
-            for (u32 j = 0; j < i; ++j) {
-                nodes_[j].pool.release();
-            }
-            return false;
-        }
-        
+        nodeIds[i] = i;
         nodes_[i].nodeId = i;
         nodes_[i].sessionCount.store(0);
     }
     
+    const bool created = RunOnNumaNodes(nodeIds, nodeCount_,
+        [](u32 index, u32 nodeId, void* context) noexcept {
+            (void)nodeId;
+            PoolInit* pools = static_cast<PoolInit*>(context);
+            return pools->nodes[index].pool.initialize(pools->size, NUMA_PAGE);
+        }, &init);
+    
+    if (!created) {
+        // Cleanup on failure - release skips pools that never initialized
+        for (u32 i = 0; i < nodeCount_; ++i) {
+            nodes_[i].pool.release();
+        }
+        return false;
+    }
+    
     nextNode_.store(0);
     initialized_ = true;
     
@@ -363,6 +380,322 @@ void FreeNumaMemory(void* ptr) noexcept {
     FreeAligned(ptr);
 }
 
+bool RunOnNumaNodes(const u32* nodeIds, u32 count, NumaNodeTask task, void* context) noexcept {
+    if (!nodeIds || !task || count == 0 || count > MAX_NUMA_NODES) {
+        return false;
+    }
+    
+    // One node - the caller is already where it wants to be
+    if (count == 1) {
+        return task(0, nodeIds[0], context);
+    }
+    
+    bool results[MAX_NUMA_NODES] = {};
+    std::thread threads[MAX_NUMA_NODES];
+    for (u32 i = 0; i < count; ++i) {
+        try {
+            threads[i] = std::thread([=, &results]() noexcept {
+                SetThreadNumaAffinity(nodeIds[i]);
+                results[i] = task(i, nodeIds[i], context);
+            });
+        } catch (...) {
+            // No thread - still do the work, just not node-local
+            results[i] = task(i, nodeIds[i], context);
+        }
+    }
+    
+    bool succeeded = true;
+    for (u32 i = 0; i < count; ++i) {
+        if (threads[i].joinable()) {
+            threads[i].join();
+        }
+        succeeded = succeeded && results[i];
+    }
+    return succeeded;
+}
+
+// ============================================================================
+// CPU TOPOLOGY DISCOVERY
+// ============================================================================
+
+namespace {
+    CpuTopology g_cpuTopology;
+    std::atomic<bool> g_cpuTopologyReady{false};
+    Spinlock g_cpuTopologyLock;
+
+#if !AARENDOCORE_PLATFORM_WINDOWS
+    // Read a small sysfs file into buffer (returns false if missing)
+    bool ReadSysfsLine(const char* path, char* buffer, usize size) noexcept {
+        FILE* file = std::fopen(path, "r");
+        if (!file) {
+            return false;
+        }
+
+        bool ok = std::fgets(buffer, static_cast<int>(size), file) != nullptr;
+        std::fclose(file);
+        return ok;
+    }
+
+    bool ReadSysfsU32(const char* path, u32& value) noexcept {
+        char buffer[32];
+        if (!ReadSysfsLine(path, buffer, sizeof(buffer))) {
+            return false;
+        }
+        value = static_cast<u32>(std::strtoul(buffer, nullptr, 10));
+        return true;
+    }
+
+    // Parse kernel cpulist format ("0-3,8,10-11") into a bitmap
+    void ParseCpuList(const char* list, bool* cpus, u32 maxCpus) noexcept {
+        const char* p = list;
+        while (*p && *p != '\n') {
+            char* end = nullptr;
+            u32 first = static_cast<u32>(std::strtoul(p, &end, 10));
+            if (end == p) {
+                break;
+            }
+
+            u32 last = first;
+            p = end;
+            if (*p == '-') {
+                ++p;
+                last = static_cast<u32>(std::strtoul(p, &end, 10));
+                p = end;
+            }
+
+            for (u32 cpu = first; cpu <= last && cpu < maxCpus; ++cpu) {
+                cpus[cpu] = true;
+            }
+
+            if (*p == ',') {
+                ++p;
+            }
+        }
+    }
+#endif
+
+    void BuildFallbackTopology(CpuTopology& topology) noexcept {
+        u32 count = std::thread::hardware_concurrency();
+        if (count == 0) {
+            count = 1;
+        }
+        if (count > MAX_TOPOLOGY_CPUS) {
+            count = MAX_TOPOLOGY_CPUS;
+        }
+
+        for (u32 i = 0; i < count; ++i) {
+            topology.cpus[i] = {i, i, 0, 0, 0, true, false};
+        }
+
+        topology.cpuCount = count;
+        topology.coreCount = count;
+        topology.nodeCount = 1;
+        topology.isolatedCount = 0;
+        topology.discovered = false;
+    }
+}
+
+bool DiscoverCpuTopology(CpuTopology& topology) noexcept {
+    topology = {};
+
+#if AARENDOCORE_PLATFORM_WINDOWS
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    if (length == 0) {
+        BuildFallbackTopology(topology);
+        return false;
+    }
+
+    byte* buffer = static_cast<byte*>(AllocateAligned(length, CACHE_LINE));
+    if (!buffer) {
+        BuildFallbackTopology(topology);
+        return false;
+    }
+
+    auto* info = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer);
+    if (!GetLogicalProcessorInformationEx(RelationAll, info, &length)) {
+        FreeAligned(buffer);
+        BuildFallbackTopology(topology);
+        return false;
+    }
+
+    // Node membership per logical CPU (cpuId = group * 64 + bit)
+    u32 nodeOfCpu[MAX_TOPOLOGY_CPUS] = {};
+    u32 packageOfCpu[MAX_TOPOLOGY_CPUS] = {};
+    u32 packageCount = 0;
+
+    for (DWORD offset = 0; offset < length; ) {
+        auto* entry = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer + offset);
+
+        if (entry->Relationship == RelationNumaNode) {
+            const GROUP_AFFINITY& mask = entry->NumaNode.GroupMask;
+            for (u32 bit = 0; bit < 64; ++bit) {
+                u32 cpuId = mask.Group * 64u + bit;
+                if ((mask.Mask & (1ULL << bit)) && cpuId < MAX_TOPOLOGY_CPUS) {
+                    nodeOfCpu[cpuId] = entry->NumaNode.NodeNumber;
+                }
+            }
+            if (entry->NumaNode.NodeNumber + 1 > topology.nodeCount) {
+                topology.nodeCount = entry->NumaNode.NodeNumber + 1;
+            }
+        } else if (entry->Relationship == RelationProcessorPackage) {
+            for (WORD g = 0; g < entry->Processor.GroupCount; ++g) {
+                const GROUP_AFFINITY& mask = entry->Processor.GroupMask[g];
+                for (u32 bit = 0; bit < 64; ++bit) {
+                    u32 cpuId = mask.Group * 64u + bit;
+                    if ((mask.Mask & (1ULL << bit)) && cpuId < MAX_TOPOLOGY_CPUS) {
+                        packageOfCpu[cpuId] = packageCount;
+                    }
+                }
+            }
+            ++packageCount;
+        }
+
+        offset += entry->Size;
+    }
+
+    for (DWORD offset = 0; offset < length; ) {
+        auto* entry = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer + offset);
+
+        if (entry->Relationship == RelationProcessorCore) {
+            const GROUP_AFFINITY& mask = entry->Processor.GroupMask[0];
+            u32 smtIndex = 0;
+
+            for (u32 bit = 0; bit < 64; ++bit) {
+                u32 cpuId = mask.Group * 64u + bit;
+                if (!(mask.Mask & (1ULL << bit)) || cpuId >= MAX_TOPOLOGY_CPUS ||
+                    topology.cpuCount >= MAX_TOPOLOGY_CPUS) {
+                    continue;
+                }
+
+                topology.cpus[topology.cpuCount++] = {
+                    cpuId, topology.coreCount, packageOfCpu[cpuId],
+                    nodeOfCpu[cpuId], smtIndex++, true, false
+                };
+            }
+
+            ++topology.coreCount;
+        }
+
+        offset += entry->Size;
+    }
+
+    FreeAligned(buffer);
+#else
+    char path[128];
+    char line[1024];
+
+    bool online[MAX_TOPOLOGY_CPUS] = {};
+    bool isolated[MAX_TOPOLOGY_CPUS] = {};
+    u32 nodeOfCpu[MAX_TOPOLOGY_CPUS] = {};
+
+    if (!ReadSysfsLine("/sys/devices/system/cpu/online", line, sizeof(line))) {
+        BuildFallbackTopology(topology);
+        return false;
+    }
+    ParseCpuList(line, online, MAX_TOPOLOGY_CPUS);
+
+    if (ReadSysfsLine("/sys/devices/system/cpu/isolated", line, sizeof(line))) {
+        ParseCpuList(line, isolated, MAX_TOPOLOGY_CPUS);
+    }
+
+    // Node membership from /sys/devices/system/node/nodeN/cpulist
+    for (u32 node = 0; node < MAX_NUMA_NODES; ++node) {
+        std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+        if (!ReadSysfsLine(path, line, sizeof(line))) {
+            continue;
+        }
+
+        bool nodeCpus[MAX_TOPOLOGY_CPUS] = {};
+        ParseCpuList(line, nodeCpus, MAX_TOPOLOGY_CPUS);
+        for (u32 cpu = 0; cpu < MAX_TOPOLOGY_CPUS; ++cpu) {
+            if (nodeCpus[cpu]) {
+                nodeOfCpu[cpu] = node;
+            }
+        }
+        topology.nodeCount = node + 1;
+    }
+
+    // Physical core identity is (package, core_id); assign dense core numbers
+    u32 corePackage[MAX_TOPOLOGY_CPUS];
+    u32 coreLocalId[MAX_TOPOLOGY_CPUS];
+    u32 coreThreads[MAX_TOPOLOGY_CPUS];
+
+    for (u32 cpu = 0; cpu < MAX_TOPOLOGY_CPUS; ++cpu) {
+        if (!online[cpu]) {
+            continue;
+        }
+
+        u32 packageId = 0;
+        u32 localCore = cpu;
+        std::snprintf(path, sizeof(path),
+            "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+        ReadSysfsU32(path, packageId);
+        std::snprintf(path, sizeof(path),
+            "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu);
+        ReadSysfsU32(path, localCore);
+
+        u32 coreId = topology.coreCount;
+        for (u32 c = 0; c < topology.coreCount; ++c) {
+            if (corePackage[c] == packageId && coreLocalId[c] == localCore) {
+                coreId = c;
+                break;
+            }
+        }
+
+        if (coreId == topology.coreCount) {
+            corePackage[coreId] = packageId;
+            coreLocalId[coreId] = localCore;
+            coreThreads[coreId] = 0;
+            ++topology.coreCount;
+        }
+
+        topology.cpus[topology.cpuCount++] = {
+            cpu, coreId, packageId, nodeOfCpu[cpu], coreThreads[coreId]++,
+            true, isolated[cpu]
+        };
+
+        if (isolated[cpu]) {
+            ++topology.isolatedCount;
+        }
+    }
+#endif
+
+    if (topology.cpuCount == 0) {
+        BuildFallbackTopology(topology);
+        return false;
+    }
+
+    if (topology.nodeCount == 0) {
+        topology.nodeCount = 1;
+    }
+
+    topology.discovered = true;
+    return true;
+}
+
+const CpuTopology& GetCpuTopology() noexcept {
+    if (!g_cpuTopologyReady.load(MemoryOrderAcquire)) {
+        g_cpuTopologyLock.lock();
+        if (!g_cpuTopologyReady.load(MemoryOrderRelaxed)) {
+            DiscoverCpuTopology(g_cpuTopology);
+            g_cpuTopologyReady.store(true, MemoryOrderRelease);
+        }
+        g_cpuTopologyLock.unlock();
+    }
+    return g_cpuTopology;
+}
+
+const LogicalCpuInfo* FindLogicalCpu(u32 cpuId) noexcept {
+    const CpuTopology& topology = GetCpuTopology();
+    for (u32 i = 0; i < topology.cpuCount; ++i) {
+        if (topology.cpus[i].cpuId == cpuId) {
+            return &topology.cpus[i];
+        }
+    }
+    return nullptr;
+}
+
 bool IsNumaAvailable() noexcept {
     if (!g_numaSystem.available) {
         InitializeNUMA();
@@ -37,6 +37,32 @@ struct NumaNodeInfo {
     bool available;                          // Node is available
 };
 
+// ============================================================================
+// CPU TOPOLOGY - Real cores, SMT siblings and node membership
+// ============================================================================
+
+constexpr u32 MAX_TOPOLOGY_CPUS = MAX_WORKER_THREADS; // Logical CPUs tracked
+constexpr u32 INVALID_CPU_ID = UINT32_MAX;            // Unpinned marker
+
+struct LogicalCpuInfo {
+    u32 cpuId;                               // OS logical CPU number
+    u32 coreId;                              // Physical core (unique per system)
+    u32 packageId;                           // Socket
+    u32 numaNode;                            // Owning NUMA node
+    u32 smtIndex;                            // 0 = primary thread of its core
+    bool online;                             // CPU is online
+    bool isolated;                           // Excluded from general scheduling
+};
+
+struct CpuTopology {
+    LogicalCpuInfo cpus[MAX_TOPOLOGY_CPUS];  // Indexed by discovery order
+    u32 cpuCount;                            // Logical CPUs discovered
+    u32 coreCount;                           // Physical cores discovered
+    u32 nodeCount;                           // NUMA nodes with CPUs
+    u32 isolatedCount;                       // Isolated logical CPUs
+    bool discovered;                         // Came from the OS, not a fallback
+};
+
 // ============================================================================
 // NUMA MEMORY STATISTICS - Per-node tracking
 // ============================================================================
@@ -129,6 +155,28 @@ void* AllocateOnNumaNode(u32 nodeId, usize size, usize alignment = CACHE_LINE) n
 // Free NUMA allocated memory
 void FreeNumaMemory(void* ptr) noexcept;
 
+// Origin: Startup work for one node - index is the entry in the run
+typedef bool (*NumaNodeTask)(u32 index, u32 nodeId, void* context);
+
+// Run task once per entry of nodeIds, each on a thread bound to that node,
+// and wait for all - what a task allocates and touches is first-touched on
+// its node. A single entry runs on the caller. True if every task succeeded.
+bool RunOnNumaNodes(const u32* nodeIds, u32 count, NumaNodeTask task, void* context) noexcept;
+
+// ============================================================================
+// CPU TOPOLOGY DISCOVERY
+// ============================================================================
+
+// Discover topology from the OS (sysfs on Linux, GetLogicalProcessorInformationEx
+// on Windows). Falls back to one core per hardware thread on node 0.
+bool DiscoverCpuTopology(CpuTopology& topology) noexcept;
+
+// Cached topology, discovered on first use
+const CpuTopology& GetCpuTopology() noexcept;
+
+// Look up a logical CPU by OS number (nullptr if unknown)
+const LogicalCpuInfo* FindLogicalCpu(u32 cpuId) noexcept;
+
 // ============================================================================
 // NUMA-AWARE DATA STRUCTURE - Distributes data across nodes
 // ============================================================================
@@ -0,0 +1,170 @@
+//===--- Core_ObjectPool.cpp - Lock-Free Fixed-Size Object Pool ----------===//
+//
+// COMPILATION LEVEL: 2
+// ORIGIN: Implementation for Core_ObjectPool.h
+// DEPENDENCIES: Core_ObjectPool.h
+// DEPENDENTS: None
+//
+// The pool itself is a template; this file holds the thread numbering it
+// shares across instantiations and the contention benchmark.
+//===----------------------------------------------------------------------===//
+
+#include "Core_ObjectPool.h"
+#include <chrono>
+#include <thread>
+
+namespace AARendoCoreGLM {
+
+namespace {
+
+std::atomic<u32> g_nextPoolThreadSlot{0};
+thread_local u32 t_poolThreadSlot = OBJECT_POOL_NIL;
+
+} // anonymous namespace
+
+u32 GetObjectPoolThreadSlot() noexcept {
+    if (t_poolThreadSlot == OBJECT_POOL_NIL) {
+        t_poolThreadSlot = g_nextPoolThreadSlot.fetch_add(1, MemoryOrderRelaxed);
+    }
+    return t_poolThreadSlot;
+}
+
+// ==========================================================================
+// CONTENTION BENCHMARK
+// ==========================================================================
+
+namespace {
+
+constexpr u32 BENCH_POOL_CAPACITY = 4096;
+constexpr u32 BENCH_HELD_PER_ROUND = 8;     // Objects a thread holds at once
+
+// Origin: 256 bytes like a DAGNode; owner catches double hand-out
+struct alignas(64) BenchPoolObject {
+    std::atomic<u32> owner{0};
+    u64 next = 0;                           // Legacy pool's free-list link
+    u8 payload[240];
+};
+
+// Origin: The free list DAGNodePool used before ObjectPool - index in the
+// head, link in the node, no tag
+class LegacyIndexPool {
+public:
+    LegacyIndexPool() noexcept : allocatedCount_(0), freeListHead_(UINT64_MAX) {}
+
+    BenchPoolObject* allocate() noexcept {
+        u64 head = freeListHead_.load(MemoryOrderAcquire);
+        while (head != UINT64_MAX) {
+            BenchPoolObject* object = &objects_[head];
+            u64 next = object->next;
+            if (freeListHead_.compare_exchange_weak(head, next,
+                                                    MemoryOrderRelease,
+                                                    MemoryOrderAcquire)) {
+                return object;
+            }
+        }
+
+        u64 index = allocatedCount_.fetch_add(1, MemoryOrderRelaxed);
+        if (index >= BENCH_POOL_CAPACITY) {
+            allocatedCount_.fetch_sub(1, MemoryOrderRelaxed);
+            return nullptr;
+        }
+        return &objects_[index];
+    }
+
+    void deallocate(BenchPoolObject* object) noexcept {
+        u64 index = static_cast<u64>(object - objects_);
+        u64 head = freeListHead_.load(MemoryOrderAcquire);
+        do {
+            object->next = head;
+        } while (!freeListHead_.compare_exchange_weak(head, index,
+                                                      MemoryOrderRelease,
+                                                      MemoryOrderAcquire));
+    }
+
+private:
+    BenchPoolObject objects_[BENCH_POOL_CAPACITY];
+    AtomicU64 allocatedCount_;
+    AtomicU64 freeListHead_;
+};
+
+} // anonymous namespace
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestObjectPoolContention(
+    u32 threads, u32 pairsPerThread, u32 usePool, u64* corrupted) {
+    if (threads == 0 || threads > 64) {
+        threads = 4;
+    }
+    if (pairsPerThread == 0) {
+        pairsPerThread = 1000000;  // Default 1M allocate/deallocate pairs
+    }
+
+    LegacyIndexPool* legacy = nullptr;
+    ObjectPool<BenchPoolObject>* pool = nullptr;
+    if (usePool) {
+        pool = new(std::nothrow) ObjectPool<BenchPoolObject>();
+        if (!pool || !pool->initialize(BENCH_POOL_CAPACITY, -1, CACHE_LINE, false)) {
+            delete pool;
+            return 0;
+        }
+    } else {
+        legacy = new(std::nothrow) LegacyIndexPool();
+        if (!legacy) {
+            return 0;
+        }
+    }
+
+    std::atomic<u64> totalNs{0};
+    std::atomic<u64> bad{0};
+
+    std::thread* workers = new std::thread[threads];
+    for (u32 t = 0; t < threads; ++t) {
+        workers[t] = std::thread([&, t]() {
+            const u32 me = t + 1;
+            BenchPoolObject* held[BENCH_HELD_PER_ROUND];
+            u64 localBad = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (u32 done = 0; done < pairsPerThread; done += BENCH_HELD_PER_ROUND) {
+                u32 count = 0;
+                for (; count < BENCH_HELD_PER_ROUND; ++count) {
+                    held[count] = usePool ? pool->allocate() : legacy->allocate();
+                    if (!held[count]) {
+                        break;
+                    }
+                    localBad += (held[count]->owner.exchange(me, MemoryOrderAcquire) != 0);
+                }
+
+                for (u32 i = 0; i < count; ++i) {
+                    held[i]->owner.store(0, MemoryOrderRelease);
+                    if (usePool) {
+                        pool->deallocate(held[i]);
+                    } else {
+                        legacy->deallocate(held[i]);
+                    }
+                }
+            }
+
+            auto end = std::chrono::high_resolution_clock::now();
+            totalNs.fetch_add(static_cast<u64>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()),
+                MemoryOrderRelaxed);
+            bad.fetch_add(localBad, MemoryOrderRelaxed);
+        });
+    }
+
+    for (u32 t = 0; t < threads; ++t) {
+        workers[t].join();
+    }
+    delete[] workers;
+    delete pool;
+    delete legacy;
+
+    if (corrupted) {
+        *corrupted = bad.load(MemoryOrderRelaxed);
+    }
+
+    const u64 pairs = static_cast<u64>(threads) * pairsPerThread;
+    return totalNs.load(MemoryOrderRelaxed) / (pairs ? pairs : 1);
+}
+
+} // namespace AARendoCoreGLM
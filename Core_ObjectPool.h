@@ -0,0 +1,469 @@
+//===--- Core_ObjectPool.h - Lock-Free Fixed-Size Object Pool ------------===//
+//
+// COMPILATION LEVEL: 2 (Depends on Atomic, Memory and NUMA)
+// ORIGIN: NEW - One pool for DAG nodes, sessions, envelopes and contexts
+// DEPENDENCIES: Core_Platform.h, Core_Types.h, Core_Atomic.h, Core_Memory.h,
+//               Core_NUMA.h
+// DEPENDENTS: DAGNode, SessionManager, MessageBroker, DAGExecutor
+//
+// Capacity is fixed at initialize() and placed on one NUMA node. Free slots
+// are linked by index through a side array; the global head packs a 32-bit
+// generation tag next to the index, so a head that was popped and pushed
+// back between a load and its CAS no longer matches (no ABA).
+//
+// Each thread talks to its own cache first and only touches the global
+// list in batches of OBJECT_POOL_BATCH - one CAS per 32 objects instead of
+// one per object. A cache has a lock so that an exhausted pool can raid the
+// other caches; its owner is the only one who normally takes it, so the
+// common path is an uncontended exchange on a line nobody else writes.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_OBJECTPOOL_H
+#define AARENDOCORE_CORE_OBJECTPOOL_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include "Core_Atomic.h"
+#include "Core_Memory.h"
+#include "Core_NUMA.h"
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// CONFIGURATION
+// ==========================================================================
+
+constexpr u32 OBJECT_POOL_MAX_THREADS = 64;     // Caches per pool (power of 2)
+constexpr u32 OBJECT_POOL_CACHE_SIZE = 64;      // Slots a thread cache holds
+constexpr u32 OBJECT_POOL_BATCH = 32;           // Refill / spill granularity
+constexpr u32 OBJECT_POOL_NIL = 0xFFFFFFFF;
+constexpr u8 OBJECT_POOL_POISON = 0xDD;
+
+static_assert((OBJECT_POOL_MAX_THREADS & (OBJECT_POOL_MAX_THREADS - 1)) == 0,
+              "OBJECT_POOL_MAX_THREADS must be a power of 2");
+static_assert(OBJECT_POOL_BATCH * 2 <= OBJECT_POOL_CACHE_SIZE,
+              "A refill must leave room for a spill");
+
+// Dense per-thread number, assigned on first use. Threads past
+// OBJECT_POOL_MAX_THREADS share caches - still correct, just contended.
+AARENDOCORE_API u32 GetObjectPoolThreadSlot() noexcept;
+
+// ==========================================================================
+// OBJECT POOL
+// ==========================================================================
+
+// Origin: Treiber stack of indices with a tagged head plus per-thread caches
+// Scope: Any T; either typed (create/destroy) or raw slots kept constructed
+//        in place by the owner (allocate/deallocate)
+template<typename T>
+class ObjectPool {
+public:
+    ObjectPool() noexcept
+        : objects_(nullptr)
+        , next_(nullptr)
+        , caches_(nullptr)
+        , capacity_(0)
+        , numaNode_(-1)
+        , poison_(false)
+        , head_(OBJECT_POOL_NIL)
+        , highWater_(0) {
+    }
+
+    ~ObjectPool() noexcept {
+        shutdown();
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Reserve capacity slots on numaNode (-1 = wherever the allocator puts
+    // them). poison fills freed typed objects with OBJECT_POOL_POISON and
+    // asserts it is intact on the next create - never enable it for pools
+    // whose slots stay constructed between uses.
+    bool initialize(u32 capacity, i32 numaNode = -1, usize alignment = CACHE_LINE,
+                    bool poison = AARENDOCORE_DEBUG != 0) noexcept {
+        if (objects_ || capacity == 0 || capacity == OBJECT_POOL_NIL) {
+            return false;
+        }
+
+        const usize bytes = sizeof(T) * static_cast<usize>(capacity);
+        objects_ = static_cast<T*>(numaNode >= 0
+            ? AllocateOnNumaNode(static_cast<u32>(numaNode), bytes, alignment)
+            : AllocateAligned(bytes, alignment));
+        next_ = static_cast<AtomicU32*>(
+            AllocateAligned(sizeof(AtomicU32) * capacity, CACHE_LINE));
+        caches_ = static_cast<ThreadCache*>(
+            AllocateAligned(sizeof(ThreadCache) * OBJECT_POOL_MAX_THREADS, CACHE_LINE));
+
+        if (!objects_ || !next_ || !caches_) {
+            numaNode_ = numaNode;
+            shutdown();
+            return false;
+        }
+
+        for (u32 i = 0; i < capacity; ++i) {
+            new(&next_[i]) AtomicU32(OBJECT_POOL_NIL);
+        }
+        for (u32 i = 0; i < OBJECT_POOL_MAX_THREADS; ++i) {
+            new(&caches_[i]) ThreadCache();
+        }
+
+        capacity_ = capacity;
+        numaNode_ = numaNode;
+        poison_ = poison;
+        head_.store(OBJECT_POOL_NIL, MemoryOrderRelease);
+        highWater_.store(0, MemoryOrderRelease);
+        return true;
+    }
+
+    // Release the storage. Typed objects still alive are not destroyed.
+    void shutdown() noexcept {
+        if (objects_) {
+            if (numaNode_ >= 0) {
+                FreeNumaMemory(objects_);
+            } else {
+                FreeAligned(objects_);
+            }
+            objects_ = nullptr;
+        }
+        if (next_) {
+            FreeAligned(next_);
+            next_ = nullptr;
+        }
+        if (caches_) {
+            for (u32 i = 0; i < OBJECT_POOL_MAX_THREADS; ++i) {
+                caches_[i].~ThreadCache();
+            }
+            FreeAligned(caches_);
+            caches_ = nullptr;
+        }
+        capacity_ = 0;
+    }
+
+    // Fault the slot storage in now, from the calling thread - slots stay
+    // raw until created, so otherwise the first creates take the faults.
+    // Slots below the high water mark were handed out before (a pool that is
+    // prewarmed again) and are resident already, so the walk starts above
+    // them; the touch is an atomic OR of zero, so a slot carved concurrently
+    // keeps whatever its owner wrote.
+    void prefault() noexcept {
+        if (!objects_) {
+            return;
+        }
+        u8* bytes = reinterpret_cast<u8*>(objects_);
+        const usize size = sizeof(T) * static_cast<usize>(capacity_);
+        const usize carved = sizeof(T) * static_cast<usize>(highWater_.load(MemoryOrderAcquire));
+        for (usize offset = (carved + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE; offset < size; 
+             offset += PAGE_SIZE) {
+            std::atomic_ref<u8>(bytes[offset]).fetch_or(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Every slot free again. Callers must be quiet and hold no slot;
+    // typed objects still alive are not destroyed.
+    void reset() noexcept {
+        if (!caches_) {
+            return;
+        }
+        for (u32 i = 0; i < OBJECT_POOL_MAX_THREADS; ++i) {
+            caches_[i].count = 0;
+            caches_[i].allocations.store(0, MemoryOrderRelaxed);
+            caches_[i].deallocations.store(0, MemoryOrderRelaxed);
+        }
+        head_.store(OBJECT_POOL_NIL, MemoryOrderRelease);
+        highWater_.store(0, MemoryOrderRelease);
+    }
+
+    // ----------------------------------------------------------------------
+    // Raw slots - memory only, no constructor or destructor runs
+    // ----------------------------------------------------------------------
+
+    T* allocate() noexcept {
+        if (!objects_) {
+            return nullptr;
+        }
+
+        ThreadCache& cache = localCache();
+        cache.lock.lock();
+        if (cache.count == 0) {
+            refill(cache);
+        }
+        u32 index = OBJECT_POOL_NIL;
+        if (cache.count > 0) {
+            index = cache.items[--cache.count];
+            OwnerIncrement(cache.allocations);
+        }
+        cache.lock.unlock();
+
+        if (index == OBJECT_POOL_NIL) {
+            index = steal(cache);  // Exhausted - take what other caches hold
+            if (index == OBJECT_POOL_NIL) {
+                return nullptr;
+            }
+        }
+
+        return objects_ + index;
+    }
+
+    void deallocate(T* object) noexcept {
+        if (!owns(object)) {
+            return;  // Not from this pool
+        }
+
+        const u32 index = static_cast<u32>(object - objects_);
+        ThreadCache& cache = localCache();
+        cache.lock.lock();
+        if (cache.count == OBJECT_POOL_CACHE_SIZE) {
+            spill(cache);
+        }
+        cache.items[cache.count++] = index;
+        OwnerIncrement(cache.deallocations);
+        cache.lock.unlock();
+    }
+
+    // ----------------------------------------------------------------------
+    // Typed objects - constructed on the way out, destroyed on the way in
+    // ----------------------------------------------------------------------
+
+    template<typename... Args>
+    T* create(Args&&... args) noexcept {
+        T* memory = allocate();
+        if (!memory) {
+            return nullptr;
+        }
+        if (poison_) {
+            AARENDOCORE_ASSERT(isPoisoned(memory));  // Written after destroy()
+        }
+        return new(memory) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* object) noexcept {
+        if (!owns(object)) {
+            return;
+        }
+        object->~T();
+        if (poison_) {
+            std::memset(static_cast<void*>(object), OBJECT_POOL_POISON, sizeof(T));
+        }
+        deallocate(object);
+    }
+
+    // ----------------------------------------------------------------------
+    // Queries
+    // ----------------------------------------------------------------------
+
+    bool owns(const T* object) const noexcept {
+        return object && object >= objects_ && object < objects_ + capacity_;
+    }
+
+    u32 indexOf(const T* object) const noexcept {
+        return owns(object) ? static_cast<u32>(object - objects_) : OBJECT_POOL_NIL;
+    }
+
+    T* at(u32 index) noexcept { return index < capacity_ ? objects_ + index : nullptr; }
+    const T* at(u32 index) const noexcept { return index < capacity_ ? objects_ + index : nullptr; }
+    T* data() noexcept { return objects_; }
+    u32 getCapacity() const noexcept { return capacity_; }
+    bool isInitialized() const noexcept { return objects_ != nullptr; }
+
+    // Objects handed out and not yet returned - exact once callers are quiet
+    u32 getAllocatedCount() const noexcept {
+        if (!caches_) {
+            return 0;
+        }
+        u64 allocations = 0;
+        u64 deallocations = 0;
+        for (u32 i = 0; i < OBJECT_POOL_MAX_THREADS; ++i) {
+            allocations += caches_[i].allocations.load(MemoryOrderRelaxed);
+            deallocations += caches_[i].deallocations.load(MemoryOrderRelaxed);
+        }
+        return static_cast<u32>(allocations - deallocations);
+    }
+
+    bool isExhausted() const noexcept {
+        return getAllocatedCount() >= capacity_;
+    }
+
+    // Push this thread's cached slots back to the shared list - call before
+    // a worker exits so nothing waits on a dead cache until the next steal
+    void flushThreadCache() noexcept {
+        if (!caches_) {
+            return;
+        }
+        ThreadCache& cache = localCache();
+        cache.lock.lock();
+        while (cache.count > 0) {
+            const u32 count = cache.count < OBJECT_POOL_BATCH ? cache.count : OBJECT_POOL_BATCH;
+            pushChain(cache.items + cache.count - count, count);
+            cache.count -= count;
+        }
+        cache.lock.unlock();
+    }
+
+private:
+    // Origin: One thread's stash of free indices
+    struct alignas(CACHE_LINE) ThreadCache {
+        Spinlock lock;
+        u32 count = 0;
+        AtomicU64 allocations{0};       // Written under lock, summed lock-free
+        AtomicU64 deallocations{0};
+        u32 items[OBJECT_POOL_CACHE_SIZE];
+    };
+
+    static constexpr u64 packHead(u64 tag, u32 index) noexcept {
+        return (tag << 32) | index;
+    }
+
+    ThreadCache& localCache() noexcept {
+        return caches_[GetObjectPoolThreadSlot() & (OBJECT_POOL_MAX_THREADS - 1)];
+    }
+
+    // Pop up to maxCount linked slots with one CAS
+    u32 popChain(u32* out, u32 maxCount) noexcept {
+        u64 head = head_.load(MemoryOrderAcquire);
+        for (;;) {
+            u32 index = static_cast<u32>(head);
+            if (index == OBJECT_POOL_NIL) {
+                return 0;
+            }
+
+            // Links may change under us if another thread wins - the tag
+            // then fails the CAS and whatever was collected is discarded
+            u32 count = 0;
+            while (index != OBJECT_POOL_NIL && count < maxCount) {
+                out[count++] = index;
+                index = next_[index].load(MemoryOrderRelaxed);
+            }
+
+            if (head_.compare_exchange_weak(head, packHead((head >> 32) + 1, index),
+                                            MemoryOrderAcquire, MemoryOrderAcquire)) {
+                return count;
+            }
+        }
+    }
+
+    // Link items[0..count) and push them with one CAS
+    void pushChain(const u32* items, u32 count) noexcept {
+        for (u32 i = 0; i + 1 < count; ++i) {
+            next_[items[i]].store(items[i + 1], MemoryOrderRelaxed);
+        }
+
+        u64 head = head_.load(MemoryOrderRelaxed);
+        do {
+            next_[items[count - 1]].store(static_cast<u32>(head), MemoryOrderRelaxed);
+        } while (!head_.compare_exchange_weak(head, packHead((head >> 32) + 1, items[0]),
+                                              MemoryOrderRelease, MemoryOrderRelaxed));
+    }
+
+    // Never-used slots, handed out from the top of the array
+    u32 carve(u32* out, u32 maxCount) noexcept {
+        u32 base = highWater_.load(MemoryOrderRelaxed);
+        u32 count;
+        do {
+            if (base >= capacity_) {
+                return 0;
+            }
+            count = capacity_ - base < maxCount ? capacity_ - base : maxCount;
+        } while (!highWater_.compare_exchange_weak(base, base + count,
+                                                   MemoryOrderRelaxed, MemoryOrderRelaxed));
+
+        for (u32 i = 0; i < count; ++i) {
+            out[i] = base + count - 1 - i;  // Lowest index on top of the stack
+            if (poison_) {
+                std::memset(static_cast<void*>(objects_ + out[i]), OBJECT_POOL_POISON, sizeof(T));
+            }
+        }
+        return count;
+    }
+
+    // Cache is empty and locked
+    void refill(ThreadCache& cache) noexcept {
+        cache.count = popChain(cache.items, OBJECT_POOL_BATCH);
+        if (cache.count == 0) {
+            cache.count = carve(cache.items, OBJECT_POOL_BATCH);
+        }
+    }
+
+    // Cache is full and locked - the oldest half goes back
+    void spill(ThreadCache& cache) noexcept {
+        pushChain(cache.items, OBJECT_POOL_BATCH);
+        std::memmove(cache.items, cache.items + OBJECT_POOL_BATCH,
+                     sizeof(u32) * (cache.count - OBJECT_POOL_BATCH));
+        cache.count -= OBJECT_POOL_BATCH;
+    }
+
+    // Slow path once the shared list and the carve are both dry
+    u32 steal(ThreadCache& own) noexcept {
+        for (u32 i = 0; i < OBJECT_POOL_MAX_THREADS; ++i) {
+            ThreadCache& victim = caches_[i];
+            if (&victim == &own) {
+                continue;
+            }
+
+            victim.lock.lock();
+            u32 index = OBJECT_POOL_NIL;
+            if (victim.count > 0) {
+                index = victim.items[--victim.count];
+            }
+            victim.lock.unlock();
+
+            if (index != OBJECT_POOL_NIL) {
+                own.lock.lock();
+                OwnerIncrement(own.allocations);
+                own.lock.unlock();
+                return index;
+            }
+        }
+
+        // A spill may have landed while we were looking
+        u32 index = OBJECT_POOL_NIL;
+        if (popChain(&index, 1) == 0) {
+            return OBJECT_POOL_NIL;
+        }
+        own.lock.lock();
+        OwnerIncrement(own.allocations);
+        own.lock.unlock();
+        return index;
+    }
+
+    bool isPoisoned(const T* object) const noexcept {
+        const u8* bytes = reinterpret_cast<const u8*>(object);
+        for (usize i = 0; i < sizeof(T); ++i) {
+            if (bytes[i] != OBJECT_POOL_POISON) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    T* objects_;
+    AtomicU32* next_;               // Free-list link per slot
+    ThreadCache* caches_;
+    u32 capacity_;
+    i32 numaNode_;
+    bool poison_;
+
+    alignas(CACHE_LINE) std::atomic<u64> head_;     // [tag:32 | index:32]
+    alignas(CACHE_LINE) AtomicU32 highWater_;        // Slots ever carved
+};
+
+// ==========================================================================
+// EXPORTS
+// ==========================================================================
+
+extern "C" {
+    // allocate/deallocate storms from several threads. usePool = 0 runs the
+    // old untagged index free list (DAGNodePool), 1 the ObjectPool. Returns
+    // average ns per allocate+deallocate pair; corrupted counts slots handed
+    // to two threads at once.
+    AARENDOCORE_API u64 AARendoCore_TestObjectPoolContention(
+        u32 threads, u32 pairsPerThread, u32 usePool, u64* corrupted);
+}
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_OBJECTPOOL_H
@@ -91,6 +91,17 @@
     #define AARENDOCORE_HAS_SSE42 0
 #endif
 
+// Per-function ISA targeting for runtime-dispatched kernels.
+// MSVC emits any intrinsic without /arch; GCC/Clang need the target attribute.
+#if defined(__GNUC__)
+    #define AARENDOCORE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #define AARENDOCORE_TARGET_AVX512 \
+        __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,avx2,fma")))
+#else
+    #define AARENDOCORE_TARGET_AVX2
+    #define AARENDOCORE_TARGET_AVX512
+#endif
+
 // ============================================================================
 // CRITICAL SYSTEM CONSTANTS - The foundation of all memory operations
 // ============================================================================
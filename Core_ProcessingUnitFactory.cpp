@@ -9,6 +9,8 @@
 #include "Core_DataProcessingUnit.h"
 #include "Core_BatchProcessingUnit.h"
 #include "Core_InterpolationProcessingUnit.h"
+#include "Core_StaticPipeline.h"
+#include <algorithm>
 
 namespace AARendoCoreGLM {
 
@@ -59,7 +61,9 @@ ProcessingUnitFactory::ProcessingUnitFactory() noexcept
     : initialized_(false)
     , config_{}
     , stats_{}
-    , nextUnitId_(1) {  // Start from 1, 0 is invalid
+    , nextUnitId_(1)  // Start from 1, 0 is invalid
+    , creators_{}
+    , creatorCount_(0) {
 }
 
 ProcessingUnitFactory::~ProcessingUnitFactory() noexcept {
@@ -79,6 +83,12 @@ ResultCode ProcessingUnitFactory::initialize(const FactoryConfig& config) noexce
     stats_.reset();
     
     initialized_.store(true, std::memory_order_release);
+    
+    // Compile-time pipelines shipped with the system
+    if (!hasUnitCreator(ProcessingUnitType::INDICATOR_COMPUTER)) {
+        RegisterStaticPipeline<TickBarIndicatorPipelineUnit>(*this);
+    }
+    
     return ResultCode::SUCCESS;
 }
 
@@ -117,6 +127,15 @@ IProcessingUnit* ProcessingUnitFactory::createUnit(ProcessingUnitType type,
     
     IProcessingUnit* unit = nullptr;
     
+    // Registered creators first - they may override a built-in unit
+    if (UnitCreator creator = findUnitCreator(type)) {
+        unit = creator(targetNode);
+        if (unit) {
+            updateStats(type, true);
+        }
+        return unit;
+    }
+    
     // PHASE 1: Direct instantiation (no pools yet)
     switch (type) {
         case ProcessingUnitType::MARKET_DATA_RECEIVER:
@@ -180,6 +199,37 @@ bool ProcessingUnitFactory::destroyUnit(IProcessingUnit* unit) noexcept {
     return true;
 }
 
+ResultCode ProcessingUnitFactory::registerUnitCreator(ProcessingUnitType type,
+                                                      UnitCreator creator) noexcept {
+    if (!creator) {
+        return ResultCode::ERROR_INVALID_PARAMETER;
+    }
+    
+    const u32 key = static_cast<u32>(type);
+    const u32 count = std::min(creatorCount_.load(std::memory_order_acquire), MAX_REGISTERED_CREATORS);
+    for (u32 i = 0; i < count; ++i) {
+        if (creators_[i].type.load(std::memory_order_acquire) == key) {
+            creators_[i].creator.store(creator, std::memory_order_release);
+            return ResultCode::SUCCESS;
+        }
+    }
+    
+    u32 slot = creatorCount_.fetch_add(1, std::memory_order_acq_rel);
+    if (slot >= MAX_REGISTERED_CREATORS) {
+        creatorCount_.fetch_sub(1, std::memory_order_relaxed);
+        return ResultCode::ERROR_CAPACITY_EXCEEDED;
+    }
+    
+    // Type last - a reader that matches it finds the creator
+    creators_[slot].creator.store(creator, std::memory_order_relaxed);
+    creators_[slot].type.store(key, std::memory_order_release);
+    return ResultCode::SUCCESS;
+}
+
+bool ProcessingUnitFactory::hasUnitCreator(ProcessingUnitType type) const noexcept {
+    return findUnitCreator(type) != nullptr;
+}
+
 // ============================================================================
 // SPECIFIC UNIT CREATORS - What SessionManager needs
 // ============================================================================
@@ -254,6 +304,10 @@ void ProcessingUnitFactory::updateStats(ProcessingUnitType type, bool created) n
 }
 
 bool ProcessingUnitFactory::validateUnitType(ProcessingUnitType type) const noexcept {
+    if (hasUnitCreator(type)) {
+        return true;
+    }
+    
     // PHASE 1: Accept types we can create
     switch (type) {
         case ProcessingUnitType::MARKET_DATA_RECEIVER:
@@ -268,6 +322,17 @@ bool ProcessingUnitFactory::validateUnitType(ProcessingUnitType type) const noex
     }
 }
 
+UnitCreator ProcessingUnitFactory::findUnitCreator(ProcessingUnitType type) const noexcept {
+    const u32 key = static_cast<u32>(type);
+    const u32 count = std::min(creatorCount_.load(std::memory_order_acquire), MAX_REGISTERED_CREATORS);
+    for (u32 i = 0; i < count; ++i) {
+        if (creators_[i].type.load(std::memory_order_acquire) == key) {
+            return creators_[i].creator.load(std::memory_order_acquire);
+        }
+    }
+    return nullptr;
+}
+
 // ============================================================================
 // GLOBAL FACTORY INSTANCE IMPLEMENTATION
 // ============================================================================
@@ -23,6 +23,10 @@ namespace AARendoCoreGLM {
 // Forward declarations
 class IProcessingUnit;
 
+// Origin: Creates a unit of a type registered at runtime - static pipelines
+// and anything else without a built-in case in createUnit
+typedef IProcessingUnit* (*UnitCreator)(i32 numaNode);
+
 // ============================================================================
 // FACTORY CONFIGURATION - Minimal for Phase 1
 // ============================================================================
@@ -68,6 +72,15 @@ private:
     // Simple counters (Phase 2 will add pools)
     AtomicU64 nextUnitId_;
     
+    // Registered creators - written at startup, scanned by createUnit
+    struct CreatorBinding {
+        std::atomic<u32> type;
+        std::atomic<UnitCreator> creator;
+    };
+    static constexpr u32 MAX_REGISTERED_CREATORS = 16;
+    CreatorBinding creators_[MAX_REGISTERED_CREATORS];
+    AtomicU32 creatorCount_;
+    
 public:
     ProcessingUnitFactory() noexcept;
     ~ProcessingUnitFactory() noexcept;
@@ -96,6 +109,11 @@ public:
     // Destroy processing unit
     bool destroyUnit(IProcessingUnit* unit) noexcept;
     
+    // Register a creator for a unit type - replaces an earlier registration
+    // and takes precedence over the built-in unit for that type
+    ResultCode registerUnitCreator(ProcessingUnitType type, UnitCreator creator) noexcept;
+    bool hasUnitCreator(ProcessingUnitType type) const noexcept;
+    
     // ========================================================================
     // SPECIFIC UNIT CREATORS - What SessionManager needs
     // ========================================================================
@@ -123,6 +141,7 @@ private:
     ProcessingUnitId generateUnitId() noexcept;
     void updateStats(ProcessingUnitType type, bool created) noexcept;
     bool validateUnitType(ProcessingUnitType type) const noexcept;
+    UnitCreator findUnitCreator(ProcessingUnitType type) const noexcept;
 };
 
 // ============================================================================
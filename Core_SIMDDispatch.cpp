@@ -0,0 +1,763 @@
+//===--- Core_SIMDDispatch.cpp - Runtime CPU Feature Dispatch -----------===//
+//
+// COMPILATION LEVEL: 1
+// ORIGIN: Implementation for Core_SIMDDispatch.h
+// DEPENDENCIES: Core_SIMDDispatch.h
+// DEPENDENTS: None
+//
+// Scalar, AVX2 and AVX-512 kernels plus cpuid detection and binding.
+// Every AVX-512 function carries AARENDOCORE_TARGET_AVX512 so it only
+// executes after detection has proven the CPU and OS support it.
+//===----------------------------------------------------------------------===//
+
+#include "Core_SIMDDispatch.h"
+#include <immintrin.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#if AARENDOCORE_COMPILER_MSVC
+    #include <intrin.h>
+#else
+    #include <cpuid.h>
+#endif
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// CPUID / XGETBV
+// ==========================================================================
+
+namespace {
+
+// Origin: Execute cpuid for leaf/subleaf
+void QueryCpuid(u32 leaf, u32 subleaf, u32 regs[4]) noexcept {
+#if AARENDOCORE_COMPILER_MSVC
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (u32 i = 0; i < 4; ++i) {
+        regs[i] = static_cast<u32>(info[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Origin: Read XCR0 (which register states the OS saves on context switch)
+u64 ReadXCR0() noexcept {
+#if AARENDOCORE_COMPILER_MSVC
+    return _xgetbv(0);
+#else
+    u32 lo = 0;
+    u32 hi = 0;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<u64>(hi) << 32) | lo;
+#endif
+}
+
+// Origin: Perform detection once
+CPUFeatures DetectCPUFeatures() noexcept {
+    CPUFeatures features{};
+    u32 regs[4] = {};
+
+    QueryCpuid(0, 0, regs);
+    const u32 maxLeaf = regs[0];
+    std::memcpy(features.vendor + 0, &regs[1], 4);  // EBX
+    std::memcpy(features.vendor + 4, &regs[3], 4);  // EDX
+    std::memcpy(features.vendor + 8, &regs[2], 4);  // ECX
+    features.vendor[12] = '\0';
+
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    QueryCpuid(1, 0, regs);
+    const u32 ecx1 = regs[2];
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+
+    features.sse42 = (ecx1 & (1u << 20)) != 0;
+    features.fma = (ecx1 & (1u << 12)) != 0;
+    features.avx = (ecx1 & (1u << 28)) != 0;
+
+    if (osxsave) {
+        const u64 xcr0 = ReadXCR0();
+        features.osSavesYmm = (xcr0 & 0x6) == 0x6;        // SSE + AVX state
+        features.osSavesZmm = (xcr0 & 0xE6) == 0xE6;      // + opmask, ZMM_Hi256, Hi16_ZMM
+    }
+
+    if (maxLeaf >= 7) {
+        QueryCpuid(7, 0, regs);
+        const u32 ebx7 = regs[1];
+        features.avx2 = (ebx7 & (1u << 5)) != 0;
+        features.bmi2 = (ebx7 & (1u << 8)) != 0;
+        features.avx512f = (ebx7 & (1u << 16)) != 0;
+        features.avx512dq = (ebx7 & (1u << 17)) != 0;
+        features.avx512bw = (ebx7 & (1u << 30)) != 0;
+        features.avx512vl = (ebx7 & (1u << 31)) != 0;
+    }
+
+    // Instructions are useless if the OS does not preserve the registers
+    if (!features.osSavesYmm) {
+        features.avx = false;
+        features.avx2 = false;
+        features.fma = false;
+    }
+    if (!features.osSavesZmm) {
+        features.avx512f = false;
+        features.avx512dq = false;
+        features.avx512vl = false;
+        features.avx512bw = false;
+    }
+
+    return features;
+}
+
+// ==========================================================================
+// SCALAR KERNELS
+// ==========================================================================
+
+void AccumulateVWAPScalar(const Tick* ticks, usize count, f64 priceMultiplier,
+                          f64* sumPriceVolume, f64* sumVolume) noexcept {
+    f64 pv = 0.0;
+    f64 v = 0.0;
+    for (usize i = 0; i < count; ++i) {
+        pv += ticks[i].price * priceMultiplier * ticks[i].volume;
+        v += ticks[i].volume;
+    }
+    *sumPriceVolume = pv;
+    *sumVolume = v;
+}
+
+void CombinePriceVolumeScalar(const Tick* input, Tick* output, usize count,
+                              u32 function) noexcept {
+    for (usize i = 0; i < count; ++i) {
+        const f64 p = input[i].price;
+        const f64 v = input[i].volume;
+        output[i] = input[i];
+        switch (function) {
+            case 0: output[i].price = p + v; break;
+            case 1: output[i].price = p * v; break;
+            case 2: output[i].price = std::max(p, v); break;
+            case 3: output[i].price = std::min(p, v); break;
+            default: break;
+        }
+    }
+}
+
+f64 ReducePriceScalar(const Tick* ticks, usize count, u32 function) noexcept {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    f64 result = 0.0;
+    switch (function) {
+        case 0:
+        case 4:
+            for (usize i = 0; i < count; ++i) {
+                result += ticks[i].price;
+            }
+            if (function == 4) {
+                result /= static_cast<f64>(count);
+            }
+            break;
+        case 1:
+            result = 1.0;
+            for (usize i = 0; i < count; ++i) {
+                result *= ticks[i].price;
+            }
+            break;
+        case 2:
+            result = ticks[0].price;
+            for (usize i = 1; i < count; ++i) {
+                result = std::max(result, ticks[i].price);
+            }
+            break;
+        case 3:
+            result = ticks[0].price;
+            for (usize i = 1; i < count; ++i) {
+                result = std::min(result, ticks[i].price);
+            }
+            break;
+        default:
+            result = ticks[0].price;
+            break;
+    }
+    return result;
+}
+
+void MidpointsScalar(const f64* values, f64* output, usize count) noexcept {
+    for (usize i = 0; i + 1 < count; ++i) {
+        output[i] = (values[i] + values[i + 1]) * 0.5;
+    }
+}
+
+u64 MaxU64Scalar(const u64* values, usize count) noexcept {
+    u64 result = 0;
+    for (usize i = 0; i < count; ++i) {
+        result = std::max(result, values[i]);
+    }
+    return result;
+}
+
+// ==========================================================================
+// AVX2 KERNELS
+// ==========================================================================
+
+// Origin: Deinterleave price/volume of 4 AoS ticks (Tick is 32-byte aligned)
+// Row layout is [timestamp, price, volume, flags|pad]
+AARENDOCORE_TARGET_AVX2 AARENDOCORE_FORCEINLINE
+void LoadPriceVolumeAVX2(const Tick* ticks, __m256d& prices, __m256d& volumes) noexcept {
+    const f64* base = reinterpret_cast<const f64*>(ticks);
+    const __m256d r0 = _mm256_load_pd(base + 0);
+    const __m256d r1 = _mm256_load_pd(base + 4);
+    const __m256d r2 = _mm256_load_pd(base + 8);
+    const __m256d r3 = _mm256_load_pd(base + 12);
+
+    const __m256d lo01 = _mm256_unpacklo_pd(r0, r1);   // ts0 ts1 v0 v1
+    const __m256d hi01 = _mm256_unpackhi_pd(r0, r1);   // p0 p1 f0 f1
+    const __m256d lo23 = _mm256_unpacklo_pd(r2, r3);   // ts2 ts3 v2 v3
+    const __m256d hi23 = _mm256_unpackhi_pd(r2, r3);   // p2 p3 f2 f3
+
+    prices = _mm256_permute2f128_pd(hi01, hi23, 0x20);
+    volumes = _mm256_permute2f128_pd(lo01, lo23, 0x31);
+}
+
+AARENDOCORE_TARGET_AVX2
+void AccumulateVWAPAVX2(const Tick* ticks, usize count, f64 priceMultiplier,
+                        f64* sumPriceVolume, f64* sumVolume) noexcept {
+    const __m256d multiplier = _mm256_set1_pd(priceMultiplier);
+    __m256d pv0 = _mm256_setzero_pd();
+    __m256d pv1 = _mm256_setzero_pd();
+    __m256d v0 = _mm256_setzero_pd();
+    __m256d v1 = _mm256_setzero_pd();
+
+    usize i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256d pa, va, pb, vb;
+        LoadPriceVolumeAVX2(ticks + i, pa, va);
+        LoadPriceVolumeAVX2(ticks + i + 4, pb, vb);
+        pv0 = _mm256_fmadd_pd(_mm256_mul_pd(pa, multiplier), va, pv0);
+        pv1 = _mm256_fmadd_pd(_mm256_mul_pd(pb, multiplier), vb, pv1);
+        v0 = _mm256_add_pd(v0, va);
+        v1 = _mm256_add_pd(v1, vb);
+    }
+    for (; i + 4 <= count; i += 4) {
+        __m256d p, v;
+        LoadPriceVolumeAVX2(ticks + i, p, v);
+        pv0 = _mm256_fmadd_pd(_mm256_mul_pd(p, multiplier), v, pv0);
+        v0 = _mm256_add_pd(v0, v);
+    }
+
+    alignas(32) f64 lanes[8];
+    _mm256_store_pd(lanes, _mm256_add_pd(pv0, pv1));
+    _mm256_store_pd(lanes + 4, _mm256_add_pd(v0, v1));
+
+    f64 pv = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    f64 v = lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    for (; i < count; ++i) {
+        pv += ticks[i].price * priceMultiplier * ticks[i].volume;
+        v += ticks[i].volume;
+    }
+
+    *sumPriceVolume = pv;
+    *sumVolume = v;
+}
+
+// Origin: Price/volume combiner, selected at compile time per function
+template<u32 Function>
+AARENDOCORE_TARGET_AVX2 AARENDOCORE_FORCEINLINE
+__m256d CombineAVX2(__m256d prices, __m256d volumes) noexcept {
+    if constexpr (Function == 0) {
+        return _mm256_add_pd(prices, volumes);
+    } else if constexpr (Function == 1) {
+        return _mm256_mul_pd(prices, volumes);
+    } else if constexpr (Function == 2) {
+        return _mm256_max_pd(prices, volumes);
+    } else if constexpr (Function == 3) {
+        return _mm256_min_pd(prices, volumes);
+    } else {
+        return prices;
+    }
+}
+
+template<u32 Function>
+AARENDOCORE_TARGET_AVX2
+void CombineLoopAVX2(const Tick* input, Tick* output, usize count) noexcept {
+    usize i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d prices, volumes;
+        LoadPriceVolumeAVX2(input + i, prices, volumes);
+        const __m256d result = CombineAVX2<Function>(prices, volumes);
+
+        // Write each row back with its new price in lane 1 - no stack bounce
+        const f64* src = reinterpret_cast<const f64*>(input + i);
+        f64* dst = reinterpret_cast<f64*>(output + i);
+        _mm256_store_pd(dst + 0, _mm256_blend_pd(_mm256_load_pd(src + 0),
+            _mm256_permute4x64_pd(result, 0x00), 0x2));
+        _mm256_store_pd(dst + 4, _mm256_blend_pd(_mm256_load_pd(src + 4),
+            _mm256_permute4x64_pd(result, 0x55), 0x2));
+        _mm256_store_pd(dst + 8, _mm256_blend_pd(_mm256_load_pd(src + 8),
+            _mm256_permute4x64_pd(result, 0xAA), 0x2));
+        _mm256_store_pd(dst + 12, _mm256_blend_pd(_mm256_load_pd(src + 12),
+            _mm256_permute4x64_pd(result, 0xFF), 0x2));
+    }
+
+    CombinePriceVolumeScalar(input + i, output + i, count - i, Function);
+}
+
+AARENDOCORE_TARGET_AVX2
+void CombinePriceVolumeAVX2(const Tick* input, Tick* output, usize count,
+                            u32 function) noexcept {
+    switch (function) {
+        case 0: CombineLoopAVX2<0>(input, output, count); break;
+        case 1: CombineLoopAVX2<1>(input, output, count); break;
+        case 2: CombineLoopAVX2<2>(input, output, count); break;
+        case 3: CombineLoopAVX2<3>(input, output, count); break;
+        default: CombineLoopAVX2<4>(input, output, count); break;
+    }
+}
+
+AARENDOCORE_TARGET_AVX2
+f64 ReducePriceAVX2(const Tick* ticks, usize count, u32 function) noexcept {
+    if (count < 8 || function > 4) {
+        return ReducePriceScalar(ticks, count, function);
+    }
+
+    __m256d acc0;
+    __m256d acc1;
+    if (function == 1) {
+        acc0 = acc1 = _mm256_set1_pd(1.0);
+    } else if (function == 2 || function == 3) {
+        acc0 = acc1 = _mm256_set1_pd(ticks[0].price);
+    } else {
+        acc0 = acc1 = _mm256_setzero_pd();
+    }
+
+    usize i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256d pa, va, pb, vb;
+        LoadPriceVolumeAVX2(ticks + i, pa, va);
+        LoadPriceVolumeAVX2(ticks + i + 4, pb, vb);
+        switch (function) {
+            case 1:
+                acc0 = _mm256_mul_pd(acc0, pa);
+                acc1 = _mm256_mul_pd(acc1, pb);
+                break;
+            case 2:
+                acc0 = _mm256_max_pd(acc0, pa);
+                acc1 = _mm256_max_pd(acc1, pb);
+                break;
+            case 3:
+                acc0 = _mm256_min_pd(acc0, pa);
+                acc1 = _mm256_min_pd(acc1, pb);
+                break;
+            default:
+                acc0 = _mm256_add_pd(acc0, pa);
+                acc1 = _mm256_add_pd(acc1, pb);
+                break;
+        }
+    }
+
+    alignas(32) f64 lanes[8];
+    _mm256_store_pd(lanes, acc0);
+    _mm256_store_pd(lanes + 4, acc1);
+
+    f64 result = lanes[0];
+    for (u32 lane = 1; lane < 8; ++lane) {
+        switch (function) {
+            case 1: result *= lanes[lane]; break;
+            case 2: result = std::max(result, lanes[lane]); break;
+            case 3: result = std::min(result, lanes[lane]); break;
+            default: result += lanes[lane]; break;
+        }
+    }
+
+    for (; i < count; ++i) {
+        switch (function) {
+            case 1: result *= ticks[i].price; break;
+            case 2: result = std::max(result, ticks[i].price); break;
+            case 3: result = std::min(result, ticks[i].price); break;
+            default: result += ticks[i].price; break;
+        }
+    }
+
+    return function == 4 ? result / static_cast<f64>(count) : result;
+}
+
+AARENDOCORE_TARGET_AVX2
+void MidpointsAVX2(const f64* values, f64* output, usize count) noexcept {
+    const __m256d half = _mm256_set1_pd(0.5);
+    usize i = 0;
+    for (; i + 5 <= count; i += 4) {
+        const __m256d a = _mm256_loadu_pd(values + i);
+        const __m256d b = _mm256_loadu_pd(values + i + 1);
+        _mm256_storeu_pd(output + i, _mm256_mul_pd(_mm256_add_pd(a, b), half));
+    }
+    MidpointsScalar(values + i, output + i, count - i);
+}
+
+AARENDOCORE_TARGET_AVX2
+u64 MaxU64AVX2(const u64* values, usize count) noexcept {
+    if (count < 4) {
+        return MaxU64Scalar(values, count);
+    }
+
+    // Unsigned compare via signed compare on sign-flipped values
+    const __m256i bias = _mm256_set1_epi64x(static_cast<i64>(0x8000000000000000ULL));
+    __m256i best = _mm256_xor_si256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)), bias);
+
+    usize i = 4;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i v = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)), bias);
+        best = _mm256_blendv_epi8(best, v, _mm256_cmpgt_epi64(v, best));
+    }
+
+    alignas(32) u64 lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_xor_si256(best, bias));
+
+    u64 result = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    for (; i < count; ++i) {
+        result = std::max(result, values[i]);
+    }
+    return result;
+}
+
+// ==========================================================================
+// AVX-512 KERNELS
+// ==========================================================================
+
+// Origin: Deinterleave price/volume of 8 AoS ticks
+AARENDOCORE_TARGET_AVX512 AARENDOCORE_FORCEINLINE
+void LoadPriceVolumeAVX512(const Tick* ticks, __m512d& prices, __m512d& volumes) noexcept {
+    const f64* base = reinterpret_cast<const f64*>(ticks);
+    const __m512d z0 = _mm512_loadu_pd(base + 0);     // ticks 0-1
+    const __m512d z1 = _mm512_loadu_pd(base + 8);     // ticks 2-3
+    const __m512d z2 = _mm512_loadu_pd(base + 16);    // ticks 4-5
+    const __m512d z3 = _mm512_loadu_pd(base + 24);    // ticks 6-7
+
+    // [p0 p1 p2 p3 v0 v1 v2 v3] from each register pair
+    const __m512i index = _mm512_set_epi64(14, 10, 6, 2, 13, 9, 5, 1);
+    const __m512d a = _mm512_permutex2var_pd(z0, index, z1);
+    const __m512d b = _mm512_permutex2var_pd(z2, index, z3);
+
+    prices = _mm512_shuffle_f64x2(a, b, 0x44);
+    volumes = _mm512_shuffle_f64x2(a, b, 0xEE);
+}
+
+AARENDOCORE_TARGET_AVX512
+void AccumulateVWAPAVX512(const Tick* ticks, usize count, f64 priceMultiplier,
+                          f64* sumPriceVolume, f64* sumVolume) noexcept {
+    const __m512d multiplier = _mm512_set1_pd(priceMultiplier);
+    __m512d pv0 = _mm512_setzero_pd();
+    __m512d pv1 = _mm512_setzero_pd();
+    __m512d v0 = _mm512_setzero_pd();
+    __m512d v1 = _mm512_setzero_pd();
+
+    usize i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512d pa, va, pb, vb;
+        LoadPriceVolumeAVX512(ticks + i, pa, va);
+        LoadPriceVolumeAVX512(ticks + i + 8, pb, vb);
+        pv0 = _mm512_fmadd_pd(_mm512_mul_pd(pa, multiplier), va, pv0);
+        pv1 = _mm512_fmadd_pd(_mm512_mul_pd(pb, multiplier), vb, pv1);
+        v0 = _mm512_add_pd(v0, va);
+        v1 = _mm512_add_pd(v1, vb);
+    }
+    for (; i + 8 <= count; i += 8) {
+        __m512d p, v;
+        LoadPriceVolumeAVX512(ticks + i, p, v);
+        pv0 = _mm512_fmadd_pd(_mm512_mul_pd(p, multiplier), v, pv0);
+        v0 = _mm512_add_pd(v0, v);
+    }
+
+    f64 pv = _mm512_reduce_add_pd(_mm512_add_pd(pv0, pv1));
+    f64 v = _mm512_reduce_add_pd(_mm512_add_pd(v0, v1));
+    for (; i < count; ++i) {
+        pv += ticks[i].price * priceMultiplier * ticks[i].volume;
+        v += ticks[i].volume;
+    }
+
+    *sumPriceVolume = pv;
+    *sumVolume = v;
+}
+
+template<u32 Function>
+AARENDOCORE_TARGET_AVX512 AARENDOCORE_FORCEINLINE
+__m512d CombineAVX512(__m512d prices, __m512d volumes) noexcept {
+    if constexpr (Function == 0) {
+        return _mm512_add_pd(prices, volumes);
+    } else if constexpr (Function == 1) {
+        return _mm512_mul_pd(prices, volumes);
+    } else if constexpr (Function == 2) {
+        return _mm512_max_pd(prices, volumes);
+    } else if constexpr (Function == 3) {
+        return _mm512_min_pd(prices, volumes);
+    } else {
+        return prices;
+    }
+}
+
+template<u32 Function>
+AARENDOCORE_TARGET_AVX512
+void CombineLoopAVX512(const Tick* input, Tick* output, usize count) noexcept {
+    // Result lanes 2k and 2k+1 land in lanes 1 and 5 of output register k
+    const __m512i place0 = _mm512_set_epi64(0, 0, 1, 0, 0, 0, 0, 0);
+    const __m512i place1 = _mm512_set_epi64(0, 0, 3, 0, 0, 0, 2, 0);
+    const __m512i place2 = _mm512_set_epi64(0, 0, 5, 0, 0, 0, 4, 0);
+    const __m512i place3 = _mm512_set_epi64(0, 0, 7, 0, 0, 0, 6, 0);
+    const __mmask8 priceLanes = 0x22;
+
+    usize i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d prices, volumes;
+        LoadPriceVolumeAVX512(input + i, prices, volumes);
+        const __m512d result = CombineAVX512<Function>(prices, volumes);
+
+        const f64* src = reinterpret_cast<const f64*>(input + i);
+        f64* dst = reinterpret_cast<f64*>(output + i);
+        _mm512_storeu_pd(dst + 0, _mm512_mask_permutexvar_pd(
+            _mm512_loadu_pd(src + 0), priceLanes, place0, result));
+        _mm512_storeu_pd(dst + 8, _mm512_mask_permutexvar_pd(
+            _mm512_loadu_pd(src + 8), priceLanes, place1, result));
+        _mm512_storeu_pd(dst + 16, _mm512_mask_permutexvar_pd(
+            _mm512_loadu_pd(src + 16), priceLanes, place2, result));
+        _mm512_storeu_pd(dst + 24, _mm512_mask_permutexvar_pd(
+            _mm512_loadu_pd(src + 24), priceLanes, place3, result));
+    }
+
+    CombinePriceVolumeScalar(input + i, output + i, count - i, Function);
+}
+
+AARENDOCORE_TARGET_AVX512
+void CombinePriceVolumeAVX512(const Tick* input, Tick* output, usize count,
+                              u32 function) noexcept {
+    switch (function) {
+        case 0: CombineLoopAVX512<0>(input, output, count); break;
+        case 1: CombineLoopAVX512<1>(input, output, count); break;
+        case 2: CombineLoopAVX512<2>(input, output, count); break;
+        case 3: CombineLoopAVX512<3>(input, output, count); break;
+        default: CombineLoopAVX512<4>(input, output, count); break;
+    }
+}
+
+AARENDOCORE_TARGET_AVX512
+f64 ReducePriceAVX512(const Tick* ticks, usize count, u32 function) noexcept {
+    if (count < 16 || function > 4) {
+        return ReducePriceAVX2(ticks, count, function);
+    }
+
+    __m512d acc0;
+    __m512d acc1;
+    if (function == 1) {
+        acc0 = acc1 = _mm512_set1_pd(1.0);
+    } else if (function == 2 || function == 3) {
+        acc0 = acc1 = _mm512_set1_pd(ticks[0].price);
+    } else {
+        acc0 = acc1 = _mm512_setzero_pd();
+    }
+
+    usize i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512d pa, va, pb, vb;
+        LoadPriceVolumeAVX512(ticks + i, pa, va);
+        LoadPriceVolumeAVX512(ticks + i + 8, pb, vb);
+        switch (function) {
+            case 1:
+                acc0 = _mm512_mul_pd(acc0, pa);
+                acc1 = _mm512_mul_pd(acc1, pb);
+                break;
+            case 2:
+                acc0 = _mm512_max_pd(acc0, pa);
+                acc1 = _mm512_max_pd(acc1, pb);
+                break;
+            case 3:
+                acc0 = _mm512_min_pd(acc0, pa);
+                acc1 = _mm512_min_pd(acc1, pb);
+                break;
+            default:
+                acc0 = _mm512_add_pd(acc0, pa);
+                acc1 = _mm512_add_pd(acc1, pb);
+                break;
+        }
+    }
+
+    f64 result;
+    switch (function) {
+        case 1: result = _mm512_reduce_mul_pd(_mm512_mul_pd(acc0, acc1)); break;
+        case 2: result = _mm512_reduce_max_pd(_mm512_max_pd(acc0, acc1)); break;
+        case 3: result = _mm512_reduce_min_pd(_mm512_min_pd(acc0, acc1)); break;
+        default: result = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1)); break;
+    }
+
+    for (; i < count; ++i) {
+        switch (function) {
+            case 1: result *= ticks[i].price; break;
+            case 2: result = std::max(result, ticks[i].price); break;
+            case 3: result = std::min(result, ticks[i].price); break;
+            default: result += ticks[i].price; break;
+        }
+    }
+
+    return function == 4 ? result / static_cast<f64>(count) : result;
+}
+
+AARENDOCORE_TARGET_AVX512
+void MidpointsAVX512(const f64* values, f64* output, usize count) noexcept {
+    const __m512d half = _mm512_set1_pd(0.5);
+    usize i = 0;
+    for (; i + 9 <= count; i += 8) {
+        const __m512d a = _mm512_loadu_pd(values + i);
+        const __m512d b = _mm512_loadu_pd(values + i + 1);
+        _mm512_storeu_pd(output + i, _mm512_mul_pd(_mm512_add_pd(a, b), half));
+    }
+    MidpointsScalar(values + i, output + i, count - i);
+}
+
+AARENDOCORE_TARGET_AVX512
+u64 MaxU64AVX512(const u64* values, usize count) noexcept {
+    if (count < 8) {
+        return MaxU64Scalar(values, count);
+    }
+
+    __m512i best = _mm512_loadu_si512(values);
+    usize i = 8;
+    for (; i + 8 <= count; i += 8) {
+        best = _mm512_max_epu64(best, _mm512_loadu_si512(values + i));
+    }
+
+    u64 result = _mm512_reduce_max_epu64(best);
+    for (; i < count; ++i) {
+        result = std::max(result, values[i]);
+    }
+    return result;
+}
+
+// ==========================================================================
+// TABLES AND BINDING
+// ==========================================================================
+
+const SIMDKernels g_scalarKernels = {
+    AccumulateVWAPScalar, CombinePriceVolumeScalar, ReducePriceScalar,
+    MidpointsScalar, MaxU64Scalar, SIMDLevel::SCALAR, 128
+};
+
+const SIMDKernels g_avx2Kernels = {
+    AccumulateVWAPAVX2, CombinePriceVolumeAVX2, ReducePriceAVX2,
+    MidpointsAVX2, MaxU64AVX2, SIMDLevel::AVX2, 256
+};
+
+const SIMDKernels g_avx512Kernels = {
+    AccumulateVWAPAVX512, CombinePriceVolumeAVX512, ReducePriceAVX512,
+    MidpointsAVX512, MaxU64AVX512, SIMDLevel::AVX512, 512
+};
+
+// Origin: Detected once, on first use - function-local statics, so static
+// initializers in other translation units may dispatch safely
+const CPUFeatures& CachedCPUFeatures() noexcept {
+    static const CPUFeatures features = DetectCPUFeatures();
+    return features;
+}
+
+SIMDLevel ComputeMaxLevel() noexcept {
+    const CPUFeatures& f = CachedCPUFeatures();
+    if (f.avx512f && f.avx512dq && f.avx512vl && f.avx2 && f.fma) {
+        return SIMDLevel::AVX512;
+    }
+    if (f.avx2 && f.fma) {
+        return SIMDLevel::AVX2;
+    }
+    return SIMDLevel::SCALAR;
+}
+
+SIMDLevel CachedMaxLevel() noexcept {
+    static const SIMDLevel level = ComputeMaxLevel();
+    return level;
+}
+
+const SIMDKernels* TableFor(SIMDLevel level) noexcept {
+    const SIMDLevel maxLevel = CachedMaxLevel();
+    if (level > maxLevel) {
+        level = maxLevel;
+    }
+    switch (level) {
+        case SIMDLevel::AVX512: return &g_avx512Kernels;
+        case SIMDLevel::AVX2:   return &g_avx2Kernels;
+        default:                return &g_scalarKernels;
+    }
+}
+
+// Best table the CPU supports until SetActiveSIMDLevel overrides it
+std::atomic<const SIMDKernels*>& ActiveKernels() noexcept {
+    static std::atomic<const SIMDKernels*> active{TableFor(SIMDLevel::AVX512)};
+    return active;
+}
+
+} // anonymous namespace
+
+// ==========================================================================
+// PUBLIC API
+// ==========================================================================
+
+const CPUFeatures& GetCPUFeatures() noexcept {
+    return CachedCPUFeatures();
+}
+
+SIMDLevel GetMaxSupportedSIMDLevel() noexcept {
+    return CachedMaxLevel();
+}
+
+const SIMDKernels& GetSIMDKernels() noexcept {
+    return *ActiveKernels().load(std::memory_order_acquire);
+}
+
+const SIMDKernels& GetSIMDKernels(SIMDLevel level) noexcept {
+    return *TableFor(level);
+}
+
+SIMDLevel SetActiveSIMDLevel(SIMDLevel level) noexcept {
+    const SIMDKernels* table = TableFor(level);
+    ActiveKernels().store(table, std::memory_order_release);
+    return table->level;
+}
+
+u32 GetActiveSIMDWidthBits() noexcept {
+    return GetSIMDKernels().widthBits;
+}
+
+const char* SIMDLevelToString(SIMDLevel level) noexcept {
+    switch (level) {
+        case SIMDLevel::AVX512: return "AVX-512";
+        case SIMDLevel::AVX2:   return "AVX2";
+        default:                return "SCALAR";
+    }
+}
+
+// ==========================================================================
+// DLL EXPORTS
+// ==========================================================================
+
+extern "C" AARENDOCORE_API const char* AARendoCore_GetSIMDInfo() {
+    static char info[512];
+
+    const CPUFeatures& f = CachedCPUFeatures();
+    std::snprintf(info, sizeof(info),
+        "SIMD: Vendor=%s, Active=%s, Max=%s, AVX2=%d, FMA=%d, "
+        "AVX512F=%d, AVX512DQ=%d, AVX512VL=%d, AVX512BW=%d",
+        f.vendor,
+        SIMDLevelToString(GetSIMDKernels().level),
+        SIMDLevelToString(CachedMaxLevel()),
+        f.avx2 ? 1 : 0, f.fma ? 1 : 0,
+        f.avx512f ? 1 : 0, f.avx512dq ? 1 : 0,
+        f.avx512vl ? 1 : 0, f.avx512bw ? 1 : 0);
+
+    return info;
+}
+
+extern "C" AARENDOCORE_API u32 AARendoCore_SetSIMDLevel(u32 level) {
+    return static_cast<u32>(SetActiveSIMDLevel(static_cast<SIMDLevel>(level)));
+}
+
+} // namespace AARendoCoreGLM
@@ -0,0 +1,113 @@
+//===--- Core_SIMDDispatch.h - Runtime CPU Feature Dispatch -------------===//
+//
+// COMPILATION LEVEL: 1 (Depends on Platform and Types only)
+// ORIGIN: NEW - One binary, best kernels for the CPU it lands on
+// DEPENDENCIES: Core_Platform.h, Core_Types.h
+// DEPENDENTS: Tick, Batch, Interpolation units, StreamSynchronizer, DAGBuilder
+//
+// CPU features are detected ONCE (cpuid + xgetbv) and a function-pointer
+// table is bound to scalar, AVX2 or AVX-512 kernels. Hot loops call through
+// the table - ZERO feature checks per tick.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_SIMDDISPATCH_H
+#define AARENDOCORE_CORE_SIMDDISPATCH_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include "Core_CompilerEnforce.h"
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// SIMD LEVELS
+// ==========================================================================
+
+// Origin: Enumeration of kernel families, ordered by capability
+enum class SIMDLevel : u8 {
+    SCALAR = 0,     // Plain C++
+    AVX2 = 1,       // 256-bit, 4 doubles
+    AVX512 = 2      // 512-bit, 8 doubles (F + DQ + VL)
+};
+
+// ==========================================================================
+// CPU FEATURES
+// ==========================================================================
+
+// Origin: Structure for detected CPU features
+// Scope: Filled once at first use
+struct CPUFeatures {
+    bool sse42;
+    bool avx;
+    bool avx2;
+    bool fma;
+    bool bmi2;
+    bool avx512f;
+    bool avx512dq;
+    bool avx512vl;
+    bool avx512bw;
+    bool osSavesYmm;    // XCR0 enables YMM state
+    bool osSavesZmm;    // XCR0 enables opmask + ZMM state
+    char vendor[13];
+};
+
+// ==========================================================================
+// KERNEL TABLE
+// ==========================================================================
+
+// Origin: Function-pointer table for vectorizable hot loops
+// All kernels accept any count; tails are handled inside the kernel.
+struct SIMDKernels {
+    // Tick: sum(price * multiplier * volume) and sum(volume) over AoS ticks
+    void (*accumulateVWAP)(const Tick* ticks, usize count, f64 priceMultiplier,
+                           f64* sumPriceVolume, f64* sumVolume) noexcept;
+
+    // Batch: out[i] = in[i] with price replaced by f(price, volume)
+    // function: 0 = add, 1 = multiply, 2 = max, 3 = min, other = price
+    void (*combinePriceVolume)(const Tick* input, Tick* output, usize count,
+                               u32 function) noexcept;
+
+    // Batch: reduce prices (0 = sum, 1 = product, 2 = max, 3 = min, 4 = mean)
+    f64 (*reducePrice)(const Tick* ticks, usize count, u32 function) noexcept;
+
+    // Interpolation: out[i] = (values[i] + values[i + 1]) / 2, count - 1 outputs
+    void (*midpoints)(const f64* values, f64* output, usize count) noexcept;
+
+    // Synchronizer: maximum of unsigned 64-bit timestamps (0 if count == 0)
+    u64 (*maxU64)(const u64* values, usize count) noexcept;
+
+    SIMDLevel level;
+    u32 widthBits;
+};
+
+// ==========================================================================
+// DISPATCH API
+// ==========================================================================
+
+// Origin: Detect features via cpuid (cached after first call)
+const CPUFeatures& GetCPUFeatures() noexcept;
+
+// Origin: Best level this CPU and OS support
+SIMDLevel GetMaxSupportedSIMDLevel() noexcept;
+
+// Origin: Currently bound kernel table
+const SIMDKernels& GetSIMDKernels() noexcept;
+
+// Origin: Kernel table for a specific level (clamped to supported)
+const SIMDKernels& GetSIMDKernels(SIMDLevel level) noexcept;
+
+// Origin: Rebind the active table (clamped to supported). Call at startup
+// or between runs - units read the table per batch, not per tick.
+SIMDLevel SetActiveSIMDLevel(SIMDLevel level) noexcept;
+
+// Origin: Active vector width in bits (128 for scalar, matching SSE lanes)
+u32 GetActiveSIMDWidthBits() noexcept;
+
+// Origin: Human-readable level name
+const char* SIMDLevelToString(SIMDLevel level) noexcept;
+
+ENFORCE_HEADER_COMPLETE(Core_SIMDDispatch);
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_SIMDDISPATCH_H
@@ -69,7 +69,7 @@ void SessionConfiguration::setDefaults() noexcept {
 
 SessionData::SessionData() noexcept 
     : id{0}, sessionIndex(0), numaNode(0),
-      memoryPool(nullptr), cpuAffinity(0), workerId(0),
+      memoryPool(nullptr), cpuAffinity(0), workerId(0), templateState(0),
       createdAt(0), lastTickAt(0), lastHeartbeatAt(0),
       userData(nullptr) {
     state.store(SessionState::Uninitialized, MemoryOrderRelaxed);
@@ -84,7 +84,8 @@ SessionData::SessionData(SessionData&& other) noexcept
     : id(other.id), sessionIndex(other.sessionIndex), numaNode(other.numaNode),
       config(other.config), // config is POD, can copy
       memoryPool(other.memoryPool), cpuAffinity(other.cpuAffinity),
-      workerId(other.workerId), createdAt(other.createdAt),
+      workerId(other.workerId), templateState(other.templateState),
+      createdAt(other.createdAt),
       lastTickAt(other.lastTickAt), lastHeartbeatAt(other.lastHeartbeatAt),
       userData(other.userData) {
     
@@ -111,6 +112,7 @@ SessionData::SessionData(SessionData&& other) noexcept
     // Clear the moved-from object
     other.id = SessionId{0};
     other.memoryPool = nullptr;
+    other.templateState = 0;
     other.userData = nullptr;
     other.state.store(SessionState::Uninitialized, MemoryOrderRelease);
 }
@@ -145,6 +147,7 @@ SessionData& SessionData::operator=(SessionData&& other) noexcept {
         memoryPool = other.memoryPool;
         cpuAffinity = other.cpuAffinity;
         workerId = other.workerId;
+        templateState = other.templateState;
         createdAt = other.createdAt;
         lastTickAt = other.lastTickAt;
         lastHeartbeatAt = other.lastHeartbeatAt;
@@ -156,6 +159,7 @@ SessionData& SessionData::operator=(SessionData&& other) noexcept {
         // Clear the moved-from object
         other.id = SessionId{0};
         other.memoryPool = nullptr;
+        other.templateState = 0;
         other.userData = nullptr;
         other.state.store(SessionState::Uninitialized, MemoryOrderRelease);
     }
@@ -173,6 +177,7 @@ bool SessionData::initialize(const SessionConfiguration& cfg, MemoryPool* pool)
     // Set configuration
     config = cfg;
     memoryPool = pool;
+    templateState = 0;
     numaNode = cfg.numaNode;
     flags.store(cfg.flags, MemoryOrderRelease);
     
@@ -243,6 +248,7 @@ void SessionData::reset() noexcept {
     id = SessionId{0};
     sessionIndex = 0;
     memoryPool = nullptr;
+    templateState = 0;
     userData = nullptr;
     
     // Reset statistics
@@ -304,6 +310,27 @@ void SessionData::recordError() noexcept {
     AtomicIncrement(stats.errorCount);
 }
 
+void SessionData::recordTickOwned(u64 nowNanos) noexcept {
+    lastTickAt = nowNanos;
+    stats.lastActivityTime = nowNanos;
+    OwnerIncrement(stats.ticksProcessed);
+}
+
+void SessionData::recordOrderOwned(bool executed) noexcept {
+    OwnerIncrement(stats.ordersSubmitted);
+    if (executed) {
+        OwnerIncrement(stats.ordersExecuted);
+    }
+}
+
+void SessionData::recordCancelOwned() noexcept {
+    OwnerIncrement(stats.ordersCancelled);
+}
+
+void SessionData::recordErrorOwned() noexcept {
+    OwnerIncrement(stats.errorCount);
+}
+
 void* SessionData::allocate(usize size, u32 alignment) noexcept {
     if (memoryPool) {
         return memoryPool->allocate(size, alignment);
@@ -350,6 +377,7 @@ const char* SessionStateToString(SessionState state) noexcept {
         case SessionState::Closing:       return "Closing";
         case SessionState::Closed:        return "Closed";
         case SessionState::Error:         return "Error";
+        case SessionState::Hibernated:    return "Hibernated";
         default:                          return "Unknown";
     }
 }
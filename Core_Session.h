@@ -29,7 +29,8 @@ enum class SessionState : u32 {
     Paused        = 3,
     Closing       = 4,
     Closed        = 5,
-    Error         = 6
+    Error         = 6,
+    Hibernated    = 7       // Being moved to the cold store - not writable
 };
 
 // ============================================================================
@@ -132,6 +133,7 @@ struct alignas(ULTRA_PAGE) SessionData {
     // Thread affinity
     u64 cpuAffinity;        // CPU mask for thread affinity
     u32 workerId;           // Assigned worker thread
+    u32 templateState;      // Arena offset + 1 of the DAG template state, 0 = none
     
     // Timestamps (nanoseconds)
     u64 createdAt;
@@ -181,6 +183,13 @@ struct alignas(ULTRA_PAGE) SessionData {
     void recordOrder(bool executed) noexcept;
     void recordError() noexcept;
     
+    // Owner-only statistics - actor mode, the partition's worker is the sole
+    // writer, so no locked RMW. Never mix with the shared variants above.
+    void recordTickOwned(u64 nowNanos) noexcept;
+    void recordOrderOwned(bool executed) noexcept;
+    void recordCancelOwned() noexcept;
+    void recordErrorOwned() noexcept;
+    
     // Memory allocation (from session pool)
     void* allocate(usize size, u32 alignment = CACHE_LINE) noexcept;
     
@@ -3,8 +3,10 @@
 
 #include "Core_SessionManager.h"
 #include <cstdio>
+#include <bit>
 #include <cstring>
 #include <new>
+#include <immintrin.h>  // For _mm_prefetch()
 
 AARENDOCORE_NAMESPACE_BEGIN
 
@@ -67,6 +69,15 @@ void SessionManagerStats::reset() noexcept {
     totalMemoryAllocated.store(0, MemoryOrderRelaxed);
     totalMemoryFreed.store(0, MemoryOrderRelaxed);
     
+    eventsDropped.store(0, MemoryOrderRelaxed);
+    eventsForwarded.store(0, MemoryOrderRelaxed);
+    partitionsMigrated.store(0, MemoryOrderRelaxed);
+    
+    hibernatedSessions.store(0, MemoryOrderRelaxed);
+    totalHibernations.store(0, MemoryOrderRelaxed);
+    totalRehydrations.store(0, MemoryOrderRelaxed);
+    rehydrationTime.store(0, MemoryOrderRelaxed);
+    
     for (u32 i = 0; i < MAX_NUMA_NODES; ++i) {
         sessionsPerNode[i].store(0, MemoryOrderRelaxed);
         memoryPerNode[i].store(0, MemoryOrderRelaxed);
@@ -82,7 +93,6 @@ SessionBucket::SessionBucket() noexcept {
         sessions[i].store(nullptr, MemoryOrderRelaxed);
     }
     count.store(0, MemoryOrderRelaxed);
-    version.store(0, MemoryOrderRelaxed);
 }
 
 SessionBucket::~SessionBucket() noexcept {
@@ -90,16 +100,22 @@ SessionBucket::~SessionBucket() noexcept {
 }
 
 SessionData* SessionBucket::find(SessionId id) const noexcept {
-    u32 currentCount = count.load(MemoryOrderAcquire);
-    
-    for (u32 i = 0; i < currentCount && i < BUCKET_SIZE; ++i) {
-        SessionData* session = sessions[i].load(MemoryOrderAcquire);
-        if (session && session->id.value == id.value) {
-            return session;
+    // Scan every slot - remove() leaves holes, so count is not a bound.
+    // A hit is always good; a miss only if no insert/remove overlapped it.
+    for (;;) {
+        u32 start = sequence.readBegin();
+        
+        for (u32 i = 0; i < BUCKET_SIZE; ++i) {
+            SessionData* session = sessions[i].load(MemoryOrderAcquire);
+            if (session && session->id.value == id.value) {
+                return session;
+            }
+        }
+        
+        if (!sequence.readRetry(start)) {
+            return nullptr;
         }
     }
-    
-    return nullptr;
 }
 
 bool SessionBucket::insert(SessionData* session) noexcept {
@@ -117,14 +133,16 @@ bool SessionBucket::insert(SessionData* session) noexcept {
     
     // Find empty slot
     for (u32 i = 0; i < BUCKET_SIZE; ++i) {
-        SessionData* expected = nullptr;
-        if (sessions[i].compare_exchange_strong(expected, session,
-                                                MemoryOrderRelease, MemoryOrderRelaxed)) {
-            count.fetch_add(1, MemoryOrderRelease);
-            version.fetch_add(1, MemoryOrderRelease);
-            lock.unlock();
-            return true;
+        if (sessions[i].load(MemoryOrderRelaxed) != nullptr) {
+            continue;
         }
+        
+        sequence.writeBegin();
+        sessions[i].store(session, MemoryOrderRelease);
+        sequence.writeEnd();
+        count.fetch_add(1, MemoryOrderRelease);
+        lock.unlock();
+        return true;
     }
     
     lock.unlock();
@@ -137,9 +155,10 @@ bool SessionBucket::remove(SessionId id) noexcept {
     for (u32 i = 0; i < BUCKET_SIZE; ++i) {
         SessionData* session = sessions[i].load(MemoryOrderAcquire);
         if (session && session->id.value == id.value) {
+            sequence.writeBegin();
             sessions[i].store(nullptr, MemoryOrderRelease);
+            sequence.writeEnd();
             count.fetch_sub(1, MemoryOrderRelease);
-            version.fetch_add(1, MemoryOrderRelease);
             lock.unlock();
             return true;
         }
@@ -151,14 +170,15 @@ bool SessionBucket::remove(SessionId id) noexcept {
 
 void SessionBucket::clear() noexcept {
     lock.lock();
+    sequence.writeBegin();
     
     for (u32 i = 0; i < BUCKET_SIZE; ++i) {
         sessions[i].store(nullptr, MemoryOrderRelease);
     }
     
     count.store(0, MemoryOrderRelease);
-    version.fetch_add(1, MemoryOrderRelease);
     
+    sequence.writeEnd();
     lock.unlock();
 }
 
@@ -166,7 +186,7 @@ void SessionBucket::clear() noexcept {
 // SESSION TABLE IMPLEMENTATION
 // ============================================================================
 
-SessionTable::SessionTable() noexcept : buckets_(nullptr) {
+SessionTable::SessionTable() noexcept : buckets_(nullptr), tableMask_(0) {
 }
 
 SessionTable::~SessionTable() noexcept {
@@ -177,22 +197,29 @@ SessionTable::~SessionTable() noexcept {
     }
 }
 
-bool SessionTable::initialize() noexcept {
+bool SessionTable::initialize(u32 bucketCount) noexcept {
     if (buckets_) {
         return false;  // Already initialized
     }
     
+    // Power of two, and at least one probe window
+    u32 tableSize = PROBE_LIMIT;
+    while (tableSize < bucketCount && tableSize < TABLE_SIZE) {
+        tableSize <<= 1;
+    }
+    
     // Allocate bucket array
     buckets_ = static_cast<SessionBucket*>(
-        AllocateAligned(sizeof(SessionBucket) * TABLE_SIZE, CACHE_LINE)
+        AllocateAligned(sizeof(SessionBucket) * tableSize, CACHE_LINE)
     );
     
     if (!buckets_) {
         return false;
     }
+    tableMask_ = tableSize - 1;
     
     // Initialize buckets
-    for (u32 i = 0; i < TABLE_SIZE; ++i) {
+    for (u32 i = 0; i < tableSize; ++i) {
         new(&buckets_[i]) SessionBucket();
     }
     
@@ -211,7 +238,71 @@ SessionData* SessionTable::find(SessionId id) const noexcept {
     AtomicIncrement(const_cast<AtomicU64&>(totalLookups_));
     
     u32 bucketIndex = hash(id);
-    return buckets_[bucketIndex].find(id);
+    SessionData* session = buckets_[bucketIndex].find(id);
+    return session ? session : findProbed(id, bucketIndex);
+}
+
+u32 SessionTable::findBatch(const SessionId* ids, u32 count, 
+                            SessionData** out) const noexcept {
+    if (!buckets_ || !ids || !out) {
+        return 0;
+    }
+    
+    AtomicAdd(const_cast<AtomicU64&>(totalLookups_), static_cast<u64>(count));
+    
+    u32 bucketIndex[LOOKUP_GROUP];
+    u32 found = 0;
+    
+    for (u32 base = 0; base < count; base += LOOKUP_GROUP) {
+        const u32 group = (count - base < LOOKUP_GROUP) ? count - base : LOOKUP_GROUP;
+        
+        // Stage 1: hash the group, put every bucket in flight
+        for (u32 i = 0; i < group; ++i) {
+            bucketIndex[i] = hash(ids[base + i]);
+            const SessionBucket& bucket = buckets_[bucketIndex[i]];
+            _mm_prefetch(reinterpret_cast<const char*>(&bucket.sessions[0]), _MM_HINT_T0);
+            _mm_prefetch(reinterpret_cast<const char*>(&bucket.sessions[8]), _MM_HINT_T0);
+            _mm_prefetch(reinterpret_cast<const char*>(&bucket.count), _MM_HINT_T0);
+        }
+        
+        // Stage 2: buckets have landed (or nearly) - put every candidate's
+        // id line in flight. This is the miss find() pays once per entry.
+        // All slots, not count: removes leave holes anywhere.
+        for (u32 i = 0; i < group; ++i) {
+            const SessionBucket& bucket = buckets_[bucketIndex[i]];
+            for (u32 j = 0; j < SessionBucket::BUCKET_SIZE; ++j) {
+                SessionData* candidate = bucket.sessions[j].load(MemoryOrderAcquire);
+                if (candidate) {
+                    _mm_prefetch(reinterpret_cast<const char*>(candidate), _MM_HINT_T0);
+                }
+            }
+        }
+        
+        // Stage 3: compare - every dereference should now hit cache
+        for (u32 i = 0; i < group; ++i) {
+            const SessionId id = ids[base + i];
+            SessionData* session = buckets_[bucketIndex[i]].find(id);
+            if (!session) {
+                session = findProbed(id, bucketIndex[i]);
+            }
+            out[base + i] = session;
+            found += session ? 1 : 0;
+        }
+    }
+    
+    return found;
+}
+
+SessionData* SessionTable::findProbed(SessionId id, u32 bucketIndex) const noexcept {
+    for (u32 i = 1; i < PROBE_LIMIT; ++i) {
+        u32 probedIndex = (bucketIndex + i) & tableMask_;
+        SessionData* session = buckets_[probedIndex].find(id);
+        if (session) {
+            return session;
+        }
+    }
+    
+    return nullptr;
 }
 
 bool SessionTable::insert(SessionData* session) noexcept {
@@ -229,8 +320,8 @@ bool SessionTable::insert(SessionData* session) noexcept {
     // Collision - try linear probing
     AtomicIncrement(totalCollisions_);
     
-    for (u32 i = 1; i < 16; ++i) {
-        u32 probedIndex = (bucketIndex + i) & TABLE_MASK;
+    for (u32 i = 1; i < PROBE_LIMIT; ++i) {
+        u32 probedIndex = (bucketIndex + i) & tableMask_;
         if (buckets_[probedIndex].insert(session)) {
             AtomicIncrement(totalSessions_);
             return true;
@@ -253,8 +344,8 @@ bool SessionTable::remove(SessionId id) noexcept {
     }
     
     // Check probed locations
-    for (u32 i = 1; i < 16; ++i) {
-        u32 probedIndex = (bucketIndex + i) & TABLE_MASK;
+    for (u32 i = 1; i < PROBE_LIMIT; ++i) {
+        u32 probedIndex = (bucketIndex + i) & tableMask_;
         if (buckets_[probedIndex].remove(id)) {
             AtomicDecrement(totalSessions_);
             return true;
@@ -266,7 +357,7 @@ bool SessionTable::remove(SessionId id) noexcept {
 
 void SessionTable::clear() noexcept {
     if (buckets_) {
-        for (u32 i = 0; i < TABLE_SIZE; ++i) {
+        for (u32 i = 0; i <= tableMask_; ++i) {
             buckets_[i].clear();
         }
         totalSessions_.store(0, MemoryOrderRelaxed);
@@ -281,7 +372,7 @@ u32 SessionTable::hash(SessionId id) const noexcept {
     h ^= h >> 33;
     h *= 0xc4ceb9fe1a85ec53ULL;
     h ^= h >> 33;
-    return static_cast<u32>(h) & TABLE_MASK;
+    return static_cast<u32>(h) & tableMask_;
 }
 
 // ============================================================================
@@ -290,7 +381,7 @@ u32 SessionTable::hash(SessionId id) const noexcept {
 
 SessionPool::SessionPool() noexcept 
     : poolSize_(0), nodeId_(0), sessions_(nullptr), 
-      freeList_(nullptr), nodes_(nullptr) {
+      limboNodes_(nullptr), limbo_(nullptr), heartbeatTimers_(nullptr) {
 }
 
 SessionPool::~SessionPool() noexcept {
@@ -305,61 +396,64 @@ bool SessionPool::initialize(u32 size, u32 nodeId) noexcept {
     poolSize_ = size;
     nodeId_ = nodeId;
     
-    // Allocate session array on specific NUMA node
-    sessions_ = static_cast<SessionData*>(
-        AllocateOnNumaNode(nodeId, sizeof(SessionData) * size, ULTRA_PAGE)
+    // Allocate session array on specific NUMA node - no poisoning, the
+    // sessions stay constructed while they sit in the free list
+    if (!slots_.initialize(size, static_cast<i32>(nodeId), ULTRA_PAGE, false)) {
+        return false;
+    }
+    sessions_ = slots_.data();
+    
+    // Allocate limbo list nodes
+    limboNodes_ = static_cast<LimboNode*>(
+        AllocateAligned(sizeof(LimboNode) * size, CACHE_LINE)
     );
     
-    if (!sessions_) {
+    if (!limboNodes_) {
+        slots_.shutdown();
+        sessions_ = nullptr;
         return false;
     }
     
-    // Allocate free list nodes
-    nodes_ = static_cast<FreeNode*>(
-        AllocateAligned(sizeof(FreeNode) * size, CACHE_LINE)
+    // Heartbeat timers live on the same node as their sessions
+    heartbeatTimers_ = static_cast<TimerNode*>(
+        AllocateOnNumaNode(nodeId, sizeof(TimerNode) * size, CACHE_LINE)
     );
     
-    if (!nodes_) {
-        FreeNumaMemory(sessions_);
+    if (!heartbeatTimers_) {
+        FreeAligned(limboNodes_);
+        limboNodes_ = nullptr;
+        slots_.shutdown();
         sessions_ = nullptr;
         return false;
     }
     
-    // Initialize sessions and build free list
-    FreeNode* head = nullptr;
+    heartbeatWheel_.initialize(GetCurrentTimeNanos(), HEARTBEAT_TICK_SHIFT);
+    
+    // Initialize sessions - the pool hands out never-used slots itself
     for (u32 i = 0; i < size; ++i) {
         new(&sessions_[i]) SessionData();
         sessions_[i].sessionIndex = i;
         sessions_[i].numaNode = nodeId;
         
-        nodes_[i].session = &sessions_[i];
-        nodes_[i].next = head;
-        head = &nodes_[i];
+        limboNodes_[i].session = &sessions_[i];
+        limboNodes_[i].next = nullptr;
+        
+        new(&heartbeatTimers_[i]) TimerNode();
+        heartbeatTimers_[i].context = &sessions_[i];
     }
     
-    freeList_.store(head, MemoryOrderRelease);
-    available_.store(size, MemoryOrderRelaxed);
-    allocated_.store(0, MemoryOrderRelaxed);
-    
     return true;
 }
 
 SessionData* SessionPool::allocate() noexcept {
-    FreeNode* head = freeList_.load(MemoryOrderAcquire);
+    SessionData* session = slots_.allocate();
     
-    while (head) {
-        FreeNode* next = head->next;
-        
-        if (freeList_.compare_exchange_weak(head, next,
-                                           MemoryOrderRelease,
-                                           MemoryOrderAcquire)) {
-            AtomicIncrement(allocated_);
-            AtomicDecrement(available_);
-            return head->session;
-        }
+    // Pool drained - pull in whatever has cleared its grace period
+    if (!session && recycleRetired() > 0) {
+        session = slots_.allocate();
     }
     
-    return nullptr;  // Pool exhausted
+    return session;  // nullptr = pool exhausted
 }
 
 void SessionPool::deallocate(SessionData* session) noexcept {
@@ -371,20 +465,119 @@ void SessionPool::deallocate(SessionData* session) noexcept {
     // Reset session
     session->reset();
     
-    // Find corresponding node
-    u32 index = static_cast<u32>(session - sessions_);
-    FreeNode* node = &nodes_[index];
+    // Back to this thread's cache, spilled to the shared list in batches
+    slots_.deallocate(session);
+}
+
+void SessionPool::retire(SessionData* session) noexcept {
+    if (!session || session < sessions_ || 
+        session >= sessions_ + poolSize_) {
+        return;  // Not from this pool
+    }
+    
+    // PSYCHOTIC PRECISION: Stamp after the table unlink, never reset here -
+    // a reader that found the session a moment ago may still be using it
+    LimboNode* node = &limboNodes_[session - sessions_];
+    node->retireEpoch = GetEpochManager().stamp();
     
-    // Add back to free list
-    FreeNode* head = freeList_.load(MemoryOrderAcquire);
+    LimboNode* head = limbo_.load(MemoryOrderAcquire);
     do {
         node->next = head;
-    } while (!freeList_.compare_exchange_weak(head, node,
-                                              MemoryOrderRelease,
-                                              MemoryOrderAcquire));
+    } while (!limbo_.compare_exchange_weak(head, node,
+                                           MemoryOrderRelease,
+                                           MemoryOrderAcquire));
+    
+    // Amortize the epoch scan over a batch of destroys
+    if ((AtomicIncrement(limboCount_) + 1) % EPOCH_RECLAIM_BATCH == 0) {
+        recycleRetired();
+    }
+}
+
+u32 SessionPool::recycleRetired() noexcept {
+    LimboNode* list = limbo_.exchange(nullptr, MemoryOrderAcqRel);
+    if (!list) {
+        return 0;
+    }
     
-    AtomicDecrement(allocated_);
-    AtomicIncrement(available_);
+    const u64 safe = GetEpochManager().safeEpoch();
+    u32 recycled = 0;
+    
+    while (list) {
+        LimboNode* node = list;
+        list = node->next;
+        
+        if (node->retireEpoch < safe) {
+            AtomicDecrement(limboCount_);
+            deallocate(node->session);
+            ++recycled;
+        } else {
+            // Still visible to some reader - back on the limbo list
+            LimboNode* head = limbo_.load(MemoryOrderAcquire);
+            do {
+                node->next = head;
+            } while (!limbo_.compare_exchange_weak(head, node,
+                                                   MemoryOrderRelease,
+                                                   MemoryOrderAcquire));
+        }
+    }
+    
+    return recycled;
+}
+
+void SessionPool::armHeartbeat(SessionData* session, u64 deadlineNanos) noexcept {
+    if (!session || session < sessions_ || 
+        session >= sessions_ + poolSize_) {
+        return;  // Not from this pool
+    }
+    
+    heartbeatLock_.lock();
+    heartbeatWheel_.schedule(&heartbeatTimers_[session - sessions_], deadlineNanos);
+    heartbeatLock_.unlock();
+}
+
+void SessionPool::cancelHeartbeat(SessionData* session) noexcept {
+    if (!session || session < sessions_ || 
+        session >= sessions_ + poolSize_) {
+        return;  // Not from this pool
+    }
+    
+    heartbeatLock_.lock();
+    heartbeatWheel_.cancel(&heartbeatTimers_[session - sessions_]);
+    heartbeatLock_.unlock();
+}
+
+u32 SessionPool::collectTimedOut(u64 nowNanos, u64 timeoutNanos,
+                                 SessionId* ids, u32 maxIds) noexcept {
+    if (!heartbeatTimers_ || !ids) {
+        return 0;
+    }
+    
+    u32 count = 0;
+    
+    heartbeatLock_.lock();
+    heartbeatWheel_.advance(nowNanos);
+    
+    while (count < maxIds) {
+        TimerNode* timer = heartbeatWheel_.popExpired();
+        if (!timer) {
+            break;
+        }
+        
+        // PSYCHOTIC PRECISION: Heartbeats only store a timestamp, the timer is
+        // re-armed lazily here - a live session costs one pop per timeout period
+        SessionData* session = static_cast<SessionData*>(timer->context);
+        u64 lastHeartbeat = session->lastHeartbeatAt;
+        
+        if (!session->isActive() || lastHeartbeat + timeoutNanos > nowNanos) {
+            heartbeatWheel_.schedule(timer, 
+                (session->isActive() ? lastHeartbeat : nowNanos) + timeoutNanos);
+        } else {
+            ids[count++] = session->id;
+        }
+    }
+    
+    heartbeatLock_.unlock();
+    return count;
 }
 
 void SessionPool::release() noexcept {
@@ -394,17 +587,434 @@ void SessionPool::release() noexcept {
             sessions_[i].~SessionData();
         }
         
-        FreeNumaMemory(sessions_);
+        slots_.shutdown();
         sessions_ = nullptr;
     }
     
-    if (nodes_) {
-        FreeAligned(nodes_);
-        nodes_ = nullptr;
+    if (limboNodes_) {
+        FreeAligned(limboNodes_);
+        limboNodes_ = nullptr;
+    }
+    
+    if (heartbeatTimers_) {
+        FreeNumaMemory(heartbeatTimers_);
+        heartbeatTimers_ = nullptr;
+        heartbeatWheel_.initialize(0, HEARTBEAT_TICK_SHIFT);
     }
     
     poolSize_ = 0;
-    freeList_.store(nullptr, MemoryOrderRelease);
+    limbo_.store(nullptr, MemoryOrderRelease);
+    limboCount_.store(0, MemoryOrderRelaxed);
+}
+
+// ============================================================================
+// SESSION INBOX IMPLEMENTATION
+// ============================================================================
+
+SessionInbox::SessionInbox() noexcept 
+    : cells_(nullptr), mask_(0), head_(0), 
+      parked_(nullptr), parkedPartition_(nullptr), parkedPerPartition_(nullptr),
+      parkedCount_(0), parkedCapacity_(0) {
+}
+
+SessionInbox::~SessionInbox() noexcept {
+    release();
+}
+
+bool SessionInbox::initialize(u32 capacity, u32 nodeId) noexcept {
+    if (cells_ || capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        return false;
+    }
+    
+    // Inbox lives with its worker, not with the producers
+    cells_ = static_cast<Cell*>(
+        AllocateOnNumaNode(nodeId, sizeof(Cell) * capacity, CACHE_LINE)
+    );
+    
+    // The backlog holds at most an inbox worth - same node, owner only
+    parked_ = static_cast<SessionEvent*>(
+        AllocateOnNumaNode(nodeId, sizeof(SessionEvent) * capacity, CACHE_LINE)
+    );
+    parkedPartition_ = static_cast<u32*>(
+        AllocateOnNumaNode(nodeId, sizeof(u32) * capacity, CACHE_LINE)
+    );
+    parkedPerPartition_ = static_cast<u32*>(
+        AllocateOnNumaNode(nodeId, sizeof(u32) * SESSION_PARTITIONS, CACHE_LINE)
+    );
+    
+    if (!cells_ || !parked_ || !parkedPartition_ || !parkedPerPartition_) {
+        release();
+        return false;
+    }
+    
+    for (u32 i = 0; i < capacity; ++i) {
+        new(&cells_[i]) Cell();
+        cells_[i].sequence.store(i, MemoryOrderRelaxed);
+    }
+    std::memset(parkedPerPartition_, 0, sizeof(u32) * SESSION_PARTITIONS);
+    
+    mask_ = capacity - 1;
+    head_ = 0;
+    tail_.store(0, MemoryOrderRelease);
+    parkedCount_ = 0;
+    parkedCapacity_ = capacity;
+    return true;
+}
+
+void SessionInbox::release() noexcept {
+    if (cells_) {
+        FreeNumaMemory(cells_);
+        cells_ = nullptr;
+    }
+    if (parked_) {
+        FreeNumaMemory(parked_);
+        parked_ = nullptr;
+    }
+    if (parkedPartition_) {
+        FreeNumaMemory(parkedPartition_);
+        parkedPartition_ = nullptr;
+    }
+    if (parkedPerPartition_) {
+        FreeNumaMemory(parkedPerPartition_);
+        parkedPerPartition_ = nullptr;
+    }
+    mask_ = 0;
+    parkedCount_ = 0;
+    parkedCapacity_ = 0;
+}
+
+bool SessionInbox::push(const SessionEvent& event) noexcept {
+    u64 pos = tail_.load(MemoryOrderRelaxed);
+    
+    for (;;) {
+        Cell& cell = cells_[pos & mask_];
+        u64 seq = cell.sequence.load(MemoryOrderAcquire);
+        i64 diff = static_cast<i64>(seq) - static_cast<i64>(pos);
+        
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, MemoryOrderRelaxed)) {
+                cell.event = event;
+                cell.sequence.store(pos + 1, MemoryOrderRelease);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // Full - owner is behind
+        } else {
+            pos = tail_.load(MemoryOrderRelaxed);
+        }
+    }
+}
+
+bool SessionInbox::pop(SessionEvent& event) noexcept {
+    Cell& cell = cells_[head_ & mask_];
+    if (cell.sequence.load(MemoryOrderAcquire) != head_ + 1) {
+        return false;  // Empty, or producer still writing
+    }
+    
+    event = cell.event;
+    cell.sequence.store(head_ + mask_ + 1, MemoryOrderRelease);
+    ++head_;
+    return true;
+}
+
+bool SessionInbox::park(const SessionEvent& event, u32 partition) noexcept {
+    if (parkedCount_ == parkedCapacity_) {
+        return false;
+    }
+    
+    parked_[parkedCount_] = event;
+    parkedPartition_[parkedCount_] = partition;
+    ++parkedCount_;
+    ++parkedPerPartition_[partition];
+    return true;
+}
+
+// ============================================================================
+// COLD SESSION STORE IMPLEMENTATION
+// ============================================================================
+
+namespace {
+
+// Everything needed to bring a session back. The MemoryPool header and user
+// data stay put while the session sleeps; the arena's used bytes travel in
+// the cold entry and its backing memory is released until rehydration.
+struct SessionSnapshot {
+    u64 id;
+    u32 numaNode;
+    u32 state;              // State before hibernation
+    u32 flags;
+    u32 workerId;
+    u32 templateState;      // Arena offset - the arena comes back with it
+    u32 reserved;
+    u64 cpuAffinity;
+    u64 createdAt;
+    u64 lastTickAt;
+    u64 lastHeartbeatAt;
+    MemoryPool* memoryPool;
+    void* userData;
+    u64 statTimes[3];       // creation, last activity, total processing
+    u64 counters[10];       // SessionStatistics counters in declaration order
+    SessionConfiguration config;
+};
+
+// Token 0x00-0x7F: n+1 literal bytes follow. 0x80-0xFF: (n & 0x7F)+1 zeros.
+constexpr u32 COLD_SNAPSHOT_CAPACITY = sizeof(SessionSnapshot) + sizeof(SessionSnapshot) / 64 + 2;
+
+void captureSnapshot(const SessionData& session, SessionState previous, 
+                     SessionSnapshot& snapshot) noexcept {
+    // Zero padding too - it compresses to nothing and keeps blobs stable
+    std::memset(static_cast<void*>(&snapshot), 0, sizeof(snapshot));
+    
+    snapshot.id = session.id.value;
+    snapshot.numaNode = session.numaNode;
+    snapshot.state = static_cast<u32>(previous);
+    snapshot.flags = session.flags.load(MemoryOrderAcquire);
+    snapshot.workerId = session.workerId;
+    snapshot.templateState = session.templateState;
+    snapshot.cpuAffinity = session.cpuAffinity;
+    snapshot.createdAt = session.createdAt;
+    snapshot.lastTickAt = session.lastTickAt;
+    snapshot.lastHeartbeatAt = session.lastHeartbeatAt;
+    snapshot.memoryPool = session.memoryPool;
+    snapshot.userData = session.userData;
+    
+    const SessionStatistics& stats = session.stats;
+    snapshot.statTimes[0] = stats.creationTime;
+    snapshot.statTimes[1] = stats.lastActivityTime;
+    snapshot.statTimes[2] = stats.totalProcessingTime;
+    snapshot.counters[0] = stats.ticksProcessed.load(MemoryOrderRelaxed);
+    snapshot.counters[1] = stats.ordersSubmitted.load(MemoryOrderRelaxed);
+    snapshot.counters[2] = stats.ordersExecuted.load(MemoryOrderRelaxed);
+    snapshot.counters[3] = stats.ordersCancelled.load(MemoryOrderRelaxed);
+    snapshot.counters[4] = stats.messagesSent.load(MemoryOrderRelaxed);
+    snapshot.counters[5] = stats.messagesReceived.load(MemoryOrderRelaxed);
+    snapshot.counters[6] = stats.bytesTransferred.load(MemoryOrderRelaxed);
+    snapshot.counters[7] = stats.errorCount.load(MemoryOrderRelaxed);
+    snapshot.counters[8] = stats.cacheHits.load(MemoryOrderRelaxed);
+    snapshot.counters[9] = stats.cacheMisses.load(MemoryOrderRelaxed);
+    
+    std::memcpy(&snapshot.config, &session.config, sizeof(SessionConfiguration));
+}
+
+void restoreSnapshot(const SessionSnapshot& snapshot, SessionData& session) noexcept {
+    session.id = SessionId{snapshot.id};
+    session.numaNode = snapshot.numaNode;
+    session.flags.store(snapshot.flags, MemoryOrderRelaxed);
+    session.workerId = snapshot.workerId;
+    session.templateState = snapshot.templateState;
+    session.cpuAffinity = snapshot.cpuAffinity;
+    session.createdAt = snapshot.createdAt;
+    session.lastTickAt = snapshot.lastTickAt;
+    session.lastHeartbeatAt = snapshot.lastHeartbeatAt;
+    session.memoryPool = snapshot.memoryPool;
+    session.userData = snapshot.userData;
+    
+    SessionStatistics& stats = session.stats;
+    stats.creationTime = snapshot.statTimes[0];
+    stats.lastActivityTime = snapshot.statTimes[1];
+    stats.totalProcessingTime = snapshot.statTimes[2];
+    stats.ticksProcessed.store(snapshot.counters[0], MemoryOrderRelaxed);
+    stats.ordersSubmitted.store(snapshot.counters[1], MemoryOrderRelaxed);
+    stats.ordersExecuted.store(snapshot.counters[2], MemoryOrderRelaxed);
+    stats.ordersCancelled.store(snapshot.counters[3], MemoryOrderRelaxed);
+    stats.messagesSent.store(snapshot.counters[4], MemoryOrderRelaxed);
+    stats.messagesReceived.store(snapshot.counters[5], MemoryOrderRelaxed);
+    stats.bytesTransferred.store(snapshot.counters[6], MemoryOrderRelaxed);
+    stats.errorCount.store(snapshot.counters[7], MemoryOrderRelaxed);
+    stats.cacheHits.store(snapshot.counters[8], MemoryOrderRelaxed);
+    stats.cacheMisses.store(snapshot.counters[9], MemoryOrderRelaxed);
+    
+    std::memcpy(&session.config, &snapshot.config, sizeof(SessionConfiguration));
+    
+    // State last - the session is writable from here on
+    session.state.store(static_cast<SessionState>(snapshot.state), MemoryOrderRelease);
+}
+
+// Zero-run encoding - a snapshot is mostly empty strings, idle counters and
+// high zero bytes, so this gets ~5x at memcpy speed with no dependency
+u32 compressZeroRuns(const u8* src, u32 size, u8* dst) noexcept {
+    u32 in = 0;
+    u32 out = 0;
+    
+    while (in < size) {
+        if (src[in] == 0) {
+            u32 run = 1;
+            while (in + run < size && run < 128 && src[in + run] == 0) {
+                ++run;
+            }
+            dst[out++] = static_cast<u8>(0x80 | (run - 1));
+            in += run;
+        } else {
+            // A lone zero stays in the literal - a token would cost as much
+            u32 start = in;
+            u32 run = 0;
+            while (in < size && run < 128 && 
+                   !(src[in] == 0 && (in + 1 >= size || src[in + 1] == 0))) {
+                ++in;
+                ++run;
+            }
+            dst[out++] = static_cast<u8>(run - 1);
+            std::memcpy(dst + out, src + start, run);
+            out += run;
+        }
+    }
+    
+    return out;
+}
+
+bool expandZeroRuns(const u8* src, u32 size, u8* dst, u32 expected) noexcept {
+    u32 in = 0;
+    u32 out = 0;
+    
+    while (in < size) {
+        u8 token = src[in++];
+        u32 run = (token & 0x7F) + 1;
+        if (out + run > expected) {
+            return false;
+        }
+        
+        if (token & 0x80) {
+            std::memset(dst + out, 0, run);
+        } else {
+            if (in + run > size) {
+                return false;
+            }
+            std::memcpy(dst + out, src + in, run);
+            in += run;
+        }
+        out += run;
+    }
+    
+    return out == expected;
+}
+
+void reclaimArenaBuffer(void* object, void* /*context*/) noexcept {
+    FreeAligned(object);
+}
+
+// Readers inside an EpochGuard may still hold the session and read its
+// arena - the buffer goes through the EBR limbo like the slot
+void retireArenaBuffer(MemoryPool* arena) noexcept {
+    byte* buffer = arena->detach();
+    if (buffer) {
+        GetEpochManager().retire(buffer, reclaimArenaBuffer);
+    }
+}
+
+} // anonymous namespace
+
+ColdSessionStore::ColdSessionStore() noexcept 
+    : stripes_(nullptr) {
+}
+
+ColdSessionStore::~ColdSessionStore() noexcept {
+    release();
+}
+
+bool ColdSessionStore::initialize() noexcept {
+    if (stripes_) {
+        return false;
+    }
+    
+    stripes_ = static_cast<Stripe*>(
+        AllocateAligned(sizeof(Stripe) * COLD_STORE_STRIPES, CACHE_LINE)
+    );
+    
+    if (!stripes_) {
+        return false;
+    }
+    
+    for (u32 i = 0; i < COLD_STORE_STRIPES; ++i) {
+        new(&stripes_[i]) Stripe();
+        stripes_[i].head = nullptr;
+    }
+    
+    count_.store(0, MemoryOrderRelaxed);
+    bytes_.store(0, MemoryOrderRelaxed);
+    return true;
+}
+
+void ColdSessionStore::release() noexcept {
+    if (!stripes_) {
+        return;
+    }
+    
+    for (u32 i = 0; i < COLD_STORE_STRIPES; ++i) {
+        Entry* entry = stripes_[i].head;
+        while (entry) {
+            Entry* next = entry->next;
+            FreeAligned(entry);
+            entry = next;
+        }
+        stripes_[i].~Stripe();
+    }
+    
+    FreeAligned(stripes_);
+    stripes_ = nullptr;
+    count_.store(0, MemoryOrderRelaxed);
+    bytes_.store(0, MemoryOrderRelaxed);
+}
+
+const ColdSessionStore::Entry* ColdSessionStore::find(SessionId id) const noexcept {
+    if (!stripes_) {
+        return nullptr;
+    }
+    
+    for (const Entry* entry = stripeFor(id).head; entry; entry = entry->next) {
+        if (entry->id == id.value) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+bool ColdSessionStore::insert(SessionId id, const u8* data, u32 size, 
+                              const u8* arena, u32 arenaSize) noexcept {
+    if (!stripes_ || find(id) || (arenaSize && !arena)) {
+        return false;
+    }
+    
+    usize bytes = offsetof(Entry, data) + size + arenaSize;
+    Entry* entry = static_cast<Entry*>(AllocateAligned(bytes, 16));
+    if (!entry) {
+        return false;
+    }
+    
+    entry->id = id.value;
+    entry->size = size;
+    entry->arenaSize = arenaSize;
+    std::memcpy(entry->data, data, size);
+    if (arenaSize) {
+        std::memcpy(entry->data + size, arena, arenaSize);
+    }
+    
+    Stripe& stripe = stripeFor(id);
+    entry->next = stripe.head;
+    stripe.head = entry;
+    
+    AtomicIncrement(count_);
+    AtomicAdd(bytes_, static_cast<u64>(bytes));
+    return true;
+}
+
+bool ColdSessionStore::erase(SessionId id) noexcept {
+    if (!stripes_) {
+        return false;
+    }
+    
+    Entry** link = &stripeFor(id).head;
+    while (*link) {
+        Entry* entry = *link;
+        if (entry->id == id.value) {
+            *link = entry->next;
+            bytes_.fetch_sub(offsetof(Entry, data) + entry->size + entry->arenaSize, MemoryOrderRelaxed);
+            AtomicDecrement(count_);
+            FreeAligned(entry);
+            return true;
+        }
+        link = &entry->next;
+    }
+    return false;
 }
 
 // ============================================================================
@@ -412,10 +1022,18 @@ void SessionPool::release() noexcept {
 // ============================================================================
 
 SessionManager::SessionManager() noexcept 
-    : numaNodes_(0), threadPool_(nullptr) {
+    : numaNodes_(0), threadPool_(nullptr), idCounterMask_(0xFFFFFFFF), idShardBits_(0),
+      inboxes_(nullptr), actorWorkers_(0), 
+      hibernateCursor_(0), checkpointShadow_{}, checkpointDirty_{}, 
+      checkpointGeneration_(0), checkpointColdPending_(false) {
     for (u32 i = 0; i < MAX_NUMA_NODES; ++i) {
         pools_[i] = nullptr;
     }
+    for (u32 i = 0; i < SESSION_PARTITIONS; ++i) {
+        partitionOwner_[i].store(0, MemoryOrderRelaxed);
+        partitionLoad_[i].store(0, MemoryOrderRelaxed);
+        rebalanceBaseline_[i] = 0;
+    }
 }
 
 SessionManager::~SessionManager() noexcept {
@@ -423,32 +1041,64 @@ SessionManager::~SessionManager() noexcept {
 }
 
 bool SessionManager::initialize(ThreadPool* threadPool) noexcept {
+    // Get NUMA configuration
+    u32 nodes = GetNumaNodeCount();
+    if (nodes == 0) {
+        nodes = 1;
+    }
+    
+    idCounterMask_ = 0xFFFFFFFF;
+    idShardBits_ = 0;
+    return initializeWith(threadPool, nodes, -1, SESSIONS_PER_NUMA_NODE,
+                          SessionTable::TABLE_SIZE, MEMORY_POOL_SIZE / nodes);
+}
+
+bool SessionManager::initializeShard(ThreadPool* threadPool, 
+                                     const SessionShardConfig& shard) noexcept {
+    if (shard.shardCount == 0 || shard.shardCount > MAX_SESSION_SHARDS ||
+        shard.shardIndex >= shard.shardCount ||
+        shard.sessionCapacity == 0 || shard.memoryBytes == 0) {
+        return false;
+    }
+    
+    idCounterMask_ = SESSION_SHARD_COUNTER_MASK;
+    idShardBits_ = shard.shardIndex << SESSION_SHARD_SHIFT;
+    return initializeWith(threadPool, 1, static_cast<i32>(shard.homeNode), shard.sessionCapacity,
+                          shard.tableBuckets, shard.memoryBytes);
+}
+
+bool SessionManager::initializeWith(ThreadPool* threadPool, u32 nodes, i32 homeNode,
+                                    u32 sessionsPerPool, u32 tableBuckets,
+                                    usize memoryPerNode) noexcept {
     if (initialized_.load(MemoryOrderAcquire)) {
         return false;  // Already initialized
     }
     
-    // Get NUMA configuration
-    numaNodes_ = GetNumaNodeCount();
-    if (numaNodes_ == 0) {
-        numaNodes_ = 1;
-    }
+    numaNodes_ = nodes;
     
     // Initialize session table
-    if (!sessionTable_.initialize()) {
+    if (!sessionTable_.initialize(tableBuckets)) {
         return false;
     }
     
     // Initialize memory pool
-    u64 memoryPerNode = MEMORY_POOL_SIZE / numaNodes_;
     if (!memoryPool_.initialize(numaNodes_, memoryPerNode)) {
         return false;
     }
     
     // Initialize session pools
-    if (!initializePools()) {
+    if (!initializePools(sessionsPerPool, homeNode)) {
+        memoryPool_.release();
+        return false;
+    }
+    
+    // Cold store for hibernated sessions
+    if (!coldStore_.initialize()) {
+        releasePools();
         memoryPool_.release();
         return false;
     }
+    hibernateCursor_ = 0;
     
     // Set thread pool
     threadPool_ = threadPool;
@@ -469,11 +1119,15 @@ void SessionManager::shutdown() noexcept {
     
     running_.store(false, MemoryOrderRelease);
     
+    disableActorMode();
+    
     // Clear session table
     sessionTable_.clear();
     
-    // Release pools
+    // Close the checkpoint, release pools and hibernated snapshots
+    closeCheckpoint();
     releasePools();
+    coldStore_.release();
     
     // Release memory pool
     memoryPool_.release();
@@ -506,7 +1160,7 @@ SessionId SessionManager::createSession(const SessionConfiguration& config) noex
     }
     
     // Generate unique session ID
-    SessionId id = GenerateSessionId(nextSessionId_.next());
+    SessionId id = GenerateSessionId((nextSessionId_.next() & idCounterMask_) | idShardBits_);
     session->id = id;
     
     // Allocate memory pool for session
@@ -534,6 +1188,11 @@ SessionId SessionManager::createSession(const SessionConfiguration& config) noex
         return SessionId{0};
     }
     
+    // Actor mode - record the owner before the session becomes visible
+    if (inboxes_) {
+        session->workerId = getOwnerWorker(id);
+    }
+    
     // Add to lookup table
     if (!sessionTable_.insert(session)) {
         session->close();
@@ -543,6 +1202,11 @@ SessionId SessionManager::createSession(const SessionConfiguration& config) noex
         return SessionId{0};
     }
     
+    // Arm heartbeat timeout
+    pool->armHeartbeat(session, session->lastHeartbeatAt + 
+                       heartbeatTimeoutNanos_.load(MemoryOrderRelaxed));
+    markSlotDirty(session);
+    
     // Update statistics
     AtomicIncrement(stats_.totalSessionsCreated);
     AtomicIncrement(stats_.activeSessions);
@@ -563,6 +1227,9 @@ SessionData* SessionManager::getSession(SessionId id) noexcept {
     
     u64 startTime = GetCurrentTimeNanos();
     SessionData* session = sessionTable_.find(id);
+    if (!session) {
+        session = rehydrate(id);  // Hibernated - bring it back transparently
+    }
     
     u64 endTime = GetCurrentTimeNanos();
     AtomicAdd(stats_.sessionLookupTime, endTime - startTime);
@@ -570,13 +1237,41 @@ SessionData* SessionManager::getSession(SessionId id) noexcept {
     return session;
 }
 
-const SessionData* SessionManager::getSession(SessionId id) const noexcept {
-    if (!running_.load(MemoryOrderAcquire)) {
-        return nullptr;
+u32 SessionManager::getSessions(const SessionId* ids, u32 count, 
+                                SessionData** out) noexcept {
+    if (!running_.load(MemoryOrderAcquire) || !ids || !out || count == 0) {
+        return 0;
     }
     
-    return sessionTable_.find(id);
-}
+    u64 startTime = GetCurrentTimeNanos();
+    u32 found = sessionTable_.findBatch(ids, count, out);
+    
+    if (found < count && coldStore_.getCount() > 0) {
+        for (u32 i = 0; i < count; ++i) {
+            if (!out[i] && (out[i] = rehydrate(ids[i])) != nullptr) {
+                ++found;
+            }
+        }
+    }
+    
+    u64 endTime = GetCurrentTimeNanos();
+    AtomicAdd(stats_.sessionLookupTime, endTime - startTime);
+    
+    return found;
+}
+
+const SessionData* SessionManager::getSession(SessionId id) const noexcept {
+    if (!running_.load(MemoryOrderAcquire)) {
+        return nullptr;
+    }
+    
+    const SessionData* session = sessionTable_.find(id);
+    if (!session) {
+        // Rehydration does not change what the caller can observe
+        session = const_cast<SessionManager*>(this)->rehydrate(id);
+    }
+    return session;
+}
 
 bool SessionManager::destroySession(SessionId id) noexcept {
     if (!running_.load(MemoryOrderAcquire)) {
@@ -585,28 +1280,33 @@ bool SessionManager::destroySession(SessionId id) noexcept {
     
     u64 startTime = GetCurrentTimeNanos();
     
-    // Find session
+    // Find session - a hibernated one is brought back so it closes normally
     SessionData* session = sessionTable_.find(id);
     if (!session) {
-        return false;
+        session = rehydrate(id);
     }
-    
-    // Remove from table
-    if (!sessionTable_.remove(id)) {
+    if (!session) {
         return false;
     }
     
-    // Get session's NUMA node
+    // Get session's NUMA node and arena - read before the remove, a
+    // hibernated slot may be recycled once it is out of the table
     u32 nodeId = session->numaNode;
+    MemoryPool* arena = session->memoryPool;
+    usize poolSize = session->config.maxMemoryUsage;
+    
+    // Remove from table - a miss means hibernate took it since the find
+    if (!sessionTable_.remove(id)) {
+        return destroyColdSession(id, nodeId, arena, poolSize, startTime);
+    }
     
     // Close session
     session->close();
     
     // Release session memory
-    if (session->memoryPool) {
-        usize poolSize = session->config.maxMemoryUsage;
-        session->memoryPool->release();
-        session->memoryPool->~MemoryPool();
+    if (arena) {
+        retireArenaBuffer(arena);
+        arena->~MemoryPool();
         memoryPool_.reset();
         
         AtomicAdd(stats_.totalMemoryFreed, poolSize);
@@ -614,9 +1314,11 @@ bool SessionManager::destroySession(SessionId id) noexcept {
         stats_.memoryPerNode[nodeId].fetch_sub(poolSize, MemoryOrderRelaxed);
     }
     
-    // Return to pool
+    // Return to pool - the next checkpoint pass sees the slot emptied
     if (nodeId < numaNodes_ && pools_[nodeId]) {
-        pools_[nodeId]->deallocate(session);
+        markSlotDirty(session);
+        pools_[nodeId]->cancelHeartbeat(session);
+        pools_[nodeId]->retire(session);
     }
     
     // Update statistics
@@ -630,6 +1332,37 @@ bool SessionManager::destroySession(SessionId id) noexcept {
     return true;
 }
 
+bool SessionManager::destroyColdSession(SessionId id, u32 nodeId, MemoryPool* arena,
+                                        usize poolSize, u64 startTime) noexcept {
+    // Same stripe lock as hibernate and rehydrate - the entry is either
+    // fully cold here or already back in the table
+    Spinlock& lock = coldStore_.lockFor(id);
+    lock.lock();
+    bool erased = coldStore_.erase(id);
+    lock.unlock();
+    
+    if (!erased) {
+        return false;  // Rehydrated or destroyed by another caller
+    }
+    
+    // Hibernate already released the arena's backing memory
+    if (arena) {
+        arena->~MemoryPool();
+        memoryPool_.reset();
+        
+        AtomicAdd(stats_.totalMemoryFreed, poolSize);
+        stats_.memoryPerNode[nodeId].fetch_sub(poolSize, MemoryOrderRelaxed);
+    }
+    
+    stats_.hibernatedSessions.fetch_sub(1, MemoryOrderRelaxed);
+    AtomicIncrement(stats_.totalSessionsDestroyed);
+    AtomicDecrement(stats_.activeSessions);
+    AtomicDecrement(stats_.sessionsPerNode[nodeId]);
+    AtomicAdd(stats_.sessionDestructionTime, GetCurrentTimeNanos() - startTime);
+    
+    return true;
+}
+
 u32 SessionManager::createSessions(const SessionConfiguration& config,
                                    SessionId* ids, u32 count) noexcept {
     if (!running_.load(MemoryOrderAcquire) || !ids || count == 0) {
@@ -684,21 +1417,56 @@ bool SessionManager::allocateSessionMemory(SessionId id, usize size) noexcept {
     }
     
     void* memory = session->allocate(size);
-    return memory != nullptr;
+    if (!memory) {
+        return false;
+    }
+    
+    markSlotDirty(session);  // After the change, never before
+    return true;
 }
 
 void SessionManager::releaseSessionMemory(SessionId id) noexcept {
     SessionData* session = getSession(id);
     if (session && session->memoryPool) {
         session->memoryPool->reset();
+        markSlotDirty(session);
     }
 }
 
 u32 SessionManager::cleanupInactiveSessions(u64 timeoutNanos) noexcept {
-    // This would iterate through all sessions and clean up inactive ones
-    // For now, return 0 as placeholder
-    (void)timeoutNanos;
-    return 0;
+    if (!running_.load(MemoryOrderAcquire)) {
+        return 0;
+    }
+    
+    // New timeout applies to new sessions and to timers as they re-arm
+    if (timeoutNanos != 0) {
+        heartbeatTimeoutNanos_.store(timeoutNanos, MemoryOrderRelaxed);
+    }
+    u64 timeout = heartbeatTimeoutNanos_.load(MemoryOrderRelaxed);
+    
+    // PSYCHOTIC PRECISION: No scan - each pool's wheel hands back only the
+    // sessions whose timeout came due
+    SessionId ids[HEARTBEAT_SWEEP_BATCH];
+    u64 now = GetCurrentTimeNanos();
+    u32 destroyed = 0;
+    
+    for (u32 i = 0; i < numaNodes_; ++i) {
+        if (!pools_[i]) {
+            continue;
+        }
+        
+        u32 count;
+        do {
+            count = pools_[i]->collectTimedOut(now, timeout, ids, HEARTBEAT_SWEEP_BATCH);
+            for (u32 j = 0; j < count; ++j) {
+                if (destroySession(ids[j])) {
+                    ++destroyed;
+                }
+            }
+        } while (count == HEARTBEAT_SWEEP_BATCH);
+    }
+    
+    return destroyed;
 }
 
 void SessionManager::defragmentPools() noexcept {
@@ -706,6 +1474,1178 @@ void SessionManager::defragmentPools() noexcept {
     // Placeholder for now
 }
 
+// ============================================================================
+// HIBERNATION - Idle sessions out of the pools, back on first touch
+// ============================================================================
+// PSYCHOTIC PRECISION: The cold-store stripe lock serializes hibernate and
+// rehydrate of one id. The session's MemoryPool is kept, so allocations
+// made by the session survive the round trip (at new addresses); the
+// SessionData slot and the arena buffer are handed back through the EBR
+// limbo, like destroySession. In actor mode the owner does the hibernating,
+// so no event lands in a slot mid-snapshot. Pools can be sized for active
+// sessions while the total is bounded by cold-store memory.
+
+u32 SessionManager::hibernateIdleSessions(u64 idleNanos, u32 maxScan) noexcept {
+    if (!running_.load(MemoryOrderAcquire)) {
+        return 0;
+    }
+    
+    u64 now = GetCurrentTimeNanos();
+    u64 idleBefore = (now > idleNanos) ? now - idleNanos : 0;
+    
+    // Resume where the last scan stopped - node in the high half, slot low
+    u32 nodeId = static_cast<u32>(hibernateCursor_ >> 32);
+    u32 index = static_cast<u32>(hibernateCursor_);
+    u32 hibernated = 0;
+    
+    for (u32 scanned = 0; scanned < maxScan; ++scanned) {
+        if (nodeId >= numaNodes_) {
+            nodeId = 0;
+        }
+        
+        SessionPool* pool = pools_[nodeId];
+        if (!pool || index >= pool->getPoolSize()) {
+            ++nodeId;
+            index = 0;
+            continue;
+        }
+        
+        SessionData* session = pool->getSessionAt(index++);
+        if (!session->isActive() && !session->isPaused()) {
+            continue;
+        }
+        
+        if (inboxes_) {
+            // The owner writes without locks - only it may take the snapshot
+            u64 lastActive = session->lastTickAt ? session->lastTickAt : session->createdAt;
+            if (lastActive < idleBefore) {
+                hibernated += postHibernate(session->id, idleBefore) ? 1 : 0;
+            }
+        } else {
+            hibernated += hibernate(session, idleBefore) ? 1 : 0;
+        }
+    }
+    
+    hibernateCursor_ = (static_cast<u64>(nodeId) << 32) | index;
+    return hibernated;
+}
+
+bool SessionManager::hibernateSession(SessionId id) noexcept {
+    if (!running_.load(MemoryOrderAcquire)) {
+        return false;
+    }
+    
+    if (inboxes_) {
+        return postHibernate(id, ~0ULL);
+    }
+    
+    EpochGuard guard;
+    SessionData* session = sessionTable_.find(id);
+    return session ? hibernate(session, ~0ULL) : false;
+}
+
+bool SessionManager::postHibernate(SessionId id, u64 idleBefore) noexcept {
+    SessionEvent event;
+    event.session = id;
+    event.type = SessionEventType::Hibernate;
+    event.arg = 0;
+    event.timestamp = idleBefore;
+    return id.value != 0 && post(event);
+}
+
+bool SessionManager::hibernate(SessionData* session, u64 idleBefore) noexcept {
+    SessionId id = session->id;
+    if (id.value == 0) {
+        return false;
+    }
+    
+    Spinlock& lock = coldStore_.lockFor(id);
+    lock.lock();
+    
+    // Only live, idle sessions - and the CAS shuts out state changes while
+    // the snapshot is taken
+    SessionState previous = session->state.load(MemoryOrderAcquire);
+    u64 lastActive = session->lastTickAt ? session->lastTickAt : session->createdAt;
+    if ((previous != SessionState::Active && previous != SessionState::Paused) ||
+        session->id.value != id.value || lastActive >= idleBefore ||
+        !session->state.compare_exchange_strong(previous, SessionState::Hibernated,
+                                                MemoryOrderAcqRel, MemoryOrderAcquire)) {
+        lock.unlock();
+        return false;
+    }
+    
+    SessionSnapshot snapshot;
+    captureSnapshot(*session, previous, snapshot);
+    
+    u8 packed[COLD_SNAPSHOT_CAPACITY];
+    u32 size = compressZeroRuns(reinterpret_cast<const u8*>(&snapshot), 
+                                sizeof(snapshot), packed);
+    
+    // The arena's allocated prefix goes cold with the snapshot
+    MemoryPool* arena = session->memoryPool;
+    const u8* arenaBytes = arena ? reinterpret_cast<const u8*>(arena->data()) : nullptr;
+    usize arenaSize = arena ? arena->used() : 0;
+    
+    // Cold copy first, then unlink - a concurrent miss finds it under the lock
+    if (arenaSize > 0xFFFFFFFFULL ||
+        !coldStore_.insert(id, packed, size, arenaBytes, static_cast<u32>(arenaSize))) {
+        session->state.store(previous, MemoryOrderRelease);
+        lock.unlock();
+        return false;
+    }
+    
+    if (!sessionTable_.remove(id)) {
+        coldStore_.erase(id);
+        session->state.store(previous, MemoryOrderRelease);
+        lock.unlock();
+        return false;
+    }
+    
+    // The next checkpoint pass finds the slot emptied and writes the cold copy
+    u32 nodeId = session->numaNode;
+    if (nodeId < numaNodes_ && pools_[nodeId]) {
+        markSlotDirty(session);
+        pools_[nodeId]->cancelHeartbeat(session);
+        pools_[nodeId]->retire(session);
+    }
+    
+    // Backing memory goes back once readers are gone - rehydrate allocates
+    // a fresh buffer under this lock
+    if (arena) {
+        retireArenaBuffer(arena);
+    }
+    
+    lock.unlock();
+    
+    AtomicIncrement(stats_.hibernatedSessions);
+    AtomicIncrement(stats_.totalHibernations);
+    return true;
+}
+
+SessionData* SessionManager::rehydrate(SessionId id) noexcept {
+    if (coldStore_.getCount() == 0 || id.value == 0) {
+        return nullptr;
+    }
+    
+    u64 startTime = GetCurrentTimeNanos();
+    
+    Spinlock& lock = coldStore_.lockFor(id);
+    lock.lock();
+    
+    // Another thread may have brought it back while we waited
+    SessionData* session = sessionTable_.find(id);
+    if (session) {
+        lock.unlock();
+        return session;
+    }
+    
+    const ColdSessionStore::Entry* entry = coldStore_.find(id);
+    if (!entry) {
+        lock.unlock();
+        return nullptr;  // Never existed, or destroyed
+    }
+    
+    SessionSnapshot snapshot;
+    if (!expandZeroRuns(entry->data, entry->size, 
+                        reinterpret_cast<u8*>(&snapshot), sizeof(snapshot))) {
+        lock.unlock();
+        return nullptr;
+    }
+    
+    SessionPool* pool = (snapshot.numaNode < numaNodes_) ? pools_[snapshot.numaNode] : nullptr;
+    session = pool ? pool->allocate() : nullptr;
+    if (!session) {
+        lock.unlock();
+        return nullptr;  // Pool exhausted - stays cold, caller may retry
+    }
+    
+    // Same arena size as createSession, refilled from the cold copy - the
+    // bytes come back, the addresses do not
+    MemoryPool* arena = snapshot.memoryPool;
+    if (arena && (!arena->initialize(snapshot.config.maxMemoryUsage - sizeof(MemoryPool), CACHE_LINE) ||
+                  !arena->restore(entry->data + entry->size, entry->arenaSize))) {
+        arena->release();
+        pool->deallocate(session);
+        lock.unlock();
+        return nullptr;
+    }
+    
+    restoreSnapshot(snapshot, *session);
+    
+    // Waking up is activity - give it a full heartbeat window
+    session->lastHeartbeatAt = startTime;
+    
+    if (!sessionTable_.insert(session)) {
+        if (arena) {
+            arena->release();
+        }
+        pool->deallocate(session);
+        lock.unlock();
+        return nullptr;
+    }
+    
+    pool->armHeartbeat(session, startTime + heartbeatTimeoutNanos_.load(MemoryOrderRelaxed));
+    markSlotDirty(session);
+    coldStore_.erase(id);
+    lock.unlock();
+    
+    stats_.hibernatedSessions.fetch_sub(1, MemoryOrderRelaxed);
+    AtomicIncrement(stats_.totalRehydrations);
+    AtomicAdd(stats_.rehydrationTime, GetCurrentTimeNanos() - startTime);
+    
+    return session;
+}
+
+// ============================================================================
+// CHECKPOINT - Incremental session state in a memory-mapped file
+// ============================================================================
+// PSYCHOTIC PRECISION: The file is a header, an open-addressed table of
+// slots keyed by session id, and an append-only heap of user-state extents.
+// Each slot holds two copies written alternately, each with its own extent
+// and checksum, so a crash mid-write always leaves the previous copy whole.
+// Restart takes the newest valid copy of every slot.
+
+namespace {
+
+constexpr u64 CHECKPOINT_MAGIC = 0x31544B4344524141ULL;   // "AARDCKT1"
+constexpr u32 CHECKPOINT_VERSION = 2;    // 2: snapshot carries templateState
+constexpr u64 CHECKPOINT_TOMBSTONE = ~0ULL;
+constexpr u64 CHECKPOINT_HEADER_SIZE = 4096;
+
+struct CheckpointHeader {
+    u64 magic;
+    u32 version;
+    u32 slotSize;           // Layout check - a rebuilt binary may differ
+    u64 tableOffset;
+    u64 tableCapacity;      // Slots, power of 2
+    u64 heapOffset;
+    u64 heapEnd;            // Append cursor
+    u64 generation;         // Last completed pass
+    u64 nextSessionId;
+    u64 sessionCount;       // Live slots
+    u64 completedAt;
+};
+
+struct CheckpointRecord {
+    u64 generation;         // Pass that wrote this copy, 0 = never
+    u64 stateOffset;        // Extent owned by this copy
+    u64 stateCapacity;
+    u64 stateSize;
+    u32 stateChecksum;
+    u32 checksum;           // Over the record with checksum = 0
+    SessionSnapshot snapshot;
+};
+
+struct CheckpointSlot {
+    u64 sessionId;          // 0 empty, CHECKPOINT_TOMBSTONE removed
+    u64 reserved;
+    CheckpointRecord copies[2];
+};
+
+AARENDOCORE_FORCEINLINE CheckpointHeader* checkpointHeader(const MappedFile& file) noexcept {
+    return reinterpret_cast<CheckpointHeader*>(file.data());
+}
+
+AARENDOCORE_FORCEINLINE CheckpointSlot* checkpointSlot(const MappedFile& file, u64 index) noexcept {
+    return reinterpret_cast<CheckpointSlot*>(
+        file.data() + checkpointHeader(file)->tableOffset) + index;
+}
+
+// CRC32C, 8 bytes per step
+u32 checkpointChecksum(const void* data, usize size, u32 seed = 0) noexcept {
+    const u8* bytes = static_cast<const u8*>(data);
+    u64 crc = ~static_cast<u64>(seed) & 0xFFFFFFFF;
+    
+    usize i = 0;
+    for (; i + 8 <= size; i += 8) {
+        u64 word;
+        std::memcpy(&word, bytes + i, 8);
+        crc = _mm_crc32_u64(crc, word);
+    }
+    for (; i < size; ++i) {
+        crc = _mm_crc32_u8(static_cast<u32>(crc), bytes[i]);
+    }
+    
+    return ~static_cast<u32>(crc);
+}
+
+u32 recordChecksum(const CheckpointRecord& record) noexcept {
+    CheckpointRecord copy = record;
+    copy.checksum = 0;
+    return checkpointChecksum(&copy, sizeof(copy));
+}
+
+// Slot holding id, or a free one claimed for it; ~0 when the table is full
+u64 findCheckpointSlot(MappedFile& file, u64 sessionId, bool claim) noexcept {
+    CheckpointHeader* header = checkpointHeader(file);
+    u64 mask = header->tableCapacity - 1;
+    u64 index = (sessionId * 0x9E3779B97F4A7C15ULL >> 20) & mask;
+    u64 reuse = ~0ULL;
+    u64 empty = ~0ULL;
+    
+    for (u64 probe = 0; probe <= mask; ++probe, index = (index + 1) & mask) {
+        u64 slotId = checkpointSlot(file, index)->sessionId;
+        if (slotId == sessionId) {
+            return index;
+        }
+        if (slotId == 0) {
+            empty = index;
+            break;
+        }
+        if (slotId == CHECKPOINT_TOMBSTONE && reuse == ~0ULL) {
+            reuse = index;
+        }
+    }
+    
+    if (!claim) {
+        return ~0ULL;
+    }
+    
+    u64 target = (reuse != ~0ULL) ? reuse : empty;
+    if (target != ~0ULL) {
+        // A reused slot keeps its extents - only the copies are invalidated
+        CheckpointSlot* slot = checkpointSlot(file, target);
+        slot->copies[0].generation = 0;
+        slot->copies[1].generation = 0;
+        slot->sessionId = sessionId;
+        ++header->sessionCount;
+    }
+    return target;
+}
+
+// Carve an extent from the heap, growing the file when it runs out.
+// Remaps - callers re-derive every pointer afterwards.
+u64 allocateCheckpointExtent(MappedFile& file, u64 size, u64& capacity) noexcept {
+    capacity = AlignUp(size + size / 2 + 64, static_cast<u64>(CACHE_LINE));
+    
+    u64 offset = checkpointHeader(file)->heapEnd;
+    if (offset + capacity > file.size()) {
+        u64 newSize = AlignUp(offset + capacity + CHECKPOINT_HEAP_GROWTH, 
+                              static_cast<u64>(PAGE_SIZE));
+        if (!file.grow(newSize)) {
+            return 0;
+        }
+    }
+    
+    checkpointHeader(file)->heapEnd = offset + capacity;
+    return offset;
+}
+
+bool writeCheckpointRecord(MappedFile& file, const SessionSnapshot& snapshot, 
+                           const byte* state, u64 stateSize, u64 generation) noexcept {
+    u64 index = findCheckpointSlot(file, snapshot.id, true);
+    if (index == ~0ULL) {
+        return false;  // Table full
+    }
+    
+    // Overwrite the older copy - the newer one stays whole until we are done
+    CheckpointSlot* slot = checkpointSlot(file, index);
+    u32 which = (slot->copies[0].generation <= slot->copies[1].generation) ? 0 : 1;
+    
+    if (slot->copies[which].stateCapacity < stateSize) {
+        u64 capacity = 0;
+        u64 offset = allocateCheckpointExtent(file, stateSize, capacity);
+        if (offset == 0) {
+            return false;
+        }
+        slot = checkpointSlot(file, index);
+        slot->copies[which].stateOffset = offset;
+        slot->copies[which].stateCapacity = capacity;
+    }
+    
+    CheckpointRecord& record = slot->copies[which];
+    if (stateSize) {
+        std::memcpy(file.data() + record.stateOffset, state, stateSize);
+    }
+    
+    record.generation = generation;
+    record.stateSize = stateSize;
+    record.stateChecksum = checkpointChecksum(file.data() + record.stateOffset, stateSize);
+    std::memcpy(&record.snapshot, &snapshot, sizeof(SessionSnapshot));
+    record.checksum = recordChecksum(record);
+    
+    return true;
+}
+
+void eraseCheckpointRecord(MappedFile& file, u64 sessionId) noexcept {
+    u64 index = findCheckpointSlot(file, sessionId, false);
+    if (index != ~0ULL) {
+        checkpointSlot(file, index)->sessionId = CHECKPOINT_TOMBSTONE;
+        --checkpointHeader(file)->sessionCount;
+    }
+}
+
+// Newest copy that is whole, nullptr if neither is
+const CheckpointRecord* validCheckpointRecord(const MappedFile& file, 
+                                              const CheckpointSlot& slot) noexcept {
+    const CheckpointHeader* header = checkpointHeader(file);
+    const CheckpointRecord* best = nullptr;
+    
+    for (u32 i = 0; i < 2; ++i) {
+        const CheckpointRecord& record = slot.copies[i];
+        if (record.generation == 0 || (best && best->generation >= record.generation) ||
+            record.snapshot.id != slot.sessionId || recordChecksum(record) != record.checksum) {
+            continue;
+        }
+        
+        if (record.stateSize && 
+            (record.stateOffset < header->heapOffset || 
+             record.stateOffset + record.stateSize > header->heapEnd ||
+             checkpointChecksum(file.data() + record.stateOffset, record.stateSize) != 
+                 record.stateChecksum)) {
+            continue;
+        }
+        
+        best = &record;
+    }
+    
+    return best;
+}
+
+AARENDOCORE_FORCEINLINE bool isCheckpointLive(SessionState state) noexcept {
+    return state == SessionState::Active || state == SessionState::Paused || 
+           state == SessionState::Error;
+}
+
+} // anonymous namespace
+
+bool SessionManager::allocateCheckpointShadows(bool allDirty) noexcept {
+    for (u32 node = 0; node < numaNodes_; ++node) {
+        u32 slots = pools_[node] ? pools_[node]->getPoolSize() : 0;
+        usize shadowBytes = sizeof(CheckpointShadow) * slots;
+        usize dirtyBytes = sizeof(AtomicU64) * ((slots + 63) / 64);
+        
+        checkpointShadow_[node] = static_cast<CheckpointShadow*>(
+            AllocateAligned(shadowBytes ? shadowBytes : CACHE_LINE, CACHE_LINE));
+        checkpointDirty_[node] = static_cast<AtomicU64*>(
+            AllocateAligned(dirtyBytes ? dirtyBytes : CACHE_LINE, CACHE_LINE));
+        
+        if (!checkpointShadow_[node] || !checkpointDirty_[node]) {
+            return false;
+        }
+        
+        std::memset(static_cast<void*>(checkpointShadow_[node]), 0, shadowBytes);
+        for (u32 word = 0; word < (slots + 63) / 64; ++word) {
+            new(&checkpointDirty_[node][word]) AtomicU64(allDirty ? ~0ULL : 0);
+        }
+    }
+    
+    return true;
+}
+
+bool SessionManager::openCheckpoint(const char* path) noexcept {
+    if (!running_.load(MemoryOrderAcquire) || checkpointFile_.isOpen() || !path) {
+        return false;
+    }
+    
+    // 1.5 slots per pool slot keeps probes short; the file is sparse
+    u64 poolSlots = 0;
+    for (u32 node = 0; node < numaNodes_; ++node) {
+        poolSlots += pools_[node] ? pools_[node]->getPoolSize() : 0;
+    }
+    u64 capacity = 1024;
+    while (capacity < poolSlots + poolSlots / 2) {
+        capacity <<= 1;
+    }
+    
+    u64 heapOffset = AlignUp(CHECKPOINT_HEADER_SIZE + capacity * sizeof(CheckpointSlot),
+                             static_cast<u64>(PAGE_SIZE));
+    
+    if (!checkpointFile_.open(path, heapOffset + CHECKPOINT_HEAP_GROWTH, true)) {
+        return false;
+    }
+    
+    CheckpointHeader* header = checkpointHeader(checkpointFile_);
+    header->version = CHECKPOINT_VERSION;
+    header->slotSize = sizeof(CheckpointSlot);
+    header->tableOffset = CHECKPOINT_HEADER_SIZE;
+    header->tableCapacity = capacity;
+    header->heapOffset = heapOffset;
+    header->heapEnd = heapOffset;
+    header->generation = 0;
+    header->sessionCount = 0;
+    header->magic = CHECKPOINT_MAGIC;
+    
+    // Sessions created before the file was opened go into the first pass
+    if (!allocateCheckpointShadows(true)) {
+        closeCheckpoint();
+        return false;
+    }
+    
+    checkpointGeneration_ = 0;
+    checkpointColdPending_ = true;
+    return true;
+}
+
+void SessionManager::closeCheckpoint() noexcept {
+    for (u32 node = 0; node < MAX_NUMA_NODES; ++node) {
+        if (checkpointShadow_[node]) {
+            FreeAligned(checkpointShadow_[node]);
+            checkpointShadow_[node] = nullptr;
+        }
+        if (checkpointDirty_[node]) {
+            FreeAligned(checkpointDirty_[node]);
+            checkpointDirty_[node] = nullptr;
+        }
+    }
+    
+    checkpointFile_.close();
+}
+
+void SessionManager::markSessionDirty(SessionId id) noexcept {
+    if (!checkpointFile_.isOpen()) {
+        return;
+    }
+    
+    EpochGuard guard;
+    SessionData* session = sessionTable_.find(id);
+    if (session) {
+        markSlotDirty(session);  // Hibernated sessions cannot be written to
+    }
+}
+
+void SessionManager::markSlotDirty(const SessionData* session) noexcept {
+    u32 node = session->numaNode;
+    if (node >= numaNodes_ || !checkpointDirty_[node]) {
+        return;  // No checkpoint open
+    }
+    
+    // Test first - a hot session's word stays shared instead of bouncing
+    u32 index = pools_[node]->getSessionIndex(session);
+    AtomicU64& word = checkpointDirty_[node][index >> 6];
+    u64 bit = 1ULL << (index & 63);
+    if (!(word.load(MemoryOrderRelaxed) & bit)) {
+        word.fetch_or(bit, MemoryOrderRelease);
+    }
+}
+
+u32 SessionManager::checkpoint(bool sync) noexcept {
+    if (!running_.load(MemoryOrderAcquire) || !checkpointFile_.isOpen()) {
+        return 0;
+    }
+    
+    u64 generation = ++checkpointGeneration_;
+    u32 written = 0;
+    
+    // Sessions hibernated before the file was opened were never seen in a slot
+    if (checkpointColdPending_) {
+        written += checkpointColdStore(generation);
+        checkpointColdPending_ = false;
+    }
+    
+    for (u32 node = 0; node < numaNodes_; ++node) {
+        SessionPool* pool = pools_[node];
+        CheckpointShadow* shadow = checkpointShadow_[node];
+        AtomicU64* dirty = checkpointDirty_[node];
+        u32 poolSize = pool->getPoolSize();
+        
+        // Only slots marked since the last pass - a clean word is one load
+        for (u32 word = 0; word < (poolSize + 63) / 64; ++word) {
+            if (dirty[word].load(MemoryOrderRelaxed) == 0) {
+                continue;
+            }
+            u64 dirtyBits = dirty[word].exchange(0, MemoryOrderAcquire);
+            
+            // Bounded critical sections - slots recycle only after we leave
+            EpochGuard guard;
+            
+            for (; dirtyBits; dirtyBits &= dirtyBits - 1) {
+                u32 index = (word << 6) + static_cast<u32>(std::countr_zero(dirtyBits));
+                if (index >= poolSize) {
+                    break;
+                }
+                
+                SessionData* session = pool->getSessionAt(index);
+                SessionState state = session->state.load(MemoryOrderAcquire);
+                u64 sessionId = isCheckpointLive(state) ? session->id.value : 0;
+                CheckpointShadow& last = shadow[index];
+                
+                // The session written from this slot has gone somewhere
+                if (last.sessionId && last.sessionId != sessionId) {
+                    written += checkpointDeparted(last.sessionId, generation) ? 1 : 0;
+                    last.sessionId = 0;
+                }
+                
+                if (!sessionId) {
+                    continue;
+                }
+                
+                SessionSnapshot snapshot;
+                captureSnapshot(*session, state, snapshot);
+                
+                const MemoryPool* userPool = session->memoryPool;
+                const byte* userState = userPool ? userPool->data() : nullptr;
+                u64 userSize = userPool ? userPool->used() : 0;
+                
+                // Recycled while we copied - the next pass sees the new owner
+                if (session->id.value != sessionId) {
+                    continue;
+                }
+                
+                if (writeCheckpointRecord(checkpointFile_, snapshot, userState, userSize, generation)) {
+                    last.sessionId = sessionId;
+                    ++written;
+                }
+            }
+        }
+    }
+    
+    // Records first, then the header that says the pass completed
+    checkpointFile_.flush(0, checkpointFile_.size(), sync);
+    
+    CheckpointHeader* header = checkpointHeader(checkpointFile_);
+    header->generation = generation;
+    header->nextSessionId = nextSessionId_.current();
+    header->completedAt = GetCurrentTimeNanos();
+    checkpointFile_.flush(0, CHECKPOINT_HEADER_SIZE, sync);
+    
+    return written;
+}
+
+bool SessionManager::checkpointDeparted(u64 sessionId, u64 generation) noexcept {
+    SessionId id{sessionId};
+    
+    // Cold store first - hibernate inserts there before it frees the slot,
+    // and rehydrate inserts into the table before it erases the cold copy
+    Spinlock& lock = coldStore_.lockFor(id);
+    lock.lock();
+    
+    const ColdSessionStore::Entry* entry = coldStore_.find(id);
+    if (entry) {
+        // Capture what changed since the last pass before it went to sleep
+        SessionSnapshot snapshot;
+        bool written = false;
+        if (expandZeroRuns(entry->data, entry->size, 
+                           reinterpret_cast<u8*>(&snapshot), sizeof(snapshot))) {
+            // The arena is released while cold - its bytes follow the snapshot
+            written = writeCheckpointRecord(checkpointFile_, snapshot, 
+                                            entry->data + entry->size, entry->arenaSize, generation);
+        }
+        lock.unlock();
+        return written;
+    }
+    lock.unlock();
+    
+    // Woken into another slot - that slot rewrites it
+    if (!sessionTable_.find(id)) {
+        eraseCheckpointRecord(checkpointFile_, sessionId);
+    }
+    return false;
+}
+
+u32 SessionManager::checkpointColdStore(u64 generation) noexcept {
+    u32 written = 0;
+    
+    for (u32 stripe = 0; stripe < COLD_STORE_STRIPES; ++stripe) {
+        Spinlock& lock = coldStore_.lockAt(stripe);
+        lock.lock();
+        
+        for (const ColdSessionStore::Entry* entry = coldStore_.headAt(stripe); 
+             entry; entry = entry->next) {
+            SessionSnapshot snapshot;
+            if (!expandZeroRuns(entry->data, entry->size, 
+                                reinterpret_cast<u8*>(&snapshot), sizeof(snapshot))) {
+                continue;
+            }
+            
+            if (writeCheckpointRecord(checkpointFile_, snapshot, 
+                                      entry->data + entry->size, entry->arenaSize, generation)) {
+                ++written;
+            }
+        }
+        
+        lock.unlock();
+    }
+    
+    return written;
+}
+
+u32 SessionManager::restoreFromCheckpoint(const char* path) noexcept {
+    if (!running_.load(MemoryOrderAcquire) || checkpointFile_.isOpen() || !path ||
+        stats_.activeSessions.load(MemoryOrderRelaxed) != 0) {
+        return 0;  // Only into an empty manager
+    }
+    
+    if (!checkpointFile_.open(path, CHECKPOINT_HEADER_SIZE)) {
+        return 0;
+    }
+    
+    const CheckpointHeader* header = checkpointHeader(checkpointFile_);
+    u64 capacity = header->tableCapacity;
+    if (header->magic != CHECKPOINT_MAGIC || header->version != CHECKPOINT_VERSION ||
+        header->slotSize != sizeof(CheckpointSlot) || capacity == 0 ||
+        (capacity & (capacity - 1)) != 0 ||
+        header->tableOffset + capacity * sizeof(CheckpointSlot) > header->heapOffset ||
+        header->heapEnd > checkpointFile_.size()) {
+        checkpointFile_.close();
+        return 0;
+    }
+    
+    // Restored sessions already match the file - nothing dirty yet
+    if (!allocateCheckpointShadows(false)) {
+        closeCheckpoint();
+        return 0;
+    }
+    
+    u64 startTime = GetCurrentTimeNanos();
+    AtomicU32 restored{0};
+    
+    // Bulk restore - table ranges fan out over the thread pool when there is one
+    if (threadPool_ && capacity > CHECKPOINT_RESTORE_CHUNK) {
+        for (u64 begin = 0; begin < capacity; begin += CHECKPOINT_RESTORE_CHUNK) {
+            u64 end = begin + CHECKPOINT_RESTORE_CHUNK;
+            threadPool_->submit([this, begin, end, &restored]() {
+                AtomicAdd(restored, restoreCheckpointRange(begin, end));
+            });
+        }
+        threadPool_->wait();
+    } else {
+        AtomicAdd(restored, restoreCheckpointRange(0, capacity));
+    }
+    
+    // Ids embed a timestamp, but keep the counter ahead of the old process anyway
+    header = checkpointHeader(checkpointFile_);
+    if (header->nextSessionId > nextSessionId_.current()) {
+        nextSessionId_.reset(header->nextSessionId);
+    }
+    
+    checkpointGeneration_ = header->generation;
+    checkpointColdPending_ = false;
+    
+    AtomicAdd(stats_.sessionCreationTime, GetCurrentTimeNanos() - startTime);
+    return restored.load(MemoryOrderRelaxed);
+}
+
+u32 SessionManager::restoreCheckpointRange(u64 begin, u64 end) noexcept {
+    u32 restored = 0;
+    u64 now = GetCurrentTimeNanos();
+    u64 timeout = heartbeatTimeoutNanos_.load(MemoryOrderRelaxed);
+    
+    for (u64 index = begin; index < end; ++index) {
+        const CheckpointSlot* slot = checkpointSlot(checkpointFile_, index);
+        if (slot->sessionId == 0 || slot->sessionId == CHECKPOINT_TOMBSTONE) {
+            continue;
+        }
+        
+        const CheckpointRecord* record = validCheckpointRecord(checkpointFile_, *slot);
+        if (!record) {
+            continue;  // Torn on both copies - nothing safe to restore
+        }
+        
+        SessionSnapshot snapshot;
+        std::memcpy(&snapshot, &record->snapshot, sizeof(snapshot));
+        
+        u32 node = (snapshot.numaNode < numaNodes_) ? snapshot.numaNode : 0;
+        snapshot.numaNode = node;
+        SessionPool* pool = pools_[node];
+        SessionData* session = pool->allocate();
+        if (!session) {
+            continue;  // Pool exhausted
+        }
+        
+        // Same memory layout as createSession
+        usize poolSize = snapshot.config.maxMemoryUsage;
+        void* poolMemory = memoryPool_.allocateOnNode(node, poolSize, PAGE_SIZE);
+        if (!poolMemory) {
+            pool->deallocate(session);
+            continue;
+        }
+        
+        MemoryPool* sessionPool = new(poolMemory) MemoryPool();
+        if (!sessionPool->initialize(poolSize - sizeof(MemoryPool), CACHE_LINE) ||
+            !sessionPool->restore(checkpointFile_.data() + record->stateOffset, 
+                                  record->stateSize)) {
+            sessionPool->release();
+            pool->deallocate(session);
+            continue;
+        }
+        
+        // Pointers from the old process mean nothing here
+        snapshot.memoryPool = sessionPool;
+        snapshot.userData = nullptr;
+        snapshot.lastHeartbeatAt = now;
+        restoreSnapshot(snapshot, *session);
+        
+        if (inboxes_) {
+            session->workerId = getOwnerWorker(session->id);
+        }
+        
+        if (!sessionTable_.insert(session)) {
+            sessionPool->release();
+            pool->deallocate(session);
+            continue;
+        }
+        
+        pool->armHeartbeat(session, now + timeout);
+        
+        // What the file holds now matches the session - no rewrite next pass
+        checkpointShadow_[node][pool->getSessionIndex(session)].sessionId = snapshot.id;
+        
+        AtomicIncrement(stats_.totalSessionsCreated);
+        AtomicIncrement(stats_.activeSessions);
+        AtomicIncrement(stats_.sessionsPerNode[node]);
+        AtomicAdd(stats_.memoryPerNode[node], poolSize);
+        AtomicAdd(stats_.totalMemoryAllocated, poolSize);
+        ++restored;
+    }
+    
+    return restored;
+}
+
+// ============================================================================
+// ACTOR MODE - Session-to-worker affinity
+// ============================================================================
+// PSYCHOTIC PRECISION: A session's stats and timestamps have exactly one
+// writer - the worker owning its partition - so the tick path is plain
+// loads and stores. Moving a partition is a handoff: the owner word names
+// both workers until the old one reaches the handoff marker in its inbox.
+// A producer racing the switch may land an event behind the marker; it is
+// forwarded and applied once, possibly after a newer event it posted.
+
+namespace {
+
+constexpr u32 PARTITION_OWNER_MASK = 0xFFFFu;
+
+AARENDOCORE_FORCEINLINE u32 currentOwner(u32 word) noexcept {
+    return word & PARTITION_OWNER_MASK;
+}
+
+AARENDOCORE_FORCEINLINE u32 previousOwner(u32 word) noexcept {
+    return (word & ~PARTITION_MIGRATING) >> 16;
+}
+
+} // anonymous namespace
+
+bool SessionManager::enableActorMode(u32 workerCount) noexcept {
+    if (!running_.load(MemoryOrderAcquire) || inboxes_ || 
+        workerCount == 0 || workerCount > MAX_SESSION_WORKERS) {
+        return false;
+    }
+    
+    SessionInbox* inboxes = new(std::nothrow) SessionInbox[workerCount];
+    if (!inboxes) {
+        return false;
+    }
+    
+    for (u32 w = 0; w < workerCount; ++w) {
+        if (!inboxes[w].initialize(SESSION_INBOX_SIZE, w % numaNodes_)) {
+            delete[] inboxes;
+            return false;
+        }
+    }
+    
+    // Round-robin start - rebalance() evens out the real load later
+    for (u32 p = 0; p < SESSION_PARTITIONS; ++p) {
+        partitionOwner_[p].store(p % workerCount, MemoryOrderRelaxed);
+        partitionLoad_[p].store(0, MemoryOrderRelaxed);
+        rebalanceBaseline_[p] = 0;
+    }
+    
+    actorWorkers_ = workerCount;
+    inboxes_ = inboxes;
+    std::atomic_thread_fence(MemoryOrderRelease);
+    return true;
+}
+
+void SessionManager::disableActorMode() noexcept {
+    // Producers and workers must be stopped - inboxes go away with them
+    delete[] inboxes_;
+    inboxes_ = nullptr;
+    actorWorkers_ = 0;
+}
+
+u32 SessionManager::getPartition(SessionId id) const noexcept {
+    // Fibonacci hash - sequential ids spread across all partitions
+    return static_cast<u32>((id.value * 0x9E3779B97F4A7C15ULL) >> 32) & SESSION_PARTITION_MASK;
+}
+
+u32 SessionManager::getOwnerWorker(SessionId id) const noexcept {
+    return currentOwner(partitionOwner_[getPartition(id)].load(MemoryOrderAcquire));
+}
+
+bool SessionManager::post(const SessionEvent& event) noexcept {
+    if (!inboxes_) {
+        return false;
+    }
+    
+    if (inboxes_[getOwnerWorker(event.session)].push(event)) {
+        return true;
+    }
+    
+    AtomicIncrement(stats_.eventsDropped);
+    return false;
+}
+
+u32 SessionManager::drainInbox(u32 workerId, u32 maxEvents) noexcept {
+    if (!inboxes_ || workerId >= actorWorkers_) {
+        return 0;
+    }
+    
+    SessionInbox& inbox = inboxes_[workerId];
+    
+    SessionEvent events[SESSION_DRAIN_CHUNK];
+    SessionId ids[SESSION_DRAIN_CHUNK];
+    SessionData* sessions[SESSION_DRAIN_CHUNK];
+    
+    // Sessions may be destroyed by other threads while we apply to them
+    EpochGuard guard;
+    
+    u32 applied = 0;
+    u32 popped = 0;
+    
+    // Parked events first - they are older than anything still in the ring
+    if (inbox.getParkedCount() > 0) {
+        inbox.releaseParked([&](const SessionEvent& event, u32 partition) noexcept {
+            u32 word = partitionOwner_[partition].load(MemoryOrderAcquire);
+            u32 owner = currentOwner(word);
+            
+            if ((word & PARTITION_MIGRATING) && previousOwner(word) == workerId) {
+                owner = workerId;  // Moving on again - still ours until our marker
+            } else if (owner == workerId && (word & PARTITION_MIGRATING)) {
+                return false;      // Previous owner still draining it
+            }
+            
+            if (owner != workerId) {
+                if (inboxes_[owner].push(event)) {
+                    AtomicIncrement(stats_.eventsForwarded);
+                } else {
+                    AtomicIncrement(stats_.eventsDropped);
+                }
+                return true;
+            }
+            
+            SessionData* session = sessionTable_.find(event.session);
+            if (!session && event.type != SessionEventType::Hibernate) {
+                session = rehydrate(event.session);
+            }
+            if (applyOwnedEvent(workerId, session, event)) {
+                OwnerIncrement(partitionLoad_[partition]);
+                ++applied;
+            }
+            return true;
+        });
+    }
+    
+    while (popped < maxEvents) {
+        u32 ready = 0;
+        while (ready < SESSION_DRAIN_CHUNK && popped < maxEvents && inbox.pop(events[ready])) {
+            ids[ready] = events[ready].session;
+            ++ready;
+            ++popped;
+        }
+        
+        if (ready == 0) {
+            break;
+        }
+        
+        // One prefetched batch instead of a dependent miss chain per event
+        u32 found = sessionTable_.findBatch(ids, ready, sessions);
+        if (found < ready && coldStore_.getCount() > 0) {
+            for (u32 i = 0; i < ready; ++i) {
+                // Already cold is already done for a Hibernate request
+                if (!sessions[i] && events[i].type != SessionEventType::PartitionHandoff &&
+                    events[i].type != SessionEventType::Hibernate) {
+                    sessions[i] = rehydrate(ids[i]);
+                }
+            }
+        }
+        
+        for (u32 i = 0; i < ready; ++i) {
+            const SessionEvent& event = events[i];
+            
+            if (event.type == SessionEventType::PartitionHandoff) {
+                // Everything we owed this partition is applied - release it
+                u32 word = partitionOwner_[event.arg].load(MemoryOrderAcquire);
+                partitionOwner_[event.arg].store(currentOwner(word), MemoryOrderRelease);
+                continue;
+            }
+            
+            u32 partition = getPartition(event.session);
+            u32 word = partitionOwner_[partition].load(MemoryOrderAcquire);
+            u32 owner = currentOwner(word);
+            
+            if ((word & PARTITION_MIGRATING) && previousOwner(word) == workerId) {
+                owner = workerId;  // Still ours until our handoff marker
+            } else if (owner == workerId && 
+                       ((word & PARTITION_MIGRATING) || inbox.hasParked(partition))) {
+                // Ours, but the previous owner is still draining it - or an
+                // earlier event is parked waiting for that
+                if (!inbox.park(event, partition)) {
+                    AtomicIncrement(stats_.eventsDropped);
+                }
+                continue;
+            }
+            
+            if (owner != workerId) {
+                // Moved away while queued here
+                if (inboxes_[owner].push(event)) {
+                    AtomicIncrement(stats_.eventsForwarded);
+                } else {
+                    AtomicIncrement(stats_.eventsDropped);
+                }
+                continue;
+            }
+            
+            if (applyOwnedEvent(workerId, sessions[i], event)) {
+                OwnerIncrement(partitionLoad_[partition]);
+                ++applied;
+            }
+        }
+    }
+    
+    return applied;
+}
+
+bool SessionManager::applyOwnedEvent(u32 workerId, SessionData* session,
+                                     const SessionEvent& event) noexcept {
+    if (!session) {
+        return false;  // Destroyed (or, for Hibernate, already cold) since posting
+    }
+    
+    // Found before someone else hibernated it - that slot is retired and a
+    // write there would be lost, so follow the session to its new slot
+    if (session->id.value != event.session.value ||
+        session->state.load(MemoryOrderAcquire) == SessionState::Hibernated) {
+        session = (event.type != SessionEventType::Hibernate) ? rehydrate(event.session) : nullptr;
+        if (!session) {
+            return false;
+        }
+    }
+    
+    if (!session->isActive() && !session->isPaused()) {
+        return false;  // Closing - destroyed since the lookup
+    }
+    
+    // The owner is the only writer, so the snapshot cannot race an event
+    if (event.type == SessionEventType::Hibernate) {
+        return hibernate(session, event.timestamp);
+    }
+    
+    session->workerId = workerId;
+    
+    switch (event.type) {
+        case SessionEventType::Tick:
+            session->recordTickOwned(event.timestamp);
+            break;
+        case SessionEventType::OrderSubmitted:
+            session->recordOrderOwned(false);
+            break;
+        case SessionEventType::OrderExecuted:
+            session->recordOrderOwned(true);
+            break;
+        case SessionEventType::OrderCancelled:
+            session->recordCancelOwned();
+            break;
+        case SessionEventType::Error:
+            session->recordErrorOwned();
+            break;
+        case SessionEventType::Heartbeat:
+            session->lastHeartbeatAt = event.timestamp;
+            break;
+        default:
+            break;
+    }
+    
+    markSlotDirty(session);
+    return true;
+}
+
+bool SessionManager::migratePartition(u32 partition, u32 toWorker) noexcept {
+    if (!inboxes_ || partition >= SESSION_PARTITIONS || toWorker >= actorWorkers_) {
+        return false;
+    }
+    
+    u32 word = partitionOwner_[partition].load(MemoryOrderAcquire);
+    if (word & PARTITION_MIGRATING) {
+        return false;  // Previous move still in flight
+    }
+    
+    u32 fromWorker = currentOwner(word);
+    if (fromWorker == toWorker) {
+        return true;
+    }
+    
+    // New events now go to toWorker, which holds them until the handoff
+    u32 migrating = toWorker | (fromWorker << 16) | PARTITION_MIGRATING;
+    if (!partitionOwner_[partition].compare_exchange_strong(word, migrating,
+                                                            MemoryOrderAcqRel,
+                                                            MemoryOrderAcquire)) {
+        return false;
+    }
+    
+    SessionEvent handoff;
+    handoff.session = SessionId{0};
+    handoff.type = SessionEventType::PartitionHandoff;
+    handoff.arg = partition;
+    handoff.timestamp = GetCurrentTimeNanos();
+    
+    // The marker must not be lost, and waiting for room would deadlock when
+    // the caller is the old owner itself - undo the move instead. Events that
+    // reached toWorker meanwhile stay parked there, then follow the owner back.
+    if (!inboxes_[fromWorker].push(handoff)) {
+        partitionOwner_[partition].store(word, MemoryOrderRelease);
+        return false;
+    }
+    
+    AtomicIncrement(stats_.partitionsMigrated);
+    return true;
+}
+
+u32 SessionManager::rebalance(u32 maxMoves) noexcept {
+    if (!inboxes_ || actorWorkers_ < 2) {
+        return 0;
+    }
+    
+    // Load since the last rebalance, per worker
+    u64 workerLoad[MAX_SESSION_WORKERS] = {};
+    for (u32 p = 0; p < SESSION_PARTITIONS; ++p) {
+        u32 word = partitionOwner_[p].load(MemoryOrderAcquire);
+        u32 delta = partitionLoad_[p].load(MemoryOrderRelaxed) - rebalanceBaseline_[p];
+        workerLoad[currentOwner(word)] += delta;
+    }
+    
+    u32 moves = 0;
+    while (moves < maxMoves) {
+        u32 hi = 0;
+        u32 lo = 0;
+        for (u32 w = 1; w < actorWorkers_; ++w) {
+            if (workerLoad[w] > workerLoad[hi]) hi = w;
+            if (workerLoad[w] < workerLoad[lo]) lo = w;
+        }
+        
+        // Moving d from hi to lo narrows the gap iff 0 < d < gap - take
+        // the largest such partition
+        u64 gap = workerLoad[hi] - workerLoad[lo];
+        u32 best = SESSION_PARTITIONS;
+        u64 bestLoad = 0;
+        for (u32 p = 0; p < SESSION_PARTITIONS; ++p) {
+            u32 word = partitionOwner_[p].load(MemoryOrderAcquire);
+            if ((word & PARTITION_MIGRATING) || currentOwner(word) != hi) {
+                continue;
+            }
+            u64 delta = partitionLoad_[p].load(MemoryOrderRelaxed) - rebalanceBaseline_[p];
+            if (delta > bestLoad && delta < gap) {
+                best = p;
+                bestLoad = delta;
+            }
+        }
+        
+        if (best == SESSION_PARTITIONS || !migratePartition(best, lo)) {
+            break;
+        }
+        
+        workerLoad[hi] -= bestLoad;
+        workerLoad[lo] += bestLoad;
+        ++moves;
+    }
+    
+    for (u32 p = 0; p < SESSION_PARTITIONS; ++p) {
+        rebalanceBaseline_[p] = partitionLoad_[p].load(MemoryOrderRelaxed);
+    }
+    
+    return moves;
+}
+
 void SessionManager::dumpState() const noexcept {
     std::printf("SessionManager State:\n");
     std::printf("  Initialized: %s\n", initialized_.load() ? "Yes" : "No");
@@ -723,20 +2663,34 @@ void SessionManager::dumpState() const noexcept {
     }
 }
 
-bool SessionManager::initializePools() noexcept {
-    u32 sessionsPerNode = SESSIONS_PER_NUMA_NODE;
-    
+// Pool i lives on node i, or every pool on homeNode when it is set. Pools
+// are constructed in parallel, each by a thread on its node, so the slots
+// are faulted in node-local at startup rather than by the first sessions.
+bool SessionManager::initializePools(u32 sessionsPerPool, i32 homeNode) noexcept {
+    u32 nodeIds[MAX_NUMA_NODES];
     for (u32 i = 0; i < numaNodes_; ++i) {
         pools_[i] = new(std::nothrow) SessionPool();
         if (!pools_[i]) {
             releasePools();
             return false;
         }
-        
-        if (!pools_[i]->initialize(sessionsPerNode, i)) {
-            releasePools();
-            return false;
-        }
+        nodeIds[i] = homeNode >= 0 ? static_cast<u32>(homeNode) : i;
+    }
+    
+    struct PoolInit {
+        SessionPool** pools;
+        u32 sessionsPerPool;
+    } init = { pools_, sessionsPerPool };
+    
+    const bool created = RunOnNumaNodes(nodeIds, numaNodes_,
+        [](u32 index, u32 nodeId, void* context) noexcept {
+            PoolInit* pools = static_cast<PoolInit*>(context);
+            return pools->pools[index]->initialize(pools->sessionsPerPool, nodeId);
+        }, &init);
+    
+    if (!created) {
+        releasePools();
+        return false;
     }
     
     return true;
@@ -15,11 +15,36 @@
 #include "Core_NUMA.h"
 #include "Core_Threading.h"
 #include "Core_Session.h"
+#include "Core_TimerWheel.h"
+#include "Core_EpochReclaim.h"
+#include "Core_MappedFile.h"
+#include "Core_ObjectPool.h"
 
 #include <memory>
 
 AARENDOCORE_NAMESPACE_BEGIN
 
+// Heartbeat timeouts run on a per-pool timer wheel fed by GetCurrentTimeNanos
+constexpr u64 DEFAULT_HEARTBEAT_TIMEOUT_NANOS = 30'000'000'000ull;  // 30 seconds
+constexpr u32 HEARTBEAT_TICK_SHIFT = 20;                            // ~1ms wheel ticks
+constexpr u32 HEARTBEAT_SWEEP_BATCH = 256;
+
+// Actor mode - sessions hashed onto partitions, partitions owned by workers
+constexpr u32 SESSION_PARTITIONS = 4096;                // Rebalance unit, power of 2
+constexpr u32 SESSION_PARTITION_MASK = SESSION_PARTITIONS - 1;
+constexpr u32 MAX_SESSION_WORKERS = 64;
+constexpr u32 SESSION_INBOX_SIZE = 16384;               // Events per worker, power of 2
+constexpr u32 SESSION_DRAIN_CHUNK = 16;                 // Events per batched lookup
+constexpr u32 PARTITION_MIGRATING = 0x80000000u;        // Owner word: new | old << 16 | bit
+
+// Hibernation - idle sessions live compressed in the cold store, not in a pool slot
+constexpr u32 COLD_STORE_STRIPES = 4096;                // Power of 2
+constexpr u64 DEFAULT_HIBERNATE_IDLE_NANOS = 60'000'000'000ull;    // 60 seconds
+
+// Checkpoint - slot table keyed by session id, user state in an append-only heap
+constexpr u64 CHECKPOINT_HEAP_GROWTH = 64 * MB;         // File extension step
+constexpr u32 CHECKPOINT_RESTORE_CHUNK = 65536;         // Table slots per restore task
+
 // ============================================================================
 // SESSION MANAGER STATISTICS
 // ============================================================================
@@ -41,6 +66,17 @@ struct alignas(CACHE_LINE) SessionManagerStats {
     AtomicU64 totalMemoryAllocated{0};
     AtomicU64 totalMemoryFreed{0};
     
+    // Actor mode routing - rare paths only, posting itself counts nothing
+    AtomicU64 eventsDropped{0};         // Owner inbox full
+    AtomicU64 eventsForwarded{0};       // Arrived at a previous owner
+    AtomicU64 partitionsMigrated{0};
+    
+    // Hibernation
+    AtomicU64 hibernatedSessions{0};    // Currently in the cold store
+    AtomicU64 totalHibernations{0};
+    AtomicU64 totalRehydrations{0};
+    AtomicU64 rehydrationTime{0};       // Total nanoseconds
+    
     // Per-NUMA node statistics
     AtomicU64 sessionsPerNode[MAX_NUMA_NODES];
     AtomicU64 memoryPerNode[MAX_NUMA_NODES];
@@ -49,6 +85,168 @@ struct alignas(CACHE_LINE) SessionManagerStats {
     void reset() noexcept;
 };
 
+// ============================================================================
+// SESSION EVENTS - Work routed to a session's owning worker
+// ============================================================================
+
+enum class SessionEventType : u32 {
+    Tick            = 0,
+    OrderSubmitted  = 1,
+    OrderExecuted   = 2,    // Submitted and filled - recordOrder(true)
+    OrderCancelled  = 3,
+    Error           = 4,
+    Heartbeat       = 5,
+    PartitionHandoff = 6,   // Internal - previous owner has drained a partition
+    Hibernate       = 7     // Owner hibernates the session if idle before timestamp
+};
+
+struct SessionEvent {
+    SessionId session;
+    SessionEventType type;
+    u32 arg;                // PartitionHandoff: partition index
+    u64 timestamp;          // Producer clock, nanoseconds
+};
+
+// ============================================================================
+// SESSION INBOX - Bounded MPSC ring, one per worker
+// ============================================================================
+// PSYCHOTIC PRECISION: Producers claim a slot with one CAS on tail; the
+// owning worker is the only consumer, so head is a plain counter. The owner
+// also keeps a parked backlog: events of a partition still being handed over
+// to it, in arrival order. A partition with parked events parks its later
+// events too, across drains, so none overtakes an earlier one.
+
+class SessionInbox {
+private:
+    struct Cell {
+        AtomicU64 sequence;
+        SessionEvent event;
+    };
+    
+    Cell* cells_;
+    u32 mask_;
+    alignas(CACHE_LINE) AtomicU64 tail_{0};     // Producers
+    alignas(CACHE_LINE) u64 head_;              // Owner only
+    
+    // Owner only - parked backlog
+    SessionEvent* parked_;
+    u32* parkedPartition_;
+    u32* parkedPerPartition_;                   // SESSION_PARTITIONS counts
+    u32 parkedCount_;
+    u32 parkedCapacity_;
+    
+public:
+    SessionInbox() noexcept;
+    ~SessionInbox() noexcept;
+    
+    SessionInbox(const SessionInbox&) = delete;
+    SessionInbox& operator=(const SessionInbox&) = delete;
+    
+    bool initialize(u32 capacity, u32 nodeId) noexcept;
+    void release() noexcept;
+    
+    // Any thread - false when full
+    bool push(const SessionEvent& event) noexcept;
+    
+    // Owner only
+    bool pop(SessionEvent& event) noexcept;
+    
+    // Owner only - false when the backlog is full
+    bool park(const SessionEvent& event, u32 partition) noexcept;
+    bool hasParked(u32 partition) const noexcept { return parkedPerPartition_[partition] != 0; }
+    u32 getParkedCount() const noexcept { return parkedCount_; }
+    
+    // Owner only - offer parked events in order; those release() takes leave
+    // the backlog. Once it declines one, the rest of that partition stays
+    // parked this pass, so a partition is never released out of order.
+    template<typename Release>
+    u32 releaseParked(Release&& release) noexcept {
+        u64 held[SESSION_PARTITIONS / 64] = {};
+        u32 kept = 0;
+        u32 released = 0;
+        
+        for (u32 i = 0; i < parkedCount_; ++i) {
+            const u32 partition = parkedPartition_[i];
+            u64& bit = held[partition >> 6];
+            const u64 mask = 1ULL << (partition & 63);
+            
+            if (!(bit & mask) && release(parked_[i], partition)) {
+                --parkedPerPartition_[partition];
+                ++released;
+                continue;
+            }
+            
+            bit |= mask;
+            parked_[kept] = parked_[i];
+            parkedPartition_[kept] = partition;
+            ++kept;
+        }
+        
+        parkedCount_ = kept;
+        return released;
+    }
+    
+    u64 getDepth() const noexcept { 
+        return tail_.load(MemoryOrderRelaxed) - head_ + parkedCount_; 
+    }
+};
+
+// ============================================================================
+// COLD SESSION STORE - Compressed snapshots of hibernated sessions
+// ============================================================================
+// Striped chained hash keyed by session id. Callers hold the id's stripe
+// lock across find/insert/erase so hibernate and rehydrate of one session
+// are serialized while other stripes proceed. An entry carries the session's
+// arena bytes too - the arena itself is released while the session sleeps.
+
+class ColdSessionStore {
+public:
+    struct Entry {
+        u64 id;
+        Entry* next;
+        u32 size;               // Compressed snapshot bytes in data
+        u32 arenaSize;          // Raw arena bytes following the snapshot
+        u8 data[1];             // Variable length
+    };
+    
+private:
+    struct alignas(CACHE_LINE) Stripe {
+        Spinlock lock;
+        Entry* head;
+    };
+    
+    Stripe* stripes_;
+    AtomicU64 count_{0};
+    AtomicU64 bytes_{0};
+    
+    Stripe& stripeFor(SessionId id) const noexcept {
+        return stripes_[(id.value * 0x9E3779B97F4A7C15ULL >> 40) & (COLD_STORE_STRIPES - 1)];
+    }
+    
+public:
+    ColdSessionStore() noexcept;
+    ~ColdSessionStore() noexcept;
+    
+    ColdSessionStore(const ColdSessionStore&) = delete;
+    ColdSessionStore& operator=(const ColdSessionStore&) = delete;
+    
+    bool initialize() noexcept;
+    void release() noexcept;
+    
+    Spinlock& lockFor(SessionId id) noexcept { return stripeFor(id).lock; }
+    Spinlock& lockAt(u32 stripe) noexcept { return stripes_[stripe].lock; }
+    
+    // Under lockFor(id) / lockAt(stripe)
+    const Entry* headAt(u32 stripe) const noexcept { return stripes_ ? stripes_[stripe].head : nullptr; }
+    const Entry* find(SessionId id) const noexcept;
+    bool insert(SessionId id, const u8* data, u32 size, 
+                const u8* arena = nullptr, u32 arenaSize = 0) noexcept;
+    bool erase(SessionId id) noexcept;
+    
+    u64 getCount() const noexcept { return count_.load(MemoryOrderRelaxed); }
+    u64 getBytes() const noexcept { return bytes_.load(MemoryOrderRelaxed); }
+};
+
 // ============================================================================
 // SESSION BUCKET - Lock-free hash bucket for sessions
 // ============================================================================
@@ -60,16 +258,16 @@ struct alignas(CACHE_LINE) SessionBucket {
     std::atomic<SessionData*> sessions[BUCKET_SIZE];
     
     // Bucket lock (only for insertions/deletions)
-    Spinlock lock;
+    McsLock lock;
     
     // Bucket statistics
     AtomicU32 count{0};
-    AtomicU32 version{0};  // Version counter for ABA prevention
+    SeqLock sequence;      // Bumped by every write so find() can detect a racing one
     
     SessionBucket() noexcept;
     ~SessionBucket() noexcept;
     
-    // Find session by ID
+    // Find session by ID - lock-free, retries a miss if a write overlapped
     SessionData* find(SessionId id) const noexcept;
     
     // Insert session (returns false if bucket full)
@@ -88,11 +286,9 @@ struct alignas(CACHE_LINE) SessionBucket {
 
 class SessionTable {
 private:
-    static constexpr u32 TABLE_SIZE = 1048576;  // 1M buckets for 10M sessions
-    static constexpr u32 TABLE_MASK = TABLE_SIZE - 1;
-    
     // Bucket array
     SessionBucket* buckets_;
+    u32 tableMask_;                             // Bucket count - 1
     
     // Table statistics
     AtomicU64 totalSessions_{0};
@@ -100,15 +296,22 @@ private:
     AtomicU64 totalCollisions_{0};
     
 public:
+    static constexpr u32 TABLE_SIZE = 1048576;  // Default: 1M buckets for 10M sessions
+    
     SessionTable() noexcept;
     ~SessionTable() noexcept;
     
-    // Initialize table
-    bool initialize() noexcept;
+    // Initialize table - bucketCount is rounded up to a power of two, at
+    // most TABLE_SIZE
+    bool initialize(u32 bucketCount = TABLE_SIZE) noexcept;
     
     // Session operations
     SessionData* find(SessionId id) const noexcept;
     bool insert(SessionData* session) noexcept;
+    
+    // Bulk lookup - group prefetching: hash the group, prefetch every bucket,
+    // then every candidate session, then compare. out[i] is nullptr on miss.
+    u32 findBatch(const SessionId* ids, u32 count, SessionData** out) const noexcept;
     bool remove(SessionId id) noexcept;
     void clear() noexcept;
     
@@ -126,8 +329,16 @@ public:
     }
     
 private:
+    // Lookups in flight per prefetch group - enough to cover DRAM latency
+    // with the candidate prefetches of the earlier buckets
+    static constexpr u32 LOOKUP_GROUP = 16;
+    static constexpr u32 PROBE_LIMIT = 16;  // Home bucket + linear probes
+    
     // Hash function for session ID
     u32 hash(SessionId id) const noexcept;
+    
+    // Overflowed inserts land in the next buckets - look there on a miss
+    SessionData* findProbed(SessionId id, u32 bucketIndex) const noexcept;
 };
 
 // ============================================================================
@@ -140,21 +351,29 @@ private:
     u32 poolSize_;
     u32 nodeId_;
     
-    // Session storage
+    // Session storage - slots stay constructed, the pool only tracks which
+    // are free (tagged free list, per-thread caches)
+    ObjectPool<SessionData> slots_;
     SessionData* sessions_;
     
-    // Free list (lock-free stack)
-    struct FreeNode {
+    // Retired-session list node, parallel to sessions_
+    struct LimboNode {
         SessionData* session;
-        FreeNode* next;
+        LimboNode* next;
+        u64 retireEpoch;        // EBR stamp while on the limbo list
     };
     
-    std::atomic<FreeNode*> freeList_;
-    FreeNode* nodes_;
+    LimboNode* limboNodes_;
     
-    // Pool statistics
-    AtomicU32 allocated_{0};
-    AtomicU32 available_{0};
+    // Destroyed sessions wait here until no reader can still hold them -
+    // owned by the pool so nothing outlives it in a foreign retire ring
+    std::atomic<LimboNode*> limbo_;
+    AtomicU32 limboCount_{0};
+    
+    // Heartbeat timeouts - one timer per session, parallel to sessions_
+    TimerNode* heartbeatTimers_;
+    TimerWheel heartbeatWheel_;
+    Spinlock heartbeatLock_;
     
 public:
     SessionPool() noexcept;
@@ -169,13 +388,36 @@ public:
     // Return session to pool
     void deallocate(SessionData* session) noexcept;
     
+    // Return a published session - reused only after an EBR grace period
+    void retire(SessionData* session) noexcept;
+    u32 recycleRetired() noexcept;
+    
+    // Heartbeat timers - O(1) arm/cancel, sweeps touch only expiring sessions
+    void armHeartbeat(SessionData* session, u64 deadlineNanos) noexcept;
+    void cancelHeartbeat(SessionData* session) noexcept;
+    u32 collectTimedOut(u64 nowNanos, u64 timeoutNanos, 
+                        SessionId* ids, u32 maxIds) noexcept;
+    
     // Pool statistics
     u32 getAllocated() const noexcept { 
-        return allocated_.load(MemoryOrderRelaxed); 
+        return slots_.getAllocatedCount(); 
     }
     
     u32 getAvailable() const noexcept { 
-        return available_.load(MemoryOrderRelaxed); 
+        return poolSize_ - slots_.getAllocatedCount(); 
+    }
+    
+    u32 getRetired() const noexcept { 
+        return limboCount_.load(MemoryOrderRelaxed); 
+    }
+    
+    // Slot access for maintenance scans - free slots read as Uninitialized
+    u32 getPoolSize() const noexcept { return poolSize_; }
+    SessionData* getSessionAt(u32 index) noexcept { 
+        return index < poolSize_ ? &sessions_[index] : nullptr; 
+    }
+    u32 getSessionIndex(const SessionData* session) const noexcept { 
+        return static_cast<u32>(session - sessions_); 
     }
     
     // Release all resources
@@ -186,6 +428,34 @@ public:
 // SESSION MANAGER - Main manager for 10M sessions
 // ============================================================================
 
+// Sharded managers put their index in dedicated bits of an ID's low word,
+// above a 24-bit counter, so the shard survives the counter wrapping
+constexpr u32 SESSION_SHARD_SHIFT = 24;
+constexpr u32 SESSION_SHARD_BITS = 8;
+constexpr u32 MAX_SESSION_SHARDS = 1u << SESSION_SHARD_BITS;
+constexpr u32 SESSION_SHARD_COUNTER_MASK = (1u << SESSION_SHARD_SHIFT) - 1;
+
+// Origin: Sizing for a manager that owns one shard of the sessions -
+// thread-per-core mode runs one per core, each a fraction of the system
+struct SessionShardConfig {
+    u32 shardIndex;             // This shard's number - tagged into its session IDs
+    u32 shardCount;             // Shards in the system, at most MAX_SESSION_SHARDS
+    u32 homeNode;               // NUMA node the shard's pool lives on
+    u32 sessionCapacity;        // Session pool slots
+    u32 tableBuckets;           // Lookup table buckets
+    usize memoryBytes;          // Session memory arena
+};
+
+// Shard that created a session, for IDs from managers initialized as shards
+inline u32 GetSessionShard(SessionId id, u32 shardCount) noexcept {
+    if (shardCount <= 1) {
+        return 0;
+    }
+    // The modulo only matters for IDs minted under a different shard count
+    const u32 shard = static_cast<u32>(id.value >> SESSION_SHARD_SHIFT) & (MAX_SESSION_SHARDS - 1);
+    return shard % shardCount;
+}
+
 class SessionManager {
 private:
     // Manager state
@@ -210,8 +480,38 @@ private:
     // Manager statistics
     SessionManagerStats stats_;
     
-    // Next session ID generator
+    // Next session ID generator - a shard masks the counter to make room
+    // for its index in the low word of an ID
     SequenceCounter<u64> nextSessionId_;
+    u32 idCounterMask_;
+    u32 idShardBits_;
+    
+    // Heartbeat timeout armed for new sessions
+    AtomicU64 heartbeatTimeoutNanos_{DEFAULT_HEARTBEAT_TIMEOUT_NANOS};
+    
+    // Actor mode - partition -> owning worker, one inbox per worker.
+    // partitionLoad_ is written by the owner only (no RMW), read by rebalance.
+    SessionInbox* inboxes_;
+    u32 actorWorkers_;
+    AtomicU32 partitionOwner_[SESSION_PARTITIONS];
+    AtomicU32 partitionLoad_[SESSION_PARTITIONS];
+    u32 rebalanceBaseline_[SESSION_PARTITIONS];     // rebalance() caller only
+    
+    // Hibernated sessions, and where the idle scan resumes (scanner only)
+    ColdSessionStore coldStore_;
+    u64 hibernateCursor_;
+    
+    // Checkpoint file, and per pool slot which session the last pass wrote
+    // from it. Checkpoint caller only - except the dirty bits, set by every
+    // path that changes a slot; a pass visits only those.
+    struct CheckpointShadow {
+        u64 sessionId;
+    };
+    MappedFile checkpointFile_;
+    CheckpointShadow* checkpointShadow_[MAX_NUMA_NODES];
+    AtomicU64* checkpointDirty_[MAX_NUMA_NODES];
+    u64 checkpointGeneration_;
+    bool checkpointColdPending_;        // Next pass also walks the cold store
     
 public:
     SessionManager() noexcept;
@@ -224,15 +524,24 @@ public:
     // Initialize manager
     bool initialize(ThreadPool* threadPool = nullptr) noexcept;
     
+    // Initialize as one shard - a single pool on the shard's node, sized
+    // for its share of the sessions
+    bool initializeShard(ThreadPool* threadPool, const SessionShardConfig& shard) noexcept;
+    
     // Shutdown manager
     void shutdown() noexcept;
     
     // Session lifecycle
     SessionId createSession(const SessionConfiguration& config) noexcept;
+    // Lock-free lookup - hold an EpochGuard for as long as the pointer is used
     SessionData* getSession(SessionId id) noexcept;
     const SessionData* getSession(SessionId id) const noexcept;
     bool destroySession(SessionId id) noexcept;
     
+    // Batched lookup for ingestion - overlaps the cache misses of the whole
+    // batch instead of paying them one after another. Returns hits.
+    u32 getSessions(const SessionId* ids, u32 count, SessionData** out) noexcept;
+    
     // Batch operations
     u32 createSessions(const SessionConfiguration& config, 
                        SessionId* ids, u32 count) noexcept;
@@ -255,6 +564,51 @@ public:
     u32 cleanupInactiveSessions(u64 timeoutNanos) noexcept;
     void defragmentPools() noexcept;
     
+    // Actor mode - every session belongs to exactly one worker, which applies
+    // its events with plain stores. Producers post; workers drain their inbox.
+    bool enableActorMode(u32 workerCount) noexcept;
+    void disableActorMode() noexcept;
+    bool isActorMode() const noexcept { return inboxes_ != nullptr; }
+    u32 getPartition(SessionId id) const noexcept;
+    u32 getOwnerWorker(SessionId id) const noexcept;
+    bool post(const SessionEvent& event) noexcept;
+    u32 drainInbox(u32 workerId, u32 maxEvents) noexcept;
+    
+    // Hibernation - idle sessions (no tick for idleNanos) are compressed into
+    // the cold store and their slot returned to the pool. getSession and
+    // friends rehydrate transparently. Scans at most maxScan slots per call.
+    // In actor mode only the owner may snapshot a session, so both post a
+    // Hibernate event instead and return what was posted - the owner
+    // re-checks idleness when it drains.
+    u32 hibernateIdleSessions(u64 idleNanos, u32 maxScan) noexcept;
+    bool hibernateSession(SessionId id) noexcept;
+    u64 getHibernatedCount() const noexcept { return coldStore_.getCount(); }
+    u64 getColdStoreBytes() const noexcept { return coldStore_.getBytes(); }
+    
+    // Checkpoint - configuration, statistics and user state (SessionData::
+    // allocate) of every session in a memory-mapped file. A pass writes only
+    // sessions marked dirty since the previous one, so it costs O(changed),
+    // not O(sessions). The manager marks after its own changes - create,
+    // destroy, hibernation, the inbox, session memory. Anyone writing
+    // through a getSession pointer must call markSessionDirty after the
+    // write; a mark taken before it can be consumed by a pass that then
+    // captures the old state.
+    // openCheckpoint starts a fresh file. One checkpointing thread at a time.
+    bool openCheckpoint(const char* path) noexcept;
+    void closeCheckpoint() noexcept;
+    u32 checkpoint(bool sync = true) noexcept;
+    void markSessionDirty(SessionId id) noexcept;
+    
+    // Fast restart - bulk-reinstate every session of a checkpoint into a
+    // freshly initialized manager. The file stays open for further passes.
+    u32 restoreFromCheckpoint(const char* path) noexcept;
+    
+    // Rebalancing moves whole partitions - the old owner hands off in order.
+    // One rebalancing thread at a time, which may be a worker: a move whose
+    // handoff marker does not fit the old owner's inbox fails, retry later.
+    bool migratePartition(u32 partition, u32 toWorker) noexcept;
+    u32 rebalance(u32 maxMoves) noexcept;
+    
     // Debug
     void dumpState() const noexcept;
     
@@ -262,8 +616,22 @@ private:
     // Internal helpers
     SessionPool* selectPool() noexcept;
     SessionPool* getPoolForNode(u32 nodeId) noexcept;
-    bool initializePools() noexcept;
+    bool initializeWith(ThreadPool* threadPool, u32 nodes, i32 homeNode, u32 sessionsPerPool,
+                        u32 tableBuckets, usize memoryPerNode) noexcept;
+    bool initializePools(u32 sessionsPerPool, i32 homeNode) noexcept;
     void releasePools() noexcept;
+    bool applyOwnedEvent(u32 workerId, SessionData* session, 
+                         const SessionEvent& event) noexcept;
+    bool hibernate(SessionData* session, u64 idleBefore) noexcept;
+    bool postHibernate(SessionId id, u64 idleBefore) noexcept;
+    SessionData* rehydrate(SessionId id) noexcept;
+    bool destroyColdSession(SessionId id, u32 nodeId, MemoryPool* arena,
+                            usize poolSize, u64 startTime) noexcept;
+    bool allocateCheckpointShadows(bool allDirty) noexcept;
+    void markSlotDirty(const SessionData* session) noexcept;
+    bool checkpointDeparted(u64 sessionId, u64 generation) noexcept;
+    u32 checkpointColdStore(u64 generation) noexcept;
+    u32 restoreCheckpointRange(u64 begin, u64 end) noexcept;
 };
 
 // ============================================================================
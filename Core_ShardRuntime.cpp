@@ -0,0 +1,483 @@
+//===--- Core_ShardRuntime.cpp - Thread-Per-Core Runtime Implementation --===//
+//
+// COMPILATION LEVEL: 8
+// ORIGIN: Implementation for Core_ShardRuntime.h
+// DEPENDENCIES: Core_ShardRuntime.h, Core_Threading.h
+// DEPENDENTS: SystemOrchestrator
+//===----------------------------------------------------------------------===//
+
+#include "Core_ShardRuntime.h"
+#include "Core_Threading.h"
+#include <immintrin.h>  // For _mm_pause()
+#include <chrono>
+#include <new>
+
+AARENDOCORE_NAMESPACE_BEGIN
+
+static constexpr u32 SHARD_TASK_BATCH = 64;         // Tasks per loop before polling again
+static constexpr u32 SHARD_MESSAGE_BATCH = 256;     // Messages per channel per loop
+static constexpr u32 SHARD_IDLE_SPINS = 4096;       // Idle loops before yielding the core
+
+// ============================================================================
+// RUNTIME SHARD
+// ============================================================================
+
+RuntimeShard::RuntimeShard(u32 index, u32 cpuId, u32 numaNode) noexcept
+    : index_(index)
+    , cpuId_(cpuId)
+    , numaNode_(numaNode)
+    , componentsBuilt_(false)
+    , inboundCount_(0)
+    , stop_(false)
+    , startState_(0)
+    , stats_{} {
+    for (u32 i = 0; i < MAX_RUNTIME_SHARDS; ++i) {
+        inbound_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+RuntimeShard::~RuntimeShard() noexcept {
+    // The thread is joined by now - its components are ours to tear down
+    if (componentsBuilt_) {
+        executor_.ref().shutdown();
+        executor_.get()->~DAGExecutor();
+        broker_.get()->~MessageBroker();
+    }
+    sessions_.shutdown();
+    arena_.release();
+}
+
+bool RuntimeShard::submit(Task task) noexcept {
+    if (!task || stop_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    tasks_.push(static_cast<Task&&>(task));
+    return true;
+}
+
+void RuntimeShard::threadMain(SessionShardConfig sessionConfig, usize arenaBytes) noexcept {
+    // Pin first - everything built below is first touched from here
+    if (cpuId_ != INVALID_CPU_ID) {
+        SetThreadCpu(cpuId_);
+    } else {
+        SetThreadNumaAffinity(numaNode_);
+    }
+
+    new(broker_.get()) MessageBroker();
+    new(executor_.get()) DAGExecutor();
+    componentsBuilt_ = true;
+
+    MessageBroker& broker = broker_.ref();
+    DAGExecutor& executor = executor_.ref();
+    if (!sessions_.initializeShard(nullptr, sessionConfig) ||
+        !executor.initializeInline(&broker) ||
+        !arena_.initialize(arenaBytes)) {
+        startState_.store(2, std::memory_order_release);
+        return;
+    }
+    startState_.store(1, std::memory_order_release);
+
+    // Run to completion - tasks, inbound channels, broker, executor
+    u32 idleStreak = 0;
+    Task task;
+    while (!stop_.load(std::memory_order_acquire)) {
+        bool busy = false;
+
+        for (u32 i = 0; i < SHARD_TASK_BATCH && tasks_.try_pop(task); ++i) {
+            task(*this);
+            task = nullptr;
+            stats_.tasksRun.fetch_add(1, std::memory_order_relaxed);
+            busy = true;
+        }
+
+        if (drainChannels()) {
+            busy = true;
+        }
+
+        broker.processMessages();
+        if (broker.processTimers() > 0) {
+            busy = true;
+        }
+        executor.processQueues();
+
+        stats_.loops.fetch_add(1, std::memory_order_relaxed);
+        if (busy) {
+            idleStreak = 0;
+            continue;
+        }
+
+        stats_.idleLoops.fetch_add(1, std::memory_order_relaxed);
+        if (++idleStreak < SHARD_IDLE_SPINS) {
+            _mm_pause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool RuntimeShard::drainChannels() noexcept {
+    bool received = false;
+    const u32 count = inboundCount_.load(std::memory_order_acquire);
+
+    for (u32 i = 0; i < count; ++i) {
+        ShardChannel* channel = inbound_[i].load(std::memory_order_acquire);
+        if (!channel) {
+            continue;  // Slot claimed, channel not stored yet
+        }
+
+        ShardMessage incoming;
+        u32 drained = 0;
+        while (drained < SHARD_MESSAGE_BATCH && channel->queue.dequeue(incoming)) {
+            broker_.ref().publish(incoming.topic, incoming.message, incoming.priority);
+            ++drained;
+        }
+
+        if (drained > 0) {
+            stats_.messagesReceived.fetch_add(drained, std::memory_order_relaxed);
+            received = true;
+        }
+    }
+
+    return received;
+}
+
+// ============================================================================
+// SHARD RUNTIME
+// ============================================================================
+
+ShardRuntime::ShardRuntime() noexcept
+    : shardCount_(0)
+    , channelCount_(0) {
+    for (u32 i = 0; i < MAX_RUNTIME_SHARDS; ++i) {
+        shards_[i] = nullptr;
+        channels_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ShardRuntime::~ShardRuntime() noexcept {
+    stop();
+}
+
+ResultCode ShardRuntime::start(const ShardRuntimeConfig& config) noexcept {
+    if (shardCount_ > 0) {
+        return ResultCode::ERROR_INVALID_PARAMETER;
+    }
+
+    // Plan - one shard per physical core (its primary thread) or per node
+    const CpuTopology& topology = GetCpuTopology();
+    u32 limit = MAX_RUNTIME_SHARDS;
+    if (config.maxShards > 0 && config.maxShards < limit) {
+        limit = config.maxShards;
+    }
+
+    u32 cpus[MAX_RUNTIME_SHARDS];
+    u32 nodes[MAX_RUNTIME_SHARDS];
+    u32 planned = 0;
+    if (config.perNumaNode) {
+        for (u32 node = 0; node < topology.nodeCount && node < MAX_NUMA_NODES && planned < limit; ++node) {
+            cpus[planned] = INVALID_CPU_ID;
+            nodes[planned] = node;
+            ++planned;
+        }
+    } else {
+        for (u32 i = 0; i < topology.cpuCount && planned < limit; ++i) {
+            const LogicalCpuInfo& cpu = topology.cpus[i];
+            if (!cpu.online || cpu.smtIndex != 0) {
+                continue;
+            }
+            cpus[planned] = cpu.cpuId;
+            nodes[planned] = cpu.numaNode;
+            ++planned;
+        }
+    }
+    if (planned == 0) {
+        cpus[0] = INVALID_CPU_ID;
+        nodes[0] = 0;
+        planned = 1;
+    }
+
+    // Size - an even share of the sessions and their memory per shard
+    u64 sessionsPerShard = (config.totalSessions + planned - 1) / planned;
+    if (sessionsPerShard == 0) {
+        sessionsPerShard = 1;
+    }
+    if (sessionsPerShard > UINT32_MAX) {
+        sessionsPerShard = UINT32_MAX;
+    }
+    u64 bucketsPerShard = sessionsPerShard / 8;   // Buckets hold several sessions
+    if (bucketsPerShard < 16) {
+        bucketsPerShard = 16;
+    }
+    if (bucketsPerShard > SessionTable::TABLE_SIZE) {
+        bucketsPerShard = SessionTable::TABLE_SIZE;
+    }
+    usize memoryPerShard = config.sessionMemoryBytes / planned;
+    if (memoryPerShard < MB) {
+        memoryPerShard = MB;
+    }
+
+    // Launch - the shard object itself lives on its node too
+    for (u32 i = 0; i < planned; ++i) {
+        void* memory = AllocateOnNumaNode(nodes[i], sizeof(RuntimeShard), CACHE_LINE);
+        if (!memory) {
+            stop();
+            return ResultCode::ERROR_OUT_OF_MEMORY;
+        }
+        RuntimeShard* shard = new(memory) RuntimeShard(i, cpus[i], nodes[i]);
+        shards_[i] = shard;
+        shardCount_ = i + 1;
+
+        SessionShardConfig sessionConfig;
+        sessionConfig.shardIndex = i;
+        sessionConfig.shardCount = planned;
+        sessionConfig.homeNode = nodes[i];
+        sessionConfig.sessionCapacity = static_cast<u32>(sessionsPerShard);
+        sessionConfig.tableBuckets = static_cast<u32>(bucketsPerShard);
+        sessionConfig.memoryBytes = memoryPerShard;
+
+        const usize arenaBytes = config.arenaBytesPerShard;
+        shard->thread_ = std::thread([shard, sessionConfig, arenaBytes]() noexcept {
+            shard->threadMain(sessionConfig, arenaBytes);
+        });
+    }
+
+    // Wait until every shard has built its components
+    bool failed = false;
+    for (u32 i = 0; i < shardCount_; ++i) {
+        u32 state;
+        while ((state = shards_[i]->startState_.load(std::memory_order_acquire)) == 0) {
+            std::this_thread::yield();
+        }
+        failed |= state != 1;
+    }
+    if (failed) {
+        stop();
+        return ResultCode::ERROR_INITIALIZATION_FAILED;
+    }
+
+    return ResultCode::SUCCESS;
+}
+
+void ShardRuntime::stop() noexcept {
+    for (u32 i = 0; i < shardCount_; ++i) {
+        shards_[i]->stop_.store(true, std::memory_order_release);
+    }
+    for (u32 i = 0; i < shardCount_; ++i) {
+        if (shards_[i]->thread_.joinable()) {
+            shards_[i]->thread_.join();
+        }
+    }
+
+    destroyShards();
+
+    for (u32 from = 0; from < MAX_RUNTIME_SHARDS; ++from) {
+        ShardChannel** row = channels_[from].exchange(nullptr, std::memory_order_acq_rel);
+        if (!row) {
+            continue;
+        }
+        for (u32 to = 0; to < MAX_RUNTIME_SHARDS; ++to) {
+            if (row[to]) {
+                row[to]->~ShardChannel();
+                FreeNumaMemory(row[to]);
+            }
+        }
+        delete[] row;
+    }
+    channelCount_.store(0, std::memory_order_release);
+}
+
+void ShardRuntime::destroyShards() noexcept {
+    for (u32 i = 0; i < shardCount_; ++i) {
+        shards_[i]->~RuntimeShard();
+        FreeNumaMemory(shards_[i]);
+        shards_[i] = nullptr;
+    }
+    shardCount_ = 0;
+}
+
+u32 ShardRuntime::shardForKey(const char* key) const noexcept {
+    if (shardCount_ <= 1 || !key) {
+        return 0;
+    }
+
+    // FNV-1a - stable across runs, so an account keeps its shard
+    u64 hash = 0xcbf29ce484222325ULL;
+    for (const char* c = key; *c; ++c) {
+        hash ^= static_cast<u8>(*c);
+        hash *= 0x100000001b3ULL;
+    }
+    return static_cast<u32>(hash % shardCount_);
+}
+
+bool ShardRuntime::send(u32 fromShard, u32 toShard, TopicId topic, const Message& message,
+                        MessagePriority priority) noexcept {
+    if (fromShard >= shardCount_ || toShard >= shardCount_) {
+        return false;
+    }
+
+    // Same shard - no boundary to cross
+    if (fromShard == toShard) {
+        return shards_[toShard]->broker_.ref().publish(topic, message, priority);
+    }
+
+    ShardChannel* channel = openChannel(fromShard, toShard);
+    if (!channel) {
+        return false;
+    }
+
+    ShardMessage outgoing;
+    outgoing.message = message;
+    outgoing.topic = topic;
+    outgoing.priority = priority;
+    outgoing.sourceShard = fromShard;
+    if (!channel->queue.enqueue(outgoing)) {
+        channel->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    channel->sent.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+ShardChannel* ShardRuntime::openChannel(u32 fromShard, u32 toShard) noexcept {
+    // Only the source shard's thread gets here, so the row is single-writer
+    ShardChannel** row = channels_[fromShard].load(std::memory_order_acquire);
+    if (!row) {
+        row = new(std::nothrow) ShardChannel*[MAX_RUNTIME_SHARDS]();
+        if (!row) {
+            return nullptr;
+        }
+        channels_[fromShard].store(row, std::memory_order_release);
+    }
+    if (row[toShard]) {
+        return row[toShard];
+    }
+
+    // The receiver polls it - keep it on the receiver's node
+    RuntimeShard* destination = shards_[toShard];
+    void* memory = AllocateOnNumaNode(destination->numaNode_, sizeof(ShardChannel), CACHE_LINE);
+    if (!memory) {
+        return nullptr;
+    }
+    ShardChannel* channel = new(memory) ShardChannel(fromShard, toShard);
+    row[toShard] = channel;
+
+    const u32 slot = destination->inboundCount_.fetch_add(1, std::memory_order_acq_rel);
+    destination->inbound_[slot].store(channel, std::memory_order_release);
+    channelCount_.fetch_add(1, std::memory_order_relaxed);
+    return channel;
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+namespace {
+
+struct ShardRingState {
+    ShardRuntime* runtime;
+    TopicId topics[MAX_RUNTIME_SHARDS];
+    AtomicU64 delivered;
+    AtomicU32 subscribed;
+    u32 messagesPerShard;
+};
+
+void countDelivery(const Message& msg, void* context) noexcept {
+    (void)msg;
+    static_cast<ShardRingState*>(context)->delivered.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Sends this shard's messages to the next one - resubmits itself rather than
+// spinning when the channel is full, so the receiver's loop keeps draining
+void pumpRing(RuntimeShard& shard, ShardRingState* ring, u32 sent) noexcept {
+    const u32 from = shard.getIndex();
+    const u32 to = (from + 1) % ring->runtime->getShardCount();
+
+    Message message{};
+    while (sent < ring->messagesPerShard) {
+        message.tick.price = static_cast<f64>(sent);
+        if (!ring->runtime->send(from, to, ring->topics[to], message)) {
+            break;
+        }
+        ++sent;
+    }
+
+    if (sent < ring->messagesPerShard) {
+        shard.submit([ring, sent](RuntimeShard& self) noexcept { pumpRing(self, ring, sent); });
+    }
+}
+
+u64 steadyNowNs() noexcept {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // anonymous namespace
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestShardRuntime(u32 shards, u32 messagesPerShard) {
+    if (shards == 0) {
+        shards = 2;
+    }
+    if (messagesPerShard == 0) {
+        messagesPerShard = 100000;
+    }
+
+    // Small shards - the test is about the channels, not session capacity
+    ShardRuntimeConfig config;
+    config.maxShards = shards;
+    config.totalSessions = 1024 * static_cast<u64>(shards);
+    config.sessionMemoryBytes = 16 * MB * static_cast<usize>(shards);
+    config.arenaBytesPerShard = MB;
+
+    ShardRuntime runtime;
+    if (runtime.start(config) != ResultCode::SUCCESS) {
+        return 0;
+    }
+    const u32 count = runtime.getShardCount();
+
+    ShardRingState* ring = new(std::nothrow) ShardRingState();
+    if (!ring) {
+        runtime.stop();
+        return 0;
+    }
+    ring->runtime = &runtime;
+    ring->delivered.store(0, std::memory_order_relaxed);
+    ring->subscribed.store(0, std::memory_order_relaxed);
+    ring->messagesPerShard = messagesPerShard;
+
+    // Each shard owns its topic and handler - set up on its own thread
+    for (u32 i = 0; i < count; ++i) {
+        runtime.getShard(i)->submit([ring](RuntimeShard& shard) noexcept {
+            MessageBroker& broker = shard.getBroker();
+            const TopicId topic = broker.createTopic("shard.ring");
+            ring->topics[shard.getIndex()] = topic;
+            broker.subscribe(topic, MessageHandler(countDelivery, ring));
+            ring->subscribed.fetch_add(1, std::memory_order_release);
+        });
+    }
+    while (ring->subscribed.load(std::memory_order_acquire) < count) {
+        std::this_thread::yield();
+    }
+
+    const u64 expected = static_cast<u64>(count) * messagesPerShard;
+    const u64 start = steadyNowNs();
+    for (u32 i = 0; i < count; ++i) {
+        runtime.getShard(i)->submit([ring](RuntimeShard& shard) noexcept { pumpRing(shard, ring, 0); });
+    }
+
+    const u64 deadline = start + 30ULL * 1000 * 1000 * 1000;
+    while (ring->delivered.load(std::memory_order_relaxed) < expected && steadyNowNs() < deadline) {
+        std::this_thread::yield();
+    }
+    const u64 elapsed = steadyNowNs() - start;
+    const u64 delivered = ring->delivered.load(std::memory_order_relaxed);
+
+    runtime.stop();
+    delete ring;
+
+    if (delivered < expected) {
+        return 0;
+    }
+    return elapsed / expected;
+}
+
+AARENDOCORE_NAMESPACE_END
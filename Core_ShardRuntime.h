@@ -0,0 +1,228 @@
+//===--- Core_ShardRuntime.h - Thread-Per-Core Shared-Nothing Runtime ---===//
+//
+// COMPILATION LEVEL: 8 (Owns SessionManager, MessageBroker, DAGExecutor)
+// ORIGIN: NEW - Alternative runtime topology for SystemOrchestrator
+// DEPENDENCIES: Core_SessionManager.h, Core_MessageBroker.h,
+//               Core_DAGExecutor.h, Core_LockFreeQueue.h, Core_NUMA.h
+// DEPENDENTS: SystemOrchestrator (RuntimeMode::THREAD_PER_CORE / _PER_NUMA_NODE)
+//
+// The shared runtime has every core contend on one session table, one broker
+// and one executor. Here the machine is cut into shards - one per physical
+// core, or one per NUMA node - and each shard owns a session partition, a
+// broker, an executor and a scratch arena, driven by one pinned thread. The
+// thread builds its own components after pinning, so their memory (pools
+// are zeroed on initialize) is first touched on the shard's node.
+//
+// Nothing is shared between shards except explicit channels: a shard that
+// needs to reach another (a strategy spanning shards) opens a single-producer
+// single-consumer channel to it on first use. The destination thread drains
+// its channels into its own broker.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_SHARDRUNTIME_H
+#define AARENDOCORE_CORE_SHARDRUNTIME_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include "Core_Atomic.h"
+#include "Core_Memory.h"
+#include "Core_Alignment.h"
+#include "Core_NUMA.h"
+#include "Core_SessionManager.h"
+#include "Core_MessageBroker.h"
+#include "Core_DAGExecutor.h"
+#include "Core_CompilerEnforce.h"
+#include "Core_LockFreeQueue.h"
+#include <tbb/concurrent_queue.h>
+#include <functional>
+#include <thread>
+
+AARENDOCORE_NAMESPACE_BEGIN
+
+constexpr u32 MAX_RUNTIME_SHARDS = 256;             // One per logical CPU at most
+constexpr u32 SHARD_CHANNEL_CAPACITY = 1024;        // Messages in flight per channel
+constexpr u32 INVALID_SHARD = UINT32_MAX;
+
+static_assert(MAX_RUNTIME_SHARDS <= MAX_SESSION_SHARDS,
+              "Every shard index must fit the session ID shard bits");
+
+// ============================================================================
+// SHARD RUNTIME CONFIGURATION
+// ============================================================================
+
+struct ShardRuntimeConfig {
+    bool perNumaNode;           // One shard per node instead of per physical core
+    u32 maxShards;              // 0 = as many as the topology gives
+    u64 totalSessions;          // Split evenly across shards
+    usize sessionMemoryBytes;   // Split evenly across shards
+    usize arenaBytesPerShard;   // Shard scratch arena
+
+    ShardRuntimeConfig() noexcept
+        : perNumaNode(false)
+        , maxShards(0)
+        , totalSessions(MAX_SESSIONS)
+        , sessionMemoryBytes(MEMORY_POOL_SIZE)
+        , arenaBytesPerShard(64 * MB) {}
+};
+
+// ============================================================================
+// CROSS-SHARD CHANNEL - One direction between two shards
+// ============================================================================
+
+// Origin: What crosses a shard boundary - published on the destination's broker
+struct alignas(CACHE_LINE) ShardMessage {
+    Message message;
+    TopicId topic;              // Destination broker topic
+    MessagePriority priority;
+    u32 sourceShard;
+};
+
+// Origin: SPSC ring - only the source shard's thread sends, only the
+// destination shard's thread receives
+struct ShardChannel {
+    LockFreeQueue<ShardMessage, SHARD_CHANNEL_CAPACITY> queue;
+    u32 sourceShard;
+    u32 destinationShard;
+    AtomicU64 sent;
+    AtomicU64 dropped;          // Channel full - the sender may retry
+
+    ShardChannel(u32 source, u32 destination) noexcept
+        : queue()
+        , sourceShard(source)
+        , destinationShard(destination)
+        , sent(0)
+        , dropped(0) {}
+};
+
+// ============================================================================
+// RUNTIME SHARD - Everything one core owns
+// ============================================================================
+
+struct ShardStats {
+    AtomicU64 loops;                // Scheduler iterations
+    AtomicU64 idleLoops;            // Iterations that found nothing to do
+    AtomicU64 tasksRun;             // Submitted tasks executed
+    AtomicU64 messagesReceived;     // Drained from inbound channels
+};
+
+class RuntimeShard {
+public:
+    using Task = std::function<void(RuntimeShard&)>;
+
+    RuntimeShard(u32 index, u32 cpuId, u32 numaNode) noexcept;
+    ~RuntimeShard() noexcept;
+
+    RuntimeShard(const RuntimeShard&) = delete;
+    RuntimeShard& operator=(const RuntimeShard&) = delete;
+
+    // Placement
+    u32 getIndex() const noexcept { return index_; }
+    u32 getCpu() const noexcept { return cpuId_; }          // INVALID_CPU_ID when node-bound
+    u32 getNumaNode() const noexcept { return numaNode_; }
+
+    // Components - touch them only from the shard's own thread (run a Task),
+    // except SessionManager, which is safe from any thread
+    SessionManager& getSessions() noexcept { return sessions_; }
+    MessageBroker& getBroker() noexcept { return broker_.ref(); }
+    DAGExecutor& getExecutor() noexcept { return executor_.ref(); }
+    MemoryPool& getArena() noexcept { return arena_; }
+
+    // Run a task on this shard's thread - any thread
+    bool submit(Task task) noexcept;
+
+    const ShardStats& getStats() const noexcept { return stats_; }
+
+private:
+    friend class ShardRuntime;
+
+    // Pin, build the components in place, then run until stopped
+    void threadMain(SessionShardConfig sessionConfig, usize arenaBytes) noexcept;
+    bool drainChannels() noexcept;
+
+    const u32 index_;
+    const u32 cpuId_;
+    const u32 numaNode_;
+
+    SessionManager sessions_;
+    MemoryPool arena_;
+
+    // Constructed by threadMain after pinning - their constructors allocate
+    // and zero rings and slot pools, which would otherwise be first touched
+    // by whichever thread called ShardRuntime::start
+    AlignedStorage<MessageBroker> broker_;
+    AlignedStorage<DAGExecutor> executor_;
+    bool componentsBuilt_;
+
+    // Inbound channels in the order they were opened - a sender claims a
+    // slot, then stores its channel; the drain skips a slot still empty
+    std::atomic<ShardChannel*> inbound_[MAX_RUNTIME_SHARDS];
+    AtomicU32 inboundCount_;
+
+    tbb::concurrent_queue<Task> tasks_;
+
+    std::thread thread_;
+    AtomicBool stop_;
+    AtomicU32 startState_;          // 0 = starting, 1 = ready, 2 = failed
+    ShardStats stats_;
+};
+
+// ============================================================================
+// SHARD RUNTIME - The set of shards and the channels between them
+// ============================================================================
+
+class ShardRuntime {
+public:
+    ShardRuntime() noexcept;
+    ~ShardRuntime() noexcept;
+
+    ShardRuntime(const ShardRuntime&) = delete;
+    ShardRuntime& operator=(const ShardRuntime&) = delete;
+
+    // Plan shards from the CPU topology, start their threads and wait until
+    // every shard has built its components
+    ResultCode start(const ShardRuntimeConfig& config) noexcept;
+
+    // Stop the threads and tear the shards down
+    void stop() noexcept;
+
+    bool isRunning() const noexcept { return shardCount_ > 0; }
+    u32 getShardCount() const noexcept { return shardCount_; }
+    RuntimeShard* getShard(u32 index) noexcept {
+        return index < shardCount_ ? shards_[index] : nullptr;
+    }
+
+    // Where a session or an account lives
+    u32 shardForSession(SessionId id) const noexcept { return GetSessionShard(id, shardCount_); }
+    u32 shardForKey(const char* key) const noexcept;
+
+    // Cross-shard send - call on the source shard's thread only. Opens the
+    // channel on first use; false when the channel is full.
+    bool send(u32 fromShard, u32 toShard, TopicId topic, const Message& message,
+              MessagePriority priority = MessagePriority::NORMAL) noexcept;
+
+    // Channels opened so far, in both directions
+    u32 getChannelCount() const noexcept { return channelCount_.load(std::memory_order_acquire); }
+
+private:
+    ShardChannel* openChannel(u32 fromShard, u32 toShard) noexcept;
+    void destroyShards() noexcept;
+
+    RuntimeShard* shards_[MAX_RUNTIME_SHARDS];
+    u32 shardCount_;
+
+    // Source-indexed rows of destination-indexed channel pointers, allocated
+    // per source shard on its first send
+    std::atomic<ShardChannel**> channels_[MAX_RUNTIME_SHARDS];
+    AtomicU32 channelCount_;
+};
+
+extern "C" {
+    // Ring of shards: each shard sends messagesPerShard messages to the next
+    // over its channel, the receiver publishes them on its own broker.
+    // Returns ns per delivered message, 0 on failure.
+    AARENDOCORE_API u64 AARendoCore_TestShardRuntime(u32 shards, u32 messagesPerShard);
+}
+
+AARENDOCORE_NAMESPACE_END
+
+#endif // AARENDOCORE_CORE_SHARDRUNTIME_H
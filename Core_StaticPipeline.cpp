@@ -0,0 +1,133 @@
+//===--- Core_StaticPipeline.cpp - Static vs Runtime-Wired Benchmark ----===//
+//
+// COMPILATION LEVEL: 4
+// ORIGIN: Implementation for Core_StaticPipeline.h
+// DEPENDENCIES: Core_StaticPipeline.h
+// DEPENDENTS: None
+//
+// The pipeline is all templates; this file holds the benchmark that prices
+// it against the same stages wired at runtime.
+//===----------------------------------------------------------------------===//
+
+#include "Core_StaticPipeline.h"
+#include <chrono>
+#include <vector>
+
+namespace AARendoCoreGLM {
+
+namespace {
+
+// Origin: What a runtime-wired hop looks like - a virtual call per stage,
+// the next stage found through a pointer the way connectTo wires units
+class RuntimeStage {
+public:
+    virtual ~RuntimeStage() = default;
+    virtual ProcessResult onTick(PipelineFrame& frame) noexcept = 0;
+};
+
+template<typename Stage>
+class RuntimeStageAdapter final : public RuntimeStage {
+public:
+    ProcessResult onTick(PipelineFrame& frame) noexcept override { return stage_.onTick(frame); }
+
+private:
+    Stage stage_;
+};
+
+// Origin: Stages in wiring order, walked until one stops the tick
+struct RuntimeChain {
+    std::vector<RuntimeStage*> stages;
+
+    ~RuntimeChain() {
+        for (RuntimeStage* stage : stages) {
+            delete stage;
+        }
+    }
+
+    ProcessResult processTick(PipelineFrame& frame) noexcept {
+        for (RuntimeStage* stage : stages) {
+            const ProcessResult result = stage->onTick(frame);
+            if (result != ProcessResult::SUCCESS) {
+                return result;
+            }
+        }
+        return ProcessResult::SUCCESS;
+    }
+};
+
+u64 steadyNowNs() noexcept {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // anonymous namespace
+
+// ==========================================================================
+// BENCHMARK
+// ==========================================================================
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestStaticPipeline(u32 ticks, u64* runtimeNs) {
+    if (ticks == 0) {
+        ticks = 1000000;
+    }
+
+    // Deterministic random walk, strictly increasing timestamps
+    std::vector<Tick> input(ticks);
+    u64 state = 0x9E3779B97F4A7C15ULL;
+    f64 price = 100.0;
+    for (u32 i = 0; i < ticks; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        price += (static_cast<f64>(state & 0xFFFF) / 65535.0 - 0.5) * 0.01;
+        input[i] = Tick{};
+        input[i].timestamp = 1000 + i;
+        input[i].price = price;
+        input[i].volume = static_cast<f64>(1 + (state >> 60));
+    }
+
+    // Static: one Pipeline, every hop inlined
+    Pipeline<TickStage, BarStage<100>, IndicatorStage<20>> pipeline;
+    f64 staticEma = 0.0;
+    const u64 staticStart = steadyNowNs();
+    for (u32 i = 0; i < ticks; ++i) {
+        PipelineFrame frame;
+        frame.tick = input[i];
+        frame.barClosed = false;
+        frame.indicator = 0.0;
+        if (pipeline.processTick(frame) == ProcessResult::SUCCESS) {
+            staticEma = frame.indicator;
+        }
+    }
+    const u64 staticNs = steadyNowNs() - staticStart;
+
+    // Runtime-wired: same stages behind virtual calls
+    RuntimeChain chain;
+    chain.stages.push_back(new RuntimeStageAdapter<TickStage>());
+    chain.stages.push_back(new RuntimeStageAdapter<BarStage<100>>());
+    chain.stages.push_back(new RuntimeStageAdapter<IndicatorStage<20>>());
+    f64 runtimeEma = 0.0;
+    const u64 runtimeStart = steadyNowNs();
+    for (u32 i = 0; i < ticks; ++i) {
+        PipelineFrame frame;
+        frame.tick = input[i];
+        frame.barClosed = false;
+        frame.indicator = 0.0;
+        if (chain.processTick(frame) == ProcessResult::SUCCESS) {
+            runtimeEma = frame.indicator;
+        }
+    }
+    const u64 chainNs = steadyNowNs() - runtimeStart;
+
+    if (runtimeNs) {
+        *runtimeNs = chainNs * 1000 / ticks;
+    }
+
+    // Same stages, same input - a different answer means a broken chain
+    if (staticEma != runtimeEma) {
+        return 0;
+    }
+    return staticNs * 1000 / ticks;
+}
+
+} // namespace AARendoCoreGLM
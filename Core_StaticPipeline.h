@@ -0,0 +1,369 @@
+//===--- Core_StaticPipeline.h - Compile-Time Composed Pipelines --------===//
+//
+// COMPILATION LEVEL: 4 (Depends on BaseProcessingUnit)
+// ORIGIN: NEW - Pipelines whose wiring is known at build time
+// DEPENDENCIES: Core_BaseProcessingUnit.h, Core_ProcessingUnitFactory.h,
+//               Core_Types.h, Core_Trace.h
+// DEPENDENTS: ProcessingUnitFactory (registers the stock pipeline)
+//
+// A runtime-wired chain pays a virtual call and a ProcessResult round trip
+// per hop, and the optimizer sees every stage boundary as opaque. Here the
+// stages are template arguments: Pipeline<TickStage, BarStage, IndicatorStage>
+// chains them by template recursion, so each stage's onTick is a direct
+// call the compiler inlines, and the per-tick frame never leaves registers.
+//
+// Stage contract - any class with:
+//   ProcessResult onTick(PipelineFrame& frame) noexcept;
+//       SUCCESS passes the frame on, SKIP ends the chain for this tick
+//       (filtered or still accumulating), FAILED ends it and counts an error
+//   void reset() noexcept;
+//
+// StaticPipelineUnit wraps a whole pipeline as one IProcessingUnit - one
+// virtual call per tick or batch at the edge, none inside - and
+// RegisterStaticPipeline makes the factory hand it out for its unit type.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_STATICPIPELINE_H
+#define AARENDOCORE_CORE_STATICPIPELINE_H
+
+#include "Core_BaseProcessingUnit.h"
+#include "Core_ProcessingUnitFactory.h"
+#include "Core_Types.h"
+#include "Core_Trace.h"
+#include <tuple>
+#include <utility>
+#include <chrono>
+#include <new>
+
+// Enforce compilation level
+#ifndef CORE_STATICPIPELINE_LEVEL_DEFINED
+#define CORE_STATICPIPELINE_LEVEL_DEFINED
+static constexpr int StaticPipeline_CompilationLevel = 4;
+#endif
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// PIPELINE FRAME - What travels between stages
+// ==========================================================================
+
+// Origin: Per-tick working set, a local of the batch loop
+// Scope: Built from one tick, dies at the end of its chain
+struct PipelineFrame {
+    Tick tick;              // Input tick, stages may rewrite it
+    Bar bar;                // Valid once barClosed
+    f64 indicator;          // Last indicator value computed for this tick
+    bool barClosed;         // A bar stage completed a bar on this tick
+};
+
+// ==========================================================================
+// STOCK STAGES
+// ==========================================================================
+
+// Origin: Rejects out-of-order and non-positive ticks
+// Scope: First stage of a tick pipeline
+struct TickStage {
+    u64 lastTimestamp = 0;
+
+    AARENDOCORE_FORCEINLINE ProcessResult onTick(PipelineFrame& frame) noexcept {
+        const Tick& tick = frame.tick;
+        if (tick.timestamp <= lastTimestamp || !(tick.price > 0.0) || tick.volume < 0.0) {
+            return ProcessResult::SKIP;
+        }
+        lastTimestamp = tick.timestamp;
+        return ProcessResult::SUCCESS;
+    }
+
+    void reset() noexcept { lastTimestamp = 0; }
+};
+
+// Origin: Aggregates TicksPerBar ticks into one OHLCV bar
+// Scope: Passes the frame on only when a bar closes
+template<u32 TicksPerBar>
+struct BarStage {
+    static_assert(TicksPerBar > 0, "A bar needs at least one tick");
+
+    Bar current{};
+
+    AARENDOCORE_FORCEINLINE ProcessResult onTick(PipelineFrame& frame) noexcept {
+        const f64 price = frame.tick.price;
+        if (current.tickCount == 0) {
+            current.timestamp = frame.tick.timestamp;
+            current.open = price;
+            current.high = price;
+            current.low = price;
+            current.volume = 0.0;
+        }
+        current.high = price > current.high ? price : current.high;
+        current.low = price < current.low ? price : current.low;
+        current.close = price;
+        current.volume += frame.tick.volume;
+
+        if (++current.tickCount < TicksPerBar) {
+            return ProcessResult::SKIP;
+        }
+
+        frame.bar = current;
+        frame.barClosed = true;
+        current.tickCount = 0;
+        return ProcessResult::SUCCESS;
+    }
+
+    void reset() noexcept { current = Bar{}; }
+};
+
+// Origin: Exponential moving average of bar closes
+// Scope: Runs on closed bars; Period fixes the smoothing at compile time
+template<u32 Period>
+struct IndicatorStage {
+    static_assert(Period > 0, "EMA period must be positive");
+    static constexpr f64 ALPHA = 2.0 / (static_cast<f64>(Period) + 1.0);
+
+    f64 ema = 0.0;
+    bool seeded = false;
+
+    AARENDOCORE_FORCEINLINE ProcessResult onTick(PipelineFrame& frame) noexcept {
+        if (!frame.barClosed) {
+            return ProcessResult::SKIP;
+        }
+        const f64 close = frame.bar.close;
+        ema = seeded ? ema + ALPHA * (close - ema) : close;
+        seeded = true;
+        frame.indicator = ema;
+        return ProcessResult::SUCCESS;
+    }
+
+    void reset() noexcept {
+        ema = 0.0;
+        seeded = false;
+    }
+};
+
+// ==========================================================================
+// PIPELINE - Stages composed by template recursion
+// ==========================================================================
+
+// Origin: Owns one instance of each stage, runs them in order
+// Scope: Single-threaded - one pipeline per session or per worker
+template<typename... Stages>
+class Pipeline {
+    static_assert(sizeof...(Stages) > 0, "A pipeline needs at least one stage");
+
+public:
+    static constexpr usize STAGE_COUNT = sizeof...(Stages);
+
+    // Origin: Counters for one processBatch call
+    struct BatchResult {
+        u32 completed;      // Ticks that ran through every stage
+        u32 skipped;        // Ticks a stage stopped
+        u32 failed;         // Ticks a stage failed
+        PipelineFrame last; // Frame of the last completed tick
+    };
+
+    // Run one tick through every stage
+    AARENDOCORE_FORCEINLINE ProcessResult processTick(PipelineFrame& frame) noexcept {
+        return runFrom<0>(frame);
+    }
+
+    // Run a batch; the frame is rebuilt per tick and only the last completed
+    // one is kept
+    BatchResult processBatch(const Tick* ticks, usize count) noexcept {
+        BatchResult result{};
+        for (usize i = 0; i < count; ++i) {
+            PipelineFrame frame;
+            frame.tick = ticks[i];
+            frame.barClosed = false;
+            frame.indicator = 0.0;
+
+            switch (runFrom<0>(frame)) {
+                case ProcessResult::SUCCESS:
+                    ++result.completed;
+                    result.last = frame;
+                    break;
+                case ProcessResult::FAILED:
+                    ++result.failed;
+                    break;
+                default:
+                    ++result.skipped;
+                    break;
+            }
+        }
+        return result;
+    }
+
+    void reset() noexcept {
+        std::apply([](Stages&... stage) { (stage.reset(), ...); }, stages_);
+    }
+
+    template<usize Index>
+    auto& stage() noexcept { return std::get<Index>(stages_); }
+
+private:
+    template<usize Index>
+    AARENDOCORE_FORCEINLINE ProcessResult runFrom(PipelineFrame& frame) noexcept {
+        if constexpr (Index == STAGE_COUNT) {
+            return ProcessResult::SUCCESS;
+        } else {
+            const ProcessResult result = std::get<Index>(stages_).onTick(frame);
+            if (result != ProcessResult::SUCCESS) {
+                return result;
+            }
+            return runFrom<Index + 1>(frame);
+        }
+    }
+
+    std::tuple<Stages...> stages_;
+};
+
+// ==========================================================================
+// STATIC PIPELINE UNIT - A whole pipeline as one processing unit
+// ==========================================================================
+
+// Origin: IProcessingUnit adapter; the only virtual calls are at its edge
+// Scope: Created by ProcessingUnitFactory once registered for a unit type
+template<ProcessingUnitType UnitType, typename... Stages>
+class StaticPipelineUnit final : public BaseProcessingUnit {
+public:
+    using PipelineType = Pipeline<Stages...>;
+
+    static constexpr ProcessingUnitType UNIT_TYPE = UnitType;
+
+    static constexpr u64 CAPABILITIES =
+        CAP_TICK | CAP_BATCH | CAP_STREAM | CAP_STATEFUL | CAP_ZERO_COPY;
+
+    explicit StaticPipelineUnit(i32 numaNode = -1) noexcept
+        : BaseProcessingUnit(UnitType, CAPABILITIES, numaNode)
+        , pipeline_()
+        , lastFrame_{} {}
+
+    ProcessResult processTick([[maybe_unused]] SessionId sessionId, const Tick& tick) noexcept override {
+        if (!isRunnable()) {
+            return ProcessResult::FAILED;
+        }
+        AARENDOCORE_TRACE_SCOPE(PIPELINE_UNIT, UNIT_PROCESS_TICK, getId(), tick.timestamp);
+
+        PipelineFrame frame;
+        frame.tick = tick;
+        frame.barClosed = false;
+        frame.indicator = 0.0;
+
+        const ProcessResult result = pipeline_.processTick(frame);
+        countResult(result);
+        if (result == ProcessResult::SUCCESS) {
+            lastFrame_ = frame;
+        }
+        return result;
+    }
+
+    ProcessResult processBatch([[maybe_unused]] SessionId sessionId, const Tick* ticks,
+                               usize count) noexcept override {
+        if (!ticks || count == 0 || !isRunnable()) {
+            return ProcessResult::FAILED;
+        }
+        AARENDOCORE_TRACE_SCOPE(PIPELINE_UNIT, UNIT_PROCESS_BATCH, getId(), count);
+
+        // startTime: Origin - Local from clock, Scope: function
+        const u64 startTime = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+
+        const typename PipelineType::BatchResult result = pipeline_.processBatch(ticks, count);
+        if (result.completed > 0) {
+            lastFrame_ = result.last;
+        }
+        metrics_.skipCount.fetch_add(result.skipped, std::memory_order_relaxed);
+        metrics_.errorCount.fetch_add(result.failed, std::memory_order_relaxed);
+        metrics_.batchesProcessed.fetch_add(1, std::memory_order_relaxed);
+        updateMetrics(startTime, static_cast<u32>(count), count * sizeof(Tick));
+
+        return result.failed == count ? ProcessResult::FAILED : ProcessResult::SUCCESS;
+    }
+
+    ProcessResult processStream(SessionId sessionId, const StreamData& streamData) noexcept override {
+        // Same tick payload layout as TickProcessingUnit
+        if (streamData.dataType != 1) {
+            return ProcessResult::FAILED;
+        }
+        const usize tickCount = streamData.payload[0];
+        const Tick* ticks = reinterpret_cast<const Tick*>(&streamData.payload[1]);
+        return processBatch(sessionId, ticks, tickCount);
+    }
+
+    // Frame of the last tick that completed every stage
+    const PipelineFrame& getLastFrame() const noexcept { return lastFrame_; }
+
+    PipelineType& getPipeline() noexcept { return pipeline_; }
+
+private:
+    bool isRunnable() noexcept {
+        const ProcessingUnitState state = getState();
+        if (state != ProcessingUnitState::READY && state != ProcessingUnitState::PROCESSING) {
+            return false;
+        }
+        if (state == ProcessingUnitState::READY) {
+            transitionState(ProcessingUnitState::PROCESSING);
+        }
+        return true;
+    }
+
+    void countResult(ProcessResult result) noexcept {
+        if (result == ProcessResult::SKIP) {
+            metrics_.skipCount.fetch_add(1, std::memory_order_relaxed);
+        } else if (result == ProcessResult::FAILED) {
+            metrics_.errorCount.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            metrics_.ticksProcessed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PipelineType pipeline_;
+    PipelineFrame lastFrame_;
+};
+
+// Origin: The tick -> 100-tick bar -> EMA(20) pipeline the system ships with
+// Scope: Registered for INDICATOR_COMPUTER by the factory
+using TickBarIndicatorPipelineUnit =
+    StaticPipelineUnit<ProcessingUnitType::INDICATOR_COMPUTER,
+                       TickStage, BarStage<100>, IndicatorStage<20>>;
+
+// ==========================================================================
+// FACTORY REGISTRATION
+// ==========================================================================
+
+// Origin: UnitCreator for one StaticPipelineUnit instantiation
+template<typename PipelineUnit>
+IProcessingUnit* CreateStaticPipelineUnit(i32 numaNode) noexcept {
+    return new(std::nothrow) PipelineUnit(numaNode);
+}
+
+// Origin: Make factory.createUnit(PipelineUnit::UNIT_TYPE) build this pipeline
+template<typename PipelineUnit>
+ResultCode RegisterStaticPipeline(ProcessingUnitFactory& factory) noexcept {
+    return factory.registerUnitCreator(PipelineUnit::UNIT_TYPE,
+                                       &CreateStaticPipelineUnit<PipelineUnit>);
+}
+
+// ==========================================================================
+// BENCHMARK
+// ==========================================================================
+
+extern "C" {
+    // Per-tick cost of tick -> bar -> indicator as a static pipeline against
+    // the same three stages wired at runtime (one virtual hop per stage).
+    // Returns ns per 1000 ticks for the static pipeline; runtimeNs gets the
+    // runtime-wired figure. Both chains must agree on the final EMA, or 0.
+    AARENDOCORE_API u64 AARendoCore_TestStaticPipeline(u32 ticks, u64* runtimeNs);
+}
+
+} // namespace AARendoCoreGLM
+
+// ==========================================================================
+// COMPILE-TIME VALIDATION
+// ==========================================================================
+
+// Verify no mutex usage
+ENFORCE_NO_MUTEX(AARendoCoreGLM::PipelineFrame);
+ENFORCE_NO_MUTEX(AARendoCoreGLM::TickBarIndicatorPipelineUnit);
+
+// Mark header complete
+ENFORCE_HEADER_COMPLETE(Core_StaticPipeline);
+
+#endif // AARENDOCORE_CORE_STATICPIPELINE_H
@@ -2,7 +2,7 @@
 //
 // COMPILATION LEVEL: 5
 // ORIGIN: Implementation for Core_StreamSynchronizer.h
-// DEPENDENCIES: Core_StreamSynchronizer.h
+// DEPENDENCIES: Core_StreamSynchronizer.h, Core_SIMDDispatch.h
 // DEPENDENTS: None
 //
 // FULL implementation with PSYCHOTIC PRECISION - NO PLACEHOLDERS!
@@ -10,6 +10,8 @@
 
 #include "Core_StreamSynchronizer.h"
 #include "Core_InterpolationProcessingUnit.h"  // For InterpolationProcessingUnit class
+#include "Core_SIMDDispatch.h"
+#include "Core_Trace.h"
 #include <cstring>
 #include <algorithm>
 #include <cmath>
@@ -197,6 +199,8 @@ bool StreamSynchronizer::updateStream(u32 streamId, const Tick& tick) noexcept {
         return false;
     }
     
+    AARENDOCORE_TRACE_SCOPE(SYNCHRONIZER, SYNC_UPDATE_STREAM, streamId, tick.timestamp);
+    
     // Update state
     states_[streamId].latestTimestamp.store(tick.timestamp, std::memory_order_release);
     states_[streamId].lastTick = tick;
@@ -236,6 +240,8 @@ bool StreamSynchronizer::updateBar(u32 streamId, const Bar& bar) noexcept {
 
 // Origin: Synchronize all active streams
 bool StreamSynchronizer::synchronize(SynchronizedOutput& output) noexcept {
+    AARENDOCORE_TRACE_SCOPE(SYNCHRONIZER, SYNC_SYNCHRONIZE, 0, 0);
+    
     // Detect current leader
     // leaderId: Origin - Result from detectLeader, Scope: Function
     u32 leaderId = detectLeader();
@@ -278,6 +284,7 @@ bool StreamSynchronizer::synchronize(SynchronizedOutput& output) noexcept {
     
     // Update statistics
     stats_.totalSyncs.fetch_add(1, std::memory_order_relaxed);
+    AARENDOCORE_TRACE_SCOPE_ARGS(leaderId, output.streamCount);
     
     // Calculate overall quality
     // totalConfidence: Origin - Local accumulator, Scope: Function
@@ -304,30 +311,33 @@ u32 StreamSynchronizer::synchronizeStreams(const u32* streamIds, u32 count,
         return 0;
     }
     
-    // Find leader among specified streams
-    // leaderId: Origin - Local leader finder, Scope: Function
-    u32 leaderId = static_cast<u32>(-1);
-    // leaderTime: Origin - Local timestamp tracker, Scope: Function
-    u64 leaderTime = 0;
+    // Gather latest timestamps of valid streams for the dispatched max kernel
+    // times: Origin - Contiguous timestamp snapshot, Scope: Function
+    alignas(64) u64 times[MAX_STREAMS];
+    // validIds: Origin - Stream ids matching times[], Scope: Function
+    u32 validIds[MAX_STREAMS];
+    u32 validCount = 0;
     
     for (u32 i = 0; i < count; ++i) {
         if (streamIds[i] >= MAX_STREAMS) continue;
-        
-        // streamTime: Origin - Stream's latest time, Scope: Loop
-        u64 streamTime = states_[streamIds[i]].latestTimestamp.load(std::memory_order_acquire);
-        if (streamTime > leaderTime) {
-            leaderTime = streamTime;
-            leaderId = streamIds[i];
-        }
+        times[validCount] = states_[streamIds[i]].latestTimestamp.load(std::memory_order_acquire);
+        validIds[validCount] = streamIds[i];
+        validCount++;
     }
     
-    if (leaderId == static_cast<u32>(-1)) {
+    // leaderTime: Origin - Maximum timestamp, Scope: Function
+    const u64 leaderTime = GetSIMDKernels().maxU64(times, validCount);
+    if (leaderTime == 0) {
         return 0;
     }
     
-    // Use AVX2 if enabled and beneficial
-    if (config_.enableAVX2 && count >= 4) {
-        return synchronizeAVX2(streamIds, count);
+    // leaderId: Origin - First stream holding the maximum, Scope: Function
+    u32 leaderId = static_cast<u32>(-1);
+    for (u32 i = 0; i < validCount; ++i) {
+        if (times[i] == leaderTime) {
+            leaderId = validIds[i];
+            break;
+        }
     }
     
     // Initialize output
@@ -681,70 +691,28 @@ u32 StreamSynchronizer::synchronizeAVX2(const u32* streams, u32 count) noexcept
         return 0;
     }
     
-    // synced: Origin - Counter for synchronized streams, Scope: Function
-    u32 synced = 0;
+    // Gather timestamps and find the leader with the dispatched kernel
+    // times: Origin - Contiguous timestamp snapshot, Scope: Function
+    alignas(64) u64 times[MAX_STREAMS];
+    // validIds: Origin - Stream ids matching times[], Scope: Function
+    u32 validIds[MAX_STREAMS];
+    u32 validCount = 0;
     
-    // Process 4 streams at a time with AVX2
-    for (u32 i = 0; i <= count - 4; i += 4) {
-        // Load 4 stream timestamps
-        // times: Origin - AVX2 vector of timestamps, Scope: Loop
-        __m256d times = _mm256_set_pd(
-            static_cast<f64>(states_[streams[i+3]].latestTimestamp.load(std::memory_order_acquire)),
-            static_cast<f64>(states_[streams[i+2]].latestTimestamp.load(std::memory_order_acquire)),
-            static_cast<f64>(states_[streams[i+1]].latestTimestamp.load(std::memory_order_acquire)),
-            static_cast<f64>(states_[streams[i]].latestTimestamp.load(std::memory_order_acquire))
-        );
-        
-        // Find maximum (leader) timestamp
-        // max1: Origin - First max operation, Scope: Loop
-        __m256d max1 = _mm256_permute2f128_pd(times, times, 1);
-        // max2: Origin - Second max operation, Scope: Loop
-        __m256d max2 = _mm256_max_pd(times, max1);
-        // max3: Origin - Third max operation, Scope: Loop
-        __m256d max3 = _mm256_permute_pd(max2, 5);
-        // leader: Origin - Final max result, Scope: Loop
-        __m256d leader = _mm256_max_pd(max2, max3);
-        
-        // Calculate lags
-        // lags: Origin - Time differences, Scope: Loop
-        __m256d lags = _mm256_sub_pd(leader, times);
-        
-        // Store results (simplified)
-        // lagArray: Origin - Array to store lags, Scope: Loop
-        alignas(32) f64 lagArray[4];
-        _mm256_store_pd(lagArray, lags);
-        
-        // Synchronize each stream based on lag
-        for (u32 j = 0; j < 4; ++j) {
-            if (streams[i+j] < MAX_STREAMS) {
-                // leaderTime: Origin - Leader timestamp, Scope: Inner loop
-                u64 leaderTime = static_cast<u64>(lagArray[0] + 
-                    states_[streams[i+j]].latestTimestamp.load(std::memory_order_acquire));
-                synchronizeStream(streams[i+j], leaderTime);
-                synced++;
-            }
-        }
+    for (u32 i = 0; i < count && validCount < MAX_STREAMS; ++i) {
+        if (streams[i] >= MAX_STREAMS) continue;
+        times[validCount] = states_[streams[i]].latestTimestamp.load(std::memory_order_acquire);
+        validIds[validCount] = streams[i];
+        validCount++;
     }
     
-    // Handle remaining streams
-    for (u32 i = (count / 4) * 4; i < count; ++i) {
-        if (streams[i] < MAX_STREAMS) {
-            // Find leader among remaining
-            // leaderTime: Origin - Local leader time, Scope: Loop
-            u64 leaderTime = 0;
-            for (u32 j = (count / 4) * 4; j < count; ++j) {
-                // streamTime: Origin - Stream timestamp, Scope: Inner loop
-                u64 streamTime = states_[streams[j]].latestTimestamp.load(std::memory_order_acquire);
-                if (streamTime > leaderTime) {
-                    leaderTime = streamTime;
-                }
-            }
-            synchronizeStream(streams[i], leaderTime);
-            synced++;
-        }
+    // leaderTime: Origin - Maximum timestamp, Scope: Function
+    const u64 leaderTime = GetSIMDKernels().maxU64(times, validCount);
+    
+    for (u32 i = 0; i < validCount; ++i) {
+        synchronizeStream(validIds[i], leaderTime);
     }
     
-    return synced;
+    return validCount;
 }
 
 } // namespace AARendoCoreGLMGLM
\ No newline at end of file
@@ -11,8 +11,11 @@
 #include "Core_ProcessingUnitFactory.h"
 #include "Core_SessionManager.h"
 #include "Core_DAGExecutor.h"
+#include "Core_ShardRuntime.h"
 #include "Core_Threading.h"
 #include <chrono>
+#include <cstdio>
+#include <thread>
 
 namespace AARendoCoreGLM {
 
@@ -36,6 +39,9 @@ void SystemConfig::setDefaults() noexcept {
     
     totalMemoryMB = 8192;         // 8GB default
     cacheLineSize = 64;           // Standard cache line
+    
+    runtimeMode = RuntimeMode::SHARED;
+    shardArenaMB = 64;            // 64MB scratch per shard
 }
 
 bool SystemConfig::validate() const noexcept {
@@ -43,7 +49,8 @@ bool SystemConfig::validate() const noexcept {
            maxSessions <= 50'000'000 &&  // Sanity limit
            totalMemoryMB >= 1024 &&      // Minimum 1GB
            totalMemoryMB <= 1024*1024 && // Maximum 1TB
-           cacheLineSize == 64;          // Standard only for now
+           cacheLineSize == 64 &&        // Standard only for now
+           runtimeMode <= RuntimeMode::THREAD_PER_NUMA_NODE;
 }
 
 // ============================================================================
@@ -73,10 +80,12 @@ SystemOrchestrator::SystemOrchestrator() noexcept
     : state_(SystemState::UNINITIALIZED)
     , config_{}
     , stats_{}
+    , startupTimings_{}
     , factory_(nullptr)
     , sessionManager_(nullptr) 
     , dagExecutor_(nullptr)
     , threadPool_(nullptr)
+    , shardRuntime_(nullptr)
     , factoryInitialized_(false)
     , sessionManagerInitialized_(false)
     , dagExecutorInitialized_(false)
@@ -198,33 +207,58 @@ ResultCode SystemOrchestrator::shutdown() noexcept {
 // ============================================================================
 
 ResultCode SystemOrchestrator::createComponents() noexcept {
-    // PHASE 1: Create basic components
-    
-    // 1. Initialize ThreadPool first (others depend on it)
-    ResultCode result = initializeThreadPool();
-    if (result != ResultCode::SUCCESS) {
-        return result;
-    }
-    
-    // 2. Initialize ProcessingUnitFactory
-    result = initializeFactory();
-    if (result != ResultCode::SUCCESS) {
-        return result;
-    }
-    
-    // 3. Initialize SessionManager (depends on factory)
-    result = initializeSessionManager();
-    if (result != ResultCode::SUCCESS) {
-        return result;
+    startupTimings_ = StartupTimings();
+    const auto startupStart = std::chrono::steady_clock::now();
+    
+    // Factory and executor pools depend on nothing else - build them on a
+    // side thread while the main path brings up the sessions, the long pole
+    // (every per-node pool is faulted in there)
+    ResultCode sideResult = ResultCode::SUCCESS;
+    auto sidePath = [this, &sideResult]() noexcept {
+        sideResult = timePhase(&SystemOrchestrator::initializeFactory, startupTimings_.factoryNs);
+        if (sideResult == ResultCode::SUCCESS) {
+            sideResult = timePhase(&SystemOrchestrator::initializeDAGExecutor,
+                                   startupTimings_.dagExecutorNs);
+        }
+    };
+    std::thread side;
+    try {
+        side = std::thread(sidePath);
+    } catch (...) {
+        sidePath();
+    }
+    
+    ResultCode result;
+    if (config_.runtimeMode != RuntimeMode::SHARED) {
+        // Thread-per-core: the factory stays global (stateless creators),
+        // every other component is owned by a shard
+        result = timePhase(&SystemOrchestrator::initializeShardRuntime,
+                           startupTimings_.shardRuntimeNs);
+    } else {
+        // SessionManager takes the pool's pointer, so the pool goes first
+        result = timePhase(&SystemOrchestrator::initializeThreadPool, startupTimings_.threadPoolNs);
+        if (result == ResultCode::SUCCESS) {
+            result = timePhase(&SystemOrchestrator::initializeSessionManager,
+                               startupTimings_.sessionManagerNs);
+        }
     }
     
-    // 4. Initialize DAGExecutor (depends on units)
-    result = initializeDAGExecutor();
-    if (result != ResultCode::SUCCESS) {
-        return result;
+    if (side.joinable()) {
+        side.join();
     }
+    startupTimings_.totalNs = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startupStart).count());
     
-    return ResultCode::SUCCESS;
+    return result != ResultCode::SUCCESS ? result : sideResult;
+}
+
+ResultCode SystemOrchestrator::timePhase(ResultCode (SystemOrchestrator::*phase)() noexcept,
+                                         u64& ns) noexcept {
+    const auto start = std::chrono::steady_clock::now();
+    const ResultCode result = (this->*phase)();
+    ns = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    return result;
 }
 
 ResultCode SystemOrchestrator::initializeFactory() noexcept {
@@ -266,6 +300,13 @@ ResultCode SystemOrchestrator::initializeSessionManager() noexcept {
 }
 
 ResultCode SystemOrchestrator::initializeDAGExecutor() noexcept {
+    // Execution contexts and completions come from process-wide pools -
+    // shard executors share them too, so build them in either mode
+    DAGExecutor::prewarmPools();
+    if (config_.runtimeMode != RuntimeMode::SHARED) {
+        return ResultCode::SUCCESS;
+    }
+    
     // Get global DAG executor instance (the actual function that exists)
     dagExecutor_ = &getGlobalDAGExecutor();
     
@@ -295,9 +336,37 @@ ResultCode SystemOrchestrator::initializeThreadPool() noexcept {
     return ResultCode::SUCCESS;
 }
 
+ResultCode SystemOrchestrator::initializeShardRuntime() noexcept {
+    shardRuntime_ = new(std::nothrow) ShardRuntime();
+    if (!shardRuntime_) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
+    
+    ShardRuntimeConfig shardConfig;
+    shardConfig.perNumaNode = config_.runtimeMode == RuntimeMode::THREAD_PER_NUMA_NODE;
+    shardConfig.maxShards = config_.workerThreads;  // 0 = whole topology
+    shardConfig.totalSessions = config_.maxSessions;
+    shardConfig.arenaBytesPerShard = static_cast<usize>(config_.shardArenaMB) * MB;
+    
+    ResultCode result = shardRuntime_->start(shardConfig);
+    if (result != ResultCode::SUCCESS) {
+        delete shardRuntime_;
+        shardRuntime_ = nullptr;
+        return result;
+    }
+    
+    return ResultCode::SUCCESS;
+}
+
 void SystemOrchestrator::destroyComponents() noexcept {
     // Shutdown in reverse order
     
+    if (shardRuntime_) {
+        shardRuntime_->stop();
+        delete shardRuntime_;
+        shardRuntime_ = nullptr;
+    }
+    
     if (dagExecutorInitialized_.load()) {
         // DAGExecutor is global, just call its shutdown method
         if (dagExecutor_) {
@@ -349,6 +418,10 @@ const SystemConfig& SystemOrchestrator::getConfig() const noexcept {
     return config_;
 }
 
+const StartupTimings& SystemOrchestrator::getStartupTimings() const noexcept {
+    return startupTimings_;
+}
+
 bool SystemOrchestrator::isInitialized() const noexcept {
     SystemState state = getState();
     return state != SystemState::UNINITIALIZED && 
@@ -379,13 +452,21 @@ bool SystemOrchestrator::hasThreadPool() const noexcept {
     return threadPoolInitialized_.load(std::memory_order_acquire) && threadPool_ != nullptr;
 }
 
+bool SystemOrchestrator::hasShardRuntime() const noexcept {
+    return shardRuntime_ != nullptr && shardRuntime_->isRunning();
+}
+
+ShardRuntime* SystemOrchestrator::getShardRuntime() const noexcept {
+    return shardRuntime_;
+}
+
 // ============================================================================
 // MINIMAL API IMPLEMENTATION
 // ============================================================================
 
 SessionId SystemOrchestrator::createSession(const char* accountId, 
                                            const char* strategyName) noexcept {
-    if (!isRunning() || !hasSessionManager()) {
+    if (!isRunning() || (!hasSessionManager() && !hasShardRuntime())) {
         return SessionId{0}; // Invalid session ID
     }
     
@@ -398,7 +479,14 @@ SessionId SystemOrchestrator::createSession(const char* accountId,
         strncpy(config.strategyName, strategyName, sizeof(config.strategyName) - 1);
     }
     
-    SessionId id = sessionManager_->createSession(config);
+    // Thread-per-core: an account's sessions all live on its shard
+    SessionId id{0};
+    if (hasShardRuntime()) {
+        RuntimeShard* shard = shardRuntime_->getShard(shardRuntime_->shardForKey(config.accountId));
+        id = shard->getSessions().createSession(config);
+    } else {
+        id = sessionManager_->createSession(config);
+    }
     if (id.value != 0) {
         stats_.totalSessions.fetch_add(1, std::memory_order_relaxed);
         stats_.activeSessions.fetch_add(1, std::memory_order_relaxed);
@@ -408,11 +496,17 @@ SessionId SystemOrchestrator::createSession(const char* accountId,
 }
 
 bool SystemOrchestrator::destroySession(SessionId sessionId) noexcept {
-    if (!hasSessionManager() || sessionId.value == 0) {
+    if ((!hasSessionManager() && !hasShardRuntime()) || sessionId.value == 0) {
         return false;
     }
     
-    bool success = sessionManager_->destroySession(sessionId);
+    bool success;
+    if (hasShardRuntime()) {
+        RuntimeShard* shard = shardRuntime_->getShard(shardRuntime_->shardForSession(sessionId));
+        success = shard->getSessions().destroySession(sessionId);
+    } else {
+        success = sessionManager_->destroySession(sessionId);
+    }
     if (success) {
         stats_.activeSessions.fetch_sub(1, std::memory_order_relaxed);
     }
@@ -429,8 +523,17 @@ u64 SystemOrchestrator::getSessionCount() const noexcept {
 // ============================================================================
 
 void SystemOrchestrator::dumpState() const noexcept {
-    // PHASE 1: Basic state dump
-    // TODO PHASE 2: Comprehensive diagnostics
+    std::printf("SystemOrchestrator State: %s\n", getStateString());
+    std::printf("  Active Sessions: %llu\n",
+        static_cast<unsigned long long>(getSessionCount()));
+    
+    const StartupTimings& timings = startupTimings_;
+    std::printf("  Startup: %.3f ms total\n", static_cast<f64>(timings.totalNs) / 1e6);
+    std::printf("    ThreadPool:     %.3f ms\n", static_cast<f64>(timings.threadPoolNs) / 1e6);
+    std::printf("    Factory:        %.3f ms\n", static_cast<f64>(timings.factoryNs) / 1e6);
+    std::printf("    SessionManager: %.3f ms\n", static_cast<f64>(timings.sessionManagerNs) / 1e6);
+    std::printf("    DAGExecutor:    %.3f ms\n", static_cast<f64>(timings.dagExecutorNs) / 1e6);
+    std::printf("    ShardRuntime:   %.3f ms\n", static_cast<f64>(timings.shardRuntimeNs) / 1e6);
 }
 
 const char* SystemOrchestrator::getStateString() const noexcept {
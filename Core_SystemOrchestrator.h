@@ -23,6 +23,7 @@ namespace AARendoCoreGLM {
     class SessionManager;
     class DAGExecutor;
     class ThreadPool;
+    class ShardRuntime;
     struct SystemConfig;
 }
 
@@ -44,6 +45,16 @@ enum class SystemState : u32 {
     ERROR         = 8
 };
 
+// ============================================================================
+// RUNTIME MODE - How the machine is divided between components
+// ============================================================================
+
+enum class RuntimeMode : u32 {
+    SHARED               = 0,  // One thread pool, session manager and executor for all cores
+    THREAD_PER_CORE      = 1,  // Shared-nothing shard per physical core
+    THREAD_PER_NUMA_NODE = 2   // Shared-nothing shard per NUMA node
+};
+
 // ============================================================================
 // SYSTEM CONFIGURATION - Minimal config for Phase 1
 // ============================================================================
@@ -64,6 +75,10 @@ struct SystemConfig {
     u64 totalMemoryMB;         // Default: 8GB
     u32 cacheLineSize;         // Default: 64
     
+    // Runtime topology
+    RuntimeMode runtimeMode;   // Default: SHARED
+    u32 shardArenaMB;          // Default: 64 (scratch arena per shard)
+    
     SystemConfig() noexcept;
     void setDefaults() noexcept;
     bool validate() const noexcept;
@@ -86,6 +101,23 @@ struct alignas(CACHE_LINE_SIZE) SystemStats {
     void reset() noexcept;
 };
 
+// ============================================================================
+// STARTUP TIMINGS - Wall time of each initialization phase
+// ============================================================================
+
+struct StartupTimings {
+    u64 threadPoolNs;
+    u64 factoryNs;
+    u64 sessionManagerNs;      // Includes faulting in the per-node pools
+    u64 dagExecutorNs;         // Includes pre-building the execution pools
+    u64 shardRuntimeNs;        // Thread-per-core modes only
+    u64 totalNs;               // Less than the sum - phases overlap
+    
+    StartupTimings() noexcept
+        : threadPoolNs(0), factoryNs(0), sessionManagerNs(0)
+        , dagExecutorNs(0), shardRuntimeNs(0), totalNs(0) {}
+};
+
 // ============================================================================
 // SYSTEM ORCHESTRATOR - The Central Brain
 // ============================================================================
@@ -96,6 +128,7 @@ private:
     std::atomic<SystemState> state_;
     SystemConfig config_;
     SystemStats stats_;
+    StartupTimings startupTimings_;
     
     // Component interfaces (NOT owned - injected!)
     ProcessingUnitFactory* factory_;
@@ -103,6 +136,10 @@ private:
     DAGExecutor* dagExecutor_;
     ThreadPool* threadPool_;
     
+    // Shard runtime - owned, replaces the shared components in the
+    // thread-per-core modes
+    ShardRuntime* shardRuntime_;
+    
     // Component lifecycle flags
     AtomicBool factoryInitialized_;
     AtomicBool sessionManagerInitialized_;
@@ -154,6 +191,9 @@ public:
     // Initialize ThreadPool
     ResultCode initializeThreadPool() noexcept;
     
+    // Initialize shard runtime (thread-per-core modes)
+    ResultCode initializeShardRuntime() noexcept;
+    
     // ========================================================================
     // SYSTEM QUERIES - State and statistics
     // ========================================================================
@@ -161,6 +201,7 @@ public:
     SystemState getState() const noexcept;
     const SystemStats& getStats() const noexcept;
     const SystemConfig& getConfig() const noexcept;
+    const StartupTimings& getStartupTimings() const noexcept;
     
     bool isInitialized() const noexcept;
     bool isRunning() const noexcept;
@@ -171,6 +212,10 @@ public:
     bool hasSessionManager() const noexcept;
     bool hasDAGExecutor() const noexcept;
     bool hasThreadPool() const noexcept;
+    bool hasShardRuntime() const noexcept;
+    
+    // Shards in the thread-per-core modes (nullptr in SHARED mode)
+    ShardRuntime* getShardRuntime() const noexcept;
     
     // ========================================================================
     // MINIMAL API - Essential operations only
@@ -200,6 +245,7 @@ private:
     // Component initialization helpers
     ResultCode createComponents() noexcept;
     void destroyComponents() noexcept;
+    ResultCode timePhase(ResultCode (SystemOrchestrator::*phase)() noexcept, u64& ns) noexcept;
     
     // Validation
     bool validateConfig(const SystemConfig& config) const noexcept;
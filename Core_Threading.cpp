@@ -36,24 +36,28 @@ void SetThreadContext(ThreadContext* context) noexcept {
 
 ThreadPool::ThreadPool() noexcept 
     : workers_(nullptr), workerCount_(0), workersPerNode_(0),
-      nextWorker_(0), running_(false), nodeQueues_(nullptr), nodeCount_(0) {
+      nextWorker_(0), running_(false), nodeQueues_(nullptr), nodeCount_(0),
+      affinityPolicy_(AffinityPolicy::Core) {
 }
 
-ThreadPool::ThreadPool(u32 workerCount) noexcept
+ThreadPool::ThreadPool(u32 workerCount, AffinityPolicy policy) noexcept
     : workers_(nullptr), workerCount_(0), workersPerNode_(0),
-      nextWorker_(0), running_(false), nodeQueues_(nullptr), nodeCount_(0) {
-    initialize(workerCount);
+      nextWorker_(0), running_(false), nodeQueues_(nullptr), nodeCount_(0),
+      affinityPolicy_(policy) {
+    initialize(workerCount, policy);
 }
 
 ThreadPool::~ThreadPool() noexcept {
     shutdown();
 }
 
-bool ThreadPool::initialize(u32 workerCount) noexcept {
+bool ThreadPool::initialize(u32 workerCount, AffinityPolicy policy) noexcept {
     if (running_.load(MemoryOrderAcquire)) {
         return false;  // Already initialized
     }
     
+    affinityPolicy_ = policy;
+    
     // Default to hardware thread count
     if (workerCount == 0) {
         workerCount = GetHardwareThreadCount();
@@ -68,11 +72,18 @@ bool ThreadPool::initialize(u32 workerCount) noexcept {
     
     workerCount_ = workerCount;
     
-    // Get NUMA node count
+    // Get NUMA node count (sysfs topology covers systems without libnuma)
     nodeCount_ = GetNumaNodeCount();
+    const CpuTopology& topology = GetCpuTopology();
+    if (topology.nodeCount > nodeCount_) {
+        nodeCount_ = topology.nodeCount;
+    }
     if (nodeCount_ == 0) {
         nodeCount_ = 1;
     }
+    if (nodeCount_ > MAX_NUMA_NODES) {
+        nodeCount_ = MAX_NUMA_NODES;
+    }
     
     workersPerNode_ = workerCount_ / nodeCount_;
     if (workersPerNode_ == 0) {
@@ -115,14 +126,20 @@ bool ThreadPool::initialize(u32 workerCount) noexcept {
         if (!nodeQueues_[i].tasks) {
             // Cleanup on failure
             for (u32 j = 0; j < i; ++j) {
+                DestroyArray(nodeQueues_[j].tasks, nodeQueues_[j].capacity);
                 FreeAligned(nodeQueues_[j].tasks);
             }
             FreeAligned(nodeQueues_);
             FreeAligned(workers_);
             return false;
         }
+        
+        // Task slots are move-assigned into, so they must be live objects
+        ConstructArray(nodeQueues_[i].tasks, nodeQueues_[i].capacity);
     }
     
+    planWorkerPlacement();
+    
     running_.store(true, MemoryOrderRelease);
     
     // Start worker threads
@@ -143,14 +160,21 @@ bool ThreadPool::initializeWorker(u32 workerId) noexcept {
     
     Worker& worker = workers_[workerId];
     
-    // Initialize context
+    // Initialize context (placement already planned)
     worker.context.workerId = workerId;
-    worker.context.numaNode = workerId / workersPerNode_;
     worker.context.priority = ThreadPriority::Normal;
     worker.context.state = ThreadState::Created;
     
-    std::snprintf(worker.context.name, MAX_THREAD_NAME_LENGTH,
-        "Worker_%u_Node_%u", workerId, worker.context.numaNode);
+    // Narrowed so the longest name provably fits: workers and CPUs below
+    // 65536, nodes below MAX_NUMA_NODES
+    if (worker.context.cpuId != INVALID_CPU_ID) {
+        std::snprintf(worker.context.name, MAX_THREAD_NAME_LENGTH,
+            "Worker_%u_Node_%u_Cpu_%u", static_cast<u16>(workerId),
+            static_cast<u8>(worker.context.numaNode), static_cast<u16>(worker.context.cpuId));
+    } else {
+        std::snprintf(worker.context.name, MAX_THREAD_NAME_LENGTH,
+            "Worker_%u_Node_%u", workerId, worker.context.numaNode);
+    }
     
     // Start thread
     try {
@@ -171,15 +195,15 @@ void ThreadPool::workerFunction(u32 workerId) noexcept {
     // Set thread name
     SetThreadName(worker.context.name);
     
-    // Set NUMA affinity
-    SetThreadNumaAffinity(worker.context.numaNode);
+    // Pin before touching any per-worker memory so first-touch is local
+    applyWorkerAffinity(worker.context);
     
     // Update thread ID
     worker.context.threadId = GetCurrentThreadId();
     worker.context.state = ThreadState::Running;
     
-    // Worker loop
-    while (!worker.shouldStop.test_and_set(MemoryOrderRelaxed)) {
+    // Worker loop (test only - shutdown() is the one that sets the flag)
+    while (!worker.shouldStop.test(MemoryOrderAcquire)) {
         Task task;
         
         if (worker.hasTask.test_and_set(MemoryOrderAcquire)) {
@@ -209,6 +233,101 @@ void ThreadPool::workerFunction(u32 workerId) noexcept {
     worker.context.state = ThreadState::Terminated;
 }
 
+void ThreadPool::planWorkerPlacement() noexcept {
+    const CpuTopology& topology = GetCpuTopology();
+    
+    // Candidate CPUs per node - primary SMT threads first, siblings last
+    u32 candidates[MAX_NUMA_NODES][MAX_TOPOLOGY_CPUS];
+    u32 candidateCount[MAX_NUMA_NODES] = {};
+    u32 nextSlot[MAX_NUMA_NODES] = {};
+    
+    const bool wantsCpu = affinityPolicy_ == AffinityPolicy::Core ||
+                          affinityPolicy_ == AffinityPolicy::PhysicalCore ||
+                          affinityPolicy_ == AffinityPolicy::IsolatedCore;
+    
+    if (wantsCpu) {
+        for (u32 pass = 0; pass < 2; ++pass) {
+            for (u32 i = 0; i < topology.cpuCount; ++i) {
+                const LogicalCpuInfo& cpu = topology.cpus[i];
+                const bool primary = cpu.smtIndex == 0;
+                
+                if (!cpu.online || primary != (pass == 0)) {
+                    continue;
+                }
+                if ((affinityPolicy_ == AffinityPolicy::IsolatedCore) != cpu.isolated) {
+                    continue;
+                }
+                if (affinityPolicy_ == AffinityPolicy::PhysicalCore && !primary) {
+                    continue;
+                }
+                
+                u32 node = cpu.numaNode < nodeCount_ ? cpu.numaNode : nodeCount_ - 1;
+                candidates[node][candidateCount[node]++] = i;
+            }
+        }
+    }
+    
+    for (u32 workerId = 0; workerId < workerCount_; ++workerId) {
+        ThreadContext& context = workers_[workerId].context;
+        
+        u32 node = workerId / workersPerNode_;
+        if (node >= nodeCount_) {
+            node = workerId % nodeCount_;
+        }
+        
+        context.numaNode = node;
+        context.cpuId = INVALID_CPU_ID;
+        context.coreId = INVALID_CPU_ID;
+        context.smtIndex = 0;
+        context.cpuMask = 0;
+        context.affinity = affinityPolicy_;
+        context.pinned = false;
+        
+        if (!wantsCpu) {
+            continue;
+        }
+        
+        // Node without eligible CPUs - borrow from the next node that has some
+        for (u32 i = 0; i < nodeCount_ && candidateCount[node] == 0; ++i) {
+            node = (node + 1) % nodeCount_;
+        }
+        if (candidateCount[node] == 0) {
+            continue;  // Nothing eligible anywhere - run unpinned
+        }
+        
+        // More workers than eligible CPUs wraps around (oversubscription)
+        u32 slot = nextSlot[node]++ % candidateCount[node];
+        const LogicalCpuInfo& cpu = topology.cpus[candidates[node][slot]];
+        
+        context.numaNode = node;
+        context.cpuId = cpu.cpuId;
+        context.coreId = cpu.coreId;
+        context.smtIndex = cpu.smtIndex;
+        context.cpuMask = cpu.cpuId < 64 ? (1ULL << cpu.cpuId) : 0;
+    }
+}
+
+void ThreadPool::applyWorkerAffinity(ThreadContext& context) noexcept {
+    switch (context.affinity) {
+        case AffinityPolicy::None:
+            context.pinned = false;
+            break;
+        case AffinityPolicy::NumaNode:
+            context.pinned = SetThreadNumaAffinity(context.numaNode);
+            break;
+        case AffinityPolicy::Core:
+        case AffinityPolicy::PhysicalCore:
+        case AffinityPolicy::IsolatedCore:
+            context.pinned = context.cpuId != INVALID_CPU_ID &&
+                             SetThreadCpu(context.cpuId);
+            if (!context.pinned) {
+                // Keep at least node locality when the CPU could not be pinned
+                SetThreadNumaAffinity(context.numaNode);
+            }
+            break;
+    }
+}
+
 bool ThreadPool::getTask(u32 workerId, Task& task) noexcept {
     // Try local node queue first
     u32 nodeId = workers_[workerId].context.numaNode;
@@ -363,6 +482,7 @@ void ThreadPool::shutdown() noexcept {
     if (nodeQueues_) {
         for (u32 i = 0; i < nodeCount_; ++i) {
             if (nodeQueues_[i].tasks) {
+                DestroyArray(nodeQueues_[i].tasks, nodeQueues_[i].capacity);
                 FreeAligned(nodeQueues_[i].tasks);
             }
         }
@@ -470,7 +590,23 @@ bool SetThreadAffinity(u64 cpuMask) noexcept {
 }
 
 bool SetThreadCpu(u32 cpuId) noexcept {
-    return SetThreadAffinity(1ULL << cpuId);
+#if AARENDOCORE_PLATFORM_WINDOWS
+    // Processor groups hold 64 logical CPUs each
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = static_cast<WORD>(cpuId / 64);
+    affinity.Mask = static_cast<KAFFINITY>(1ULL << (cpuId % 64));
+    return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+#else
+    if (cpuId >= CPU_SETSIZE) {
+        return false;
+    }
+    
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpuId, &cpuset);
+    
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == 0;
+#endif
 }
 
 u32 GetHardwareThreadCount() noexcept {
@@ -506,4 +642,116 @@ extern "C" AARENDOCORE_API u32 AARendoCore_GetHardwareThreads() {
     return GetHardwareThreadCount();
 }
 
+extern "C" AARENDOCORE_API const char* AARendoCore_GetCpuTopologyInfo() {
+    static char info[512];
+    
+    const CpuTopology& topology = GetCpuTopology();
+    u32 smtSiblings = 0;
+    for (u32 i = 0; i < topology.cpuCount; ++i) {
+        if (topology.cpus[i].smtIndex != 0) {
+            ++smtSiblings;
+        }
+    }
+    
+    std::snprintf(info, sizeof(info),
+        "Topology: Discovered=%s, LogicalCpus=%u, PhysicalCores=%u, "
+        "SmtSiblings=%u, NumaNodes=%u, IsolatedCpus=%u",
+        topology.discovered ? "Yes" : "No",
+        topology.cpuCount,
+        topology.coreCount,
+        smtSiblings,
+        topology.nodeCount,
+        topology.isolatedCount
+    );
+    
+    return info;
+}
+
+// ============================================================================
+// WORKER PINNING PERFORMANCE TEST
+// ============================================================================
+
+// Each task walks a working set bound to one NUMA node; a task that runs on
+// a CPU of another node (migration or cross-node steal) counts as remote.
+// Run once with AffinityPolicy::None and once pinned to compare.
+extern "C" AARENDOCORE_API u64 AARendoCore_TestWorkerPinningPerformance(
+    u32 iterations, u32 policy, u64* remoteAccesses) {
+    if (iterations == 0) {
+        iterations = 100000;  // Default 100K tasks
+    }
+    if (policy > static_cast<u32>(AffinityPolicy::IsolatedCore)) {
+        return 0;
+    }
+    
+    constexpr usize WORKING_SET_SIZE = 256 * KB;
+    
+    ThreadPool pool;
+    if (!pool.initialize(0, static_cast<AffinityPolicy>(policy))) {
+        return 0;
+    }
+    
+    const u32 nodeCount = pool.getNodeCount();
+    byte* workingSets[MAX_NUMA_NODES] = {};
+    
+    for (u32 node = 0; node < nodeCount; ++node) {
+        workingSets[node] = static_cast<byte*>(
+            AllocateOnNumaNode(node, WORKING_SET_SIZE, PAGE_SIZE));
+        if (!workingSets[node]) {
+            for (u32 j = 0; j < node; ++j) {
+                FreeNumaMemory(workingSets[j]);
+            }
+            return 0;
+        }
+        PrefaultPages(workingSets[node], WORKING_SET_SIZE);
+    }
+    
+    AtomicU64 remaining{iterations};
+    AtomicU64 remote{0};
+    AtomicU64 sink{0};
+    
+    auto start = Clock::now();
+    
+    for (u32 i = 0; i < iterations; ++i) {
+        const u32 node = i % nodeCount;
+        byte* workingSet = workingSets[node];
+        
+        ThreadPool::Task task = [&remaining, &remote, &sink, workingSet, node]() {
+            if (GetCurrentNumaNode() != node) {
+                AtomicIncrement(remote);
+            }
+            
+            u64 sum = 0;
+            for (usize offset = 0; offset < WORKING_SET_SIZE; offset += CACHE_LINE) {
+                sum += workingSet[offset];
+            }
+            
+            sink.fetch_add(sum, MemoryOrderRelaxed);
+            remaining.fetch_sub(1, MemoryOrderRelease);
+        };
+        
+        while (!pool.submitToNode(task, node)) {
+            YieldThread();  // Queue full - let workers drain
+        }
+    }
+    
+    while (remaining.load(MemoryOrderAcquire) != 0) {
+        YieldThread();
+    }
+    
+    auto end = Clock::now();
+    auto duration = std::chrono::duration_cast<Nanoseconds>(end - start);
+    
+    pool.shutdown();
+    
+    for (u32 node = 0; node < nodeCount; ++node) {
+        FreeNumaMemory(workingSets[node]);
+    }
+    
+    if (remoteAccesses) {
+        *remoteAccesses = remote.load(MemoryOrderRelaxed);
+    }
+    
+    return static_cast<u64>(duration.count());
+}
+
 AARENDOCORE_NAMESPACE_END
\ No newline at end of file
@@ -36,6 +36,15 @@ enum class ThreadPriority : i32 {
     Realtime = 2
 };
 
+// Worker placement policy
+enum class AffinityPolicy : u32 {
+    None = 0,            // OS schedules freely
+    NumaNode = 1,        // Bound to all CPUs of the worker's node
+    Core = 2,            // One logical CPU per worker, SMT siblings allowed
+    PhysicalCore = 3,    // One physical core per worker, SMT siblings left idle
+    IsolatedCore = 4     // Only CPUs isolated from the OS scheduler
+};
+
 // Thread state
 enum class ThreadState : u32 {
     Created = 0,
@@ -54,6 +63,11 @@ struct CACHE_ALIGNED ThreadContext {
     u32 workerId;                            // Worker ID (0-based)
     u32 numaNode;                            // NUMA node affinity
     u64 cpuMask;                             // CPU affinity mask
+    u32 cpuId;                               // Pinned logical CPU (INVALID_CPU_ID if none)
+    u32 coreId;                              // Physical core of cpuId
+    u32 smtIndex;                            // SMT sibling index on that core
+    AffinityPolicy affinity;                 // Placement policy applied
+    bool pinned;                             // Affinity was applied successfully
     ThreadPriority priority;                 // Thread priority
     ThreadState state;                       // Current state
     char name[MAX_THREAD_NAME_LENGTH];       // Thread name
@@ -83,7 +97,7 @@ private:
         AtomicFlag shouldStop;                // Stop flag
         AtomicFlag hasTask;                   // Task available flag
         Task currentTask;                     // Current task
-        Spinlock taskLock;                    // Task lock
+        McsLock taskLock;                     // Task lock - FIFO under contention
     };
     
     Worker* workers_;                        // Worker array
@@ -98,15 +112,17 @@ private:
         AtomicU32 head{0};                   // Queue head
         AtomicU32 tail{0};                   // Queue tail
         u32 capacity;                        // Queue capacity
-        Spinlock lock;                        // Queue lock
+        McsLock lock;                         // Queue lock - every worker contends
     };
     
     NodeQueue* nodeQueues_;                  // Per-node queues
     u32 nodeCount_;                          // Number of NUMA nodes
+    AffinityPolicy affinityPolicy_;          // Worker placement policy
     
 public:
     ThreadPool() noexcept;
-    explicit ThreadPool(u32 workerCount) noexcept;
+    explicit ThreadPool(u32 workerCount,
+                        AffinityPolicy policy = AffinityPolicy::Core) noexcept;
     ~ThreadPool() noexcept;
     
     // Disable copy
@@ -114,7 +130,8 @@ public:
     ThreadPool& operator=(const ThreadPool&) = delete;
     
     // Initialize pool
-    bool initialize(u32 workerCount = 0) noexcept;
+    bool initialize(u32 workerCount = 0,
+                    AffinityPolicy policy = AffinityPolicy::Core) noexcept;
     
     // Submit task to pool
     bool submit(Task task) noexcept;
@@ -134,9 +151,15 @@ public:
     // Get worker count
     u32 getWorkerCount() const noexcept { return workerCount_; }
     
+    // Get NUMA node (queue) count
+    u32 getNodeCount() const noexcept { return nodeCount_; }
+    
     // Get worker context
     const ThreadContext* getWorkerContext(u32 workerId) const noexcept;
     
+    // Get placement policy
+    AffinityPolicy getAffinityPolicy() const noexcept { return affinityPolicy_; }
+    
 private:
     // Worker thread function
     void workerFunction(u32 workerId) noexcept;
@@ -146,6 +169,12 @@ private:
     
     // Initialize worker
     bool initializeWorker(u32 workerId) noexcept;
+    
+    // Assign CPUs and NUMA nodes to workers from the real topology
+    void planWorkerPlacement() noexcept;
+    
+    // Apply the planned affinity on the calling worker thread
+    void applyWorkerAffinity(ThreadContext& context) noexcept;
 };
 
 // ============================================================================
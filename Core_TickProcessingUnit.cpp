@@ -2,13 +2,15 @@
 //
 // COMPILATION LEVEL: 4
 // ORIGIN: Implementation for Core_TickProcessingUnit.h
-// DEPENDENCIES: Core_TickProcessingUnit.h, Core_AVX2Math.h
+// DEPENDENCIES: Core_TickProcessingUnit.h, Core_AVX2Math.h, Core_SIMDDispatch.h
 // DEPENDENTS: None
 //
 // Processes market ticks with PSYCHOTIC NANOSECOND precision.
 //===----------------------------------------------------------------------===//
 
 #include "Core_TickProcessingUnit.h"
+#include "Core_SIMDDispatch.h"
+#include "Core_Trace.h"
 #include <cmath>
 #include <algorithm>
 #include <cstring>
@@ -27,6 +29,8 @@ TickProcessingUnit::TickProcessingUnit(i32 numaNode) noexcept
                         CAP_LOCK_FREE | CAP_ZERO_COPY | CAP_REAL_TIME,
                         numaNode)
     , tickConfig_{}
+    , publishedTickConfig_()
+    , tickConfigVersion_(0)
     , stats_{}
     , tickWindow_(nullptr)
     , windowPos_(0)
@@ -82,7 +86,20 @@ TickProcessingUnit::~TickProcessingUnit() noexcept {
 // Origin: Process single tick
 // Input: sessionId, tick
 // Output: ProcessResult
-ProcessResult TickProcessingUnit::processTick([[maybe_unused]] SessionId sessionId, const Tick& tick) noexcept {
+ProcessResult TickProcessingUnit::processTick(SessionId sessionId, const Tick& tick) noexcept {
+    AARENDOCORE_TRACE_SCOPE(TICK_UNIT, UNIT_PROCESS_TICK, getId(), tick.timestamp);
+    
+    // A single tick is its own batch boundary
+    adoptTickConfig();
+    
+    return processTickInBatch(sessionId, tick);
+}
+
+// Origin: Process single tick under the already adopted configuration
+// Input: sessionId, tick
+// Output: ProcessResult
+ProcessResult TickProcessingUnit::processTickInBatch([[maybe_unused]] SessionId sessionId,
+                                                     const Tick& tick) noexcept {
     // Validate state
     if (getState() != ProcessingUnitState::READY && 
         getState() != ProcessingUnitState::PROCESSING) {
@@ -152,67 +169,50 @@ ProcessResult TickProcessingUnit::processBatch([[maybe_unused]] SessionId sessio
     
     transitionState(ProcessingUnitState::PROCESSING);
     
+    AARENDOCORE_TRACE_SCOPE(TICK_UNIT, UNIT_PROCESS_BATCH, getId(), count);
+    
+    // Batch boundary - the whole batch runs under one configuration
+    adoptTickConfig();
+    
     // processedCount: Origin - Local counter, Scope: function
     usize processedCount = 0;
     
-    // Process in batches of 4 for AVX2 optimization
+    // Vectorized VWAP over the whole batch through the dispatched kernel
+    // (scalar, AVX2 or AVX-512 - chosen once from cpuid at load time)
     if (tickConfig_.enableAVX2 && count >= AVX2_DOUBLES) {
-        // Process aligned batches
-        for (usize i = 0; i <= count - AVX2_DOUBLES; i += AVX2_DOUBLES) {
-            // Prefetch next batch
-            if (i + PREFETCH_DISTANCE < count) {
-                prefetchTicks(ticks, i + PREFETCH_DISTANCE, count);
-            }
-            
-            // Load 4 prices and volumes into AVX2 registers
-            // prices: Origin - Local AVX2 register, Scope: block
-            __m256d prices = _mm256_set_pd(
-                ticks[i + 3].price,
-                ticks[i + 2].price,
-                ticks[i + 1].price,
-                ticks[i + 0].price
-            );
-            
-            // volumes: Origin - Local AVX2 register, Scope: block
-            __m256d volumes = _mm256_set_pd(
-                ticks[i + 3].volume,
-                ticks[i + 2].volume,
-                ticks[i + 1].volume,
-                ticks[i + 0].volume
-            );
-            
-            // multipliers: Origin - Local AVX2 register, Scope: block
-            __m256d multipliers = _mm256_load_pd(sessionMultipliers_);
-            
-            // Apply session multipliers
-            prices = _mm256_mul_pd(prices, multipliers);
-            
-            // Update VWAP accumulator
-            // priceVolume: Origin - Local AVX2 register, Scope: block
-            __m256d priceVolume = _mm256_mul_pd(prices, volumes);
-            vwapAccumulator_ = _mm256_add_pd(vwapAccumulator_, priceVolume);
-            volumeAccumulator_ = _mm256_add_pd(volumeAccumulator_, volumes);
-            
-            // Process individual ticks for outlier detection
-            for (usize j = 0; j < AVX2_DOUBLES; ++j) {
-                if (!detectOutlier(ticks[i + j])) {
-                    processedCount++;
-                } else {
-                    stats_.outlierCount.fetch_add(1, std::memory_order_relaxed);
-                }
+        // vectorCount: Origin - Ticks covered by the vector pass, Scope: block
+        const usize vectorCount = (count / AVX2_DOUBLES) * AVX2_DOUBLES;
+        
+        // sumPriceVolume/sumVolume: Origin - Kernel outputs, Scope: block
+        f64 sumPriceVolume = 0.0;
+        f64 sumVolume = 0.0;
+        GetSIMDKernels().accumulateVWAP(ticks, vectorCount, sessionMultipliers_[0],
+                                        &sumPriceVolume, &sumVolume);
+        
+        vwapAccumulator_ = _mm256_add_pd(vwapAccumulator_,
+                                         _mm256_set_pd(0.0, 0.0, 0.0, sumPriceVolume));
+        volumeAccumulator_ = _mm256_add_pd(volumeAccumulator_,
+                                           _mm256_set_pd(0.0, 0.0, 0.0, sumVolume));
+        
+        // Outlier detection stays per tick (batch is cache-hot after the kernel)
+        for (usize i = 0; i < vectorCount; ++i) {
+            if (!detectOutlier(ticks[i])) {
+                processedCount++;
+            } else {
+                stats_.outlierCount.fetch_add(1, std::memory_order_relaxed);
             }
         }
         
         // Process remaining ticks
-        for (usize i = (count / AVX2_DOUBLES) * AVX2_DOUBLES; i < count; ++i) {
-            if (processTick(sessionId, ticks[i]) == ProcessResult::SUCCESS) {
+        for (usize i = vectorCount; i < count; ++i) {
+            if (processTickInBatch(sessionId, ticks[i]) == ProcessResult::SUCCESS) {
                 processedCount++;
             }
         }
     } else {
         // Standard processing without AVX2
         for (usize i = 0; i < count; ++i) {
-            if (processTick(sessionId, ticks[i]) == ProcessResult::SUCCESS) {
+            if (processTickInBatch(sessionId, ticks[i]) == ProcessResult::SUCCESS) {
                 processedCount++;
             }
         }
@@ -383,14 +383,29 @@ ResultCode TickProcessingUnit::configureTick(const TickProcessingConfig& config)
         return ResultCode::ERROR_INVALID_PARAMETER;
     }
     
-    tickConfig_ = config;
+    // Publish only - the processing thread adopts it at its next boundary
+    if (publishedTickConfig_.publish(config) == 0) {
+        return ResultCode::ERROR_OUT_OF_MEMORY;
+    }
     
-    // Reset window if size changed
-    if (config.windowSize != tickConfig_.windowSize) {
+    return ResultCode::SUCCESS;
+}
+
+// Origin: Adopt the latest published tick configuration
+void TickProcessingUnit::adoptTickConfig() noexcept {
+    // previousWindow: Origin - Window size before adoption, Scope: function
+    const u32 previousWindow = tickConfig_.windowSize;
+    
+    if (!publishedTickConfig_.refresh(tickConfig_, tickConfigVersion_)) {
+        return;
+    }
+    
+    // Reset window if size changed - here, on the thread that fills it
+    if (tickConfig_.windowSize != previousWindow) {
         resetWindow();
     }
     
-    return ResultCode::SUCCESS;
+    AARENDOCORE_TRACE_INSTANT(TICK_UNIT, UNIT_CONFIG_ADOPTED, getId(), tickConfigVersion_);
 }
 
 // Origin: Get current tick statistics
@@ -418,10 +433,12 @@ u32 TickProcessingUnit::flushPendingTicks() noexcept {
     // flushed: Origin - Local counter, Scope: function
     u32 flushed = 0;
     
-    // Process all queued ticks
+    // Process all queued ticks as one batch
+    adoptTickConfig();
+    
     Tick tick;
     while (tickQueue_->dequeue(tick)) {
-        processTick(SessionId{0}, tick);
+        processTickInBatch(SessionId{0}, tick);
         flushed++;
     }
     
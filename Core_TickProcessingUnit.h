@@ -140,9 +140,15 @@ private:
     // MEMBER VARIABLES - PSYCHOTICALLY ALIGNED
     // ======================================================================
     
-    // Origin: Member - Tick-specific configuration, Scope: Instance lifetime
+    // Origin: Member - Tick configuration in use, Scope: Adopted at batch boundaries
     TickProcessingConfig tickConfig_;
     
+    // Origin: Member - Latest configureTick snapshot, Scope: Instance lifetime
+    VersionedConfig<TickProcessingConfig> publishedTickConfig_;
+    
+    // Origin: Member - Version tickConfig_ was copied from, Scope: Processing thread
+    u64 tickConfigVersion_;
+    
     // Origin: Member - Real-time statistics, Scope: Instance lifetime
     mutable TickStatistics stats_;
     
@@ -171,6 +177,16 @@ private:
     // PRIVATE METHODS - PSYCHOTIC OPTIMIZATION
     // ======================================================================
     
+    // Origin: Pick up a configureTick published since the last batch
+    // Called only at batch boundaries, so a batch sees one configuration
+    void adoptTickConfig() noexcept;
+    
+    // Origin: processTick body without adopting a new configuration
+    // Input: sessionId - Session identifier
+    //        tick - Market tick data
+    // Output: ProcessResult
+    ProcessResult processTickInBatch(SessionId sessionId, const Tick& tick) noexcept;
+    
     // Origin: Process tick with AVX2 optimization
     // Input: tick - Market tick to process
     // Output: true if processed successfully
@@ -247,7 +263,8 @@ public:
     // TICK-SPECIFIC METHODS
     // ======================================================================
     
-    // Origin: Configure tick processing parameters
+    // Origin: Configure tick processing parameters - safe while processing,
+    // takes effect at the start of the next tick or batch
     // Input: config - Tick-specific configuration
     // Output: ResultCode
     ResultCode configureTick(const TickProcessingConfig& config) noexcept;
@@ -0,0 +1,109 @@
+//===--- Core_TimerWheel.h - Hierarchical Timing Wheel ------------------===//
+//
+// COMPILATION LEVEL: 1 (Depends on Platform and Types only)
+// ORIGIN: NEW - O(1) timers for expiry, redelivery and heartbeat timeouts
+// DEPENDENCIES: Core_Platform.h, Core_Types.h
+// DEPENDENTS: MessageBroker, SessionManager
+//
+// Four levels of 256 slots. Timers are intrusive nodes owned by the caller,
+// so schedule/cancel never allocate and are O(1). Advancing only touches
+// occupied slots and the timers that actually come due - a sweep over 10M
+// sessions costs the expiring entries, not the population.
+//
+// A wheel is single-owner: one per core, or one per structure behind the
+// owner's lock. It is clock-agnostic - the owner feeds it TSC cycles or
+// nanoseconds and picks a tick granularity with tickShift.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_TIMERWHEEL_H
+#define AARENDOCORE_CORE_TIMERWHEEL_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// TIMER NODE
+// ==========================================================================
+
+// Origin: Intrusive timer, embedded in or parallel to the object it times
+// Scope: Owned by the caller; the wheel only links it
+struct TimerNode {
+    TimerNode* next;        // nullptr when not armed
+    TimerNode* prev;
+    u64 deadline;           // Absolute, in wheel ticks
+    void* context;          // Owner payload (session, envelope slot, ...)
+
+    TimerNode() noexcept : next(nullptr), prev(nullptr), deadline(0), context(nullptr) {}
+
+    bool isArmed() const noexcept { return next != nullptr; }
+};
+
+static_assert(sizeof(TimerNode) == 32, "TimerNode must stay half a cache line");
+
+// ==========================================================================
+// TIMER WHEEL
+// ==========================================================================
+
+// Origin: Hierarchical timing wheel (Varghese & Lauck), kernel-style cascade
+// Scope: Single owner - callers serialize access
+class TimerWheel {
+public:
+    static constexpr u32 LEVELS = 4;
+    static constexpr u32 SLOT_BITS = 8;
+    static constexpr u32 SLOTS = 1u << SLOT_BITS;
+    static constexpr u32 SLOT_MASK = SLOTS - 1;
+    static constexpr u32 BITMAP_WORDS = SLOTS / 64;
+    static constexpr u64 MAX_TICKS = 1ull << (SLOT_BITS * LEVELS);  // 2^32
+
+    TimerWheel() noexcept;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Start the wheel at 'now' (caller's clock); one tick = 2^tickShift units
+    void initialize(u64 now, u32 tickShift) noexcept;
+
+    // Arm a timer for an absolute time on the caller's clock. Deadlines in
+    // the past fire on the next advance. Re-arming an armed node moves it.
+    void schedule(TimerNode* node, u64 when) noexcept;
+
+    // Disarm a timer; false if it was not armed (already fired or popped)
+    bool cancel(TimerNode* node) noexcept;
+
+    // Move every timer due at or before 'now' onto the expired list.
+    // Returns how many came due.
+    u32 advance(u64 now) noexcept;
+
+    // Pop one expired timer (disarmed), nullptr when none left
+    TimerNode* popExpired() noexcept;
+
+    u64 getPendingCount() const noexcept { return pending_; }
+    u32 getTickShift() const noexcept { return tickShift_; }
+
+private:
+    void place(TimerNode* node) noexcept;
+    void cascade(u32 level) noexcept;
+    u32 expireSlot(u32 slot) noexcept;
+    u64 nextOccupiedTick(u64 target) const noexcept;
+
+    TimerNode slots_[LEVELS][SLOTS];        // Circular list sentinels
+    u64 occupied_[LEVELS][BITMAP_WORDS];    // Slot may be non-empty (lazy clear)
+    TimerNode expired_;                     // Due, waiting for popExpired()
+    u64 currentTick_;                       // Last tick processed
+    u64 pending_;                           // Armed timers, wheel + expired
+    u32 tickShift_;
+};
+
+// ==========================================================================
+// PER-CORE INSTANCE
+// ==========================================================================
+
+// Origin: Thread-local wheel on the TSC for core-pinned workers
+// Scope: Never share the returned wheel across threads
+TimerWheel& GetThreadTimerWheel() noexcept;
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_TIMERWHEEL_H
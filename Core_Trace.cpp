@@ -0,0 +1,361 @@
+//===--- Core_Trace.cpp - Per-Thread Binary Trace Rings ------------------===//
+//
+// COMPILATION LEVEL: 1
+// ORIGIN: Implementation for Core_Trace.h
+// DEPENDENCIES: Core_Trace.h
+// DEPENDENTS: None
+//
+// A ring is written only by the thread that claimed it: the record first,
+// then head with release. The dumper reads head, copies the live window,
+// reads head again and discards whatever the writer may have lapped in
+// between - so a dump never blocks or slows a tracing thread. A ring whose
+// thread exits is handed to the next new thread; its records carry their
+// own thread number, so the old events stay attributed correctly.
+//===----------------------------------------------------------------------===//
+
+#include "Core_Trace.h"
+#include <immintrin.h>
+#include <chrono>
+#include <cstdio>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace AARendoCoreGLM {
+
+std::atomic<u32> g_traceMask{0};
+
+namespace {
+
+constexpr u64 TRACE_RING_MASK = TRACE_RING_CAPACITY - 1;
+constexpr u64 TRACE_CALIBRATION_NS = 10000000;   // 10ms of TSC against the clock
+
+const char* const TRACE_EVENT_NAMES[] = {
+    "FluentAPI::processTick",
+    "StreamSynchronizer::updateStream",
+    "StreamSynchronizer::synchronize",
+    "MessageBroker::publish",
+    "MessageBroker::publishBatch",
+    "MessageBroker::deliver",
+    "DAGExecutor::executeDag",
+    "DAGExecutor::executeNode",
+    "DAGExecutor::executeTemplateBatch",
+    "ProcessingUnit::processTick",
+    "ProcessingUnit::processBatch",
+    "ProcessingUnit::adoptConfig"
+};
+
+const char* const TRACE_COMPONENT_NAMES[] = {
+    "api",
+    "synchronizer",
+    "broker",
+    "executor",
+    "tick_unit",
+    "batch_unit",
+    "interpolation_unit",
+    "data_unit",
+    "pipeline_unit"
+};
+
+static_assert(sizeof(TRACE_EVENT_NAMES) / sizeof(TRACE_EVENT_NAMES[0]) ==
+              static_cast<usize>(TraceEvent::COUNT), "Trace event name missing");
+static_assert(sizeof(TRACE_COMPONENT_NAMES) / sizeof(TRACE_COMPONENT_NAMES[0]) ==
+              static_cast<usize>(TraceComponent::COUNT), "Trace component name missing");
+
+// Origin: One thread's flight recorder
+struct alignas(CACHE_LINE) TraceRing {
+    std::atomic<u64> head{0};                   // Records ever written
+    std::atomic<u32> owned{0};                  // 1 while a live thread writes
+    TraceRecord records[TRACE_RING_CAPACITY];
+};
+
+std::atomic<TraceRing*> g_traceRings[MAX_TRACE_THREADS];
+std::atomic<u32> g_traceRingCount{0};           // Slots ever published
+std::atomic<u32> g_nextTraceThread{0};
+std::atomic<u64> g_traceDropped{0};
+
+// TSC/clock pair taken at the first enable - the dump derives the rate
+std::atomic<u64> g_anchorTsc{0};
+std::atomic<u64> g_anchorNs{0};
+
+thread_local TraceRing* t_traceRing = nullptr;
+thread_local u32 t_traceThread = 0;
+
+// Origin: Hands the ring back when the thread ends
+struct TraceThreadExit {
+    bool registered = false;
+    ~TraceThreadExit() {
+        if (registered && t_traceRing) {
+            t_traceRing->owned.store(0, std::memory_order_release);
+            t_traceRing = nullptr;
+        }
+    }
+};
+
+thread_local TraceThreadExit t_traceExit;
+
+AARENDOCORE_FORCEINLINE u64 ReadTsc() noexcept {
+    return __rdtsc();
+}
+
+u64 SteadyNowNs() noexcept {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Reuse a ring an exited thread left behind, else publish a new one
+TraceRing* ClaimTraceRing() noexcept {
+    const u32 published = g_traceRingCount.load(std::memory_order_acquire);
+    for (u32 i = 0; i < published; ++i) {
+        TraceRing* ring = g_traceRings[i].load(std::memory_order_acquire);
+        u32 expected = 0;
+        if (ring && ring->owned.compare_exchange_strong(expected, 1,
+                                                        std::memory_order_acq_rel)) {
+            return ring;
+        }
+    }
+
+    u32 slot = g_traceRingCount.load(std::memory_order_relaxed);
+    do {
+        if (slot >= MAX_TRACE_THREADS) {
+            return nullptr;
+        }
+    } while (!g_traceRingCount.compare_exchange_weak(slot, slot + 1,
+                                                     std::memory_order_acq_rel,
+                                                     std::memory_order_relaxed));
+
+    TraceRing* ring = new(std::nothrow) TraceRing();
+    if (!ring) {
+        return nullptr;                         // Slot stays empty, dump skips it
+    }
+    ring->owned.store(1, std::memory_order_relaxed);
+    g_traceRings[slot].store(ring, std::memory_order_release);
+    return ring;
+}
+
+// TSC ticks per microsecond, measured from the enable anchor to now
+f64 CalibrateTscPerUs() noexcept {
+    u64 anchorTsc = g_anchorTsc.load(std::memory_order_acquire);
+    u64 anchorNs = g_anchorNs.load(std::memory_order_acquire);
+    if (anchorTsc == 0) {
+        anchorTsc = ReadTsc();
+        anchorNs = SteadyNowNs();
+    }
+
+    while (SteadyNowNs() - anchorNs < TRACE_CALIBRATION_NS) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const u64 elapsedNs = SteadyNowNs() - anchorNs;
+    const u64 elapsedTsc = ReadTsc() - anchorTsc;
+    return (static_cast<f64>(elapsedTsc) * 1000.0) / static_cast<f64>(elapsedNs);
+}
+
+// Copy the records of ring that are still intact when the copy ends
+void SnapshotTraceRing(TraceRing* ring, std::vector<TraceRecord>& out) noexcept {
+    const u64 end = ring->head.load(std::memory_order_acquire);
+    u64 begin = end > TRACE_RING_CAPACITY ? end - TRACE_RING_CAPACITY : 0;
+
+    const usize base = out.size();
+    for (u64 i = begin; i < end; ++i) {
+        out.push_back(ring->records[i & TRACE_RING_MASK]);
+    }
+
+    // The writer may have lapped the oldest records while we copied; slot
+    // of index head - CAPACITY is the one it is writing right now
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const u64 now = ring->head.load(std::memory_order_relaxed);
+    if (now >= TRACE_RING_CAPACITY) {
+        const u64 firstIntact = now - TRACE_RING_CAPACITY + 1;
+        if (firstIntact > begin) {
+            const u64 lapped = firstIntact - begin < end - begin ? firstIntact - begin
+                                                                 : end - begin;
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(base),
+                      out.begin() + static_cast<std::ptrdiff_t>(base + lapped));
+        }
+    }
+}
+
+FILE* OpenTraceFile(const char* path) noexcept {
+#if AARENDOCORE_PLATFORM_WINDOWS
+    FILE* file = nullptr;
+    if (fopen_s(&file, path, "wb") != 0) {
+        return nullptr;
+    }
+    return file;
+#else
+    return std::fopen(path, "wb");
+#endif
+}
+
+} // anonymous namespace
+
+// ==========================================================================
+// EMISSION
+// ==========================================================================
+
+void TraceWrite(TraceComponent component, TraceEvent event, TracePhase phase,
+                u64 arg0, u64 arg1) noexcept {
+    TraceRing* ring = t_traceRing;
+    if (AARENDOCORE_UNLIKELY(!ring)) {
+        ring = ClaimTraceRing();
+        if (!ring) {
+            g_traceDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        t_traceRing = ring;
+        t_traceThread = g_nextTraceThread.fetch_add(1, std::memory_order_relaxed) + 1;
+        t_traceExit.registered = true;
+    }
+
+    const u64 head = ring->head.load(std::memory_order_relaxed);
+    TraceRecord& record = ring->records[head & TRACE_RING_MASK];
+    record.tsc = ReadTsc();
+    record.event = static_cast<u16>(event);
+    record.component = static_cast<u8>(component);
+    record.phase = static_cast<u8>(phase);
+    record.thread = t_traceThread;
+    record.arg0 = arg0;
+    record.arg1 = arg1;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+// ==========================================================================
+// CONTROL
+// ==========================================================================
+
+void SetTraceMask(u32 mask) noexcept {
+    mask &= TRACE_ALL_COMPONENTS;
+    if (mask != 0 && g_anchorTsc.load(std::memory_order_relaxed) == 0) {
+        g_anchorNs.store(SteadyNowNs(), std::memory_order_relaxed);
+        g_anchorTsc.store(ReadTsc(), std::memory_order_release);
+    }
+    g_traceMask.store(mask, std::memory_order_release);
+}
+
+u32 GetTraceMask() noexcept {
+    return g_traceMask.load(std::memory_order_acquire);
+}
+
+void ResetTrace() noexcept {
+    const u32 published = g_traceRingCount.load(std::memory_order_acquire);
+    for (u32 i = 0; i < published; ++i) {
+        TraceRing* ring = g_traceRings[i].load(std::memory_order_acquire);
+        if (ring) {
+            ring->head.store(0, std::memory_order_release);
+        }
+    }
+    g_traceDropped.store(0, std::memory_order_relaxed);
+}
+
+u64 GetTraceDroppedCount() noexcept {
+    return g_traceDropped.load(std::memory_order_relaxed);
+}
+
+// ==========================================================================
+// CHROME TRACE EXPORT
+// ==========================================================================
+
+u64 DumpTrace(const char* path) noexcept {
+    if (!path) {
+        return 0;
+    }
+
+    std::vector<TraceRecord> records;
+    try {
+        records.reserve(TRACE_RING_CAPACITY);
+        const u32 published = g_traceRingCount.load(std::memory_order_acquire);
+        for (u32 i = 0; i < published; ++i) {
+            TraceRing* ring = g_traceRings[i].load(std::memory_order_acquire);
+            if (ring) {
+                SnapshotTraceRing(ring, records);
+            }
+        }
+    } catch (...) {
+        return 0;
+    }
+
+    FILE* file = OpenTraceFile(path);
+    if (!file) {
+        return 0;
+    }
+
+    // Timestamps relative to the oldest surviving record, in microseconds
+    const f64 tscPerUs = CalibrateTscPerUs();
+    u64 originTsc = UINT64_MAX;
+    for (const TraceRecord& record : records) {
+        originTsc = record.tsc < originTsc ? record.tsc : originTsc;
+    }
+
+    static const char PHASE_CODES[] = {'B', 'E', 'i'};
+
+    u64 written = 0;
+    std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (const TraceRecord& record : records) {
+        if (record.event >= static_cast<u16>(TraceEvent::COUNT) ||
+            record.component >= static_cast<u8>(TraceComponent::COUNT) ||
+            record.phase > static_cast<u8>(TracePhase::INSTANT)) {
+            continue;
+        }
+
+        const f64 ts = static_cast<f64>(record.tsc - originTsc) / tscPerUs;
+        std::fprintf(file,
+                     "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,"
+                     "\"pid\":1,\"tid\":%u,%s\"args\":{\"arg0\":%llu,\"arg1\":%llu}}",
+                     written ? ",\n" : "",
+                     TRACE_EVENT_NAMES[record.event],
+                     TRACE_COMPONENT_NAMES[record.component],
+                     PHASE_CODES[record.phase],
+                     ts,
+                     record.thread,
+                     record.phase == static_cast<u8>(TracePhase::INSTANT) ? "\"s\":\"t\"," : "",
+                     static_cast<unsigned long long>(record.arg0),
+                     static_cast<unsigned long long>(record.arg1));
+        ++written;
+    }
+    std::fprintf(file, "\n]}\n");
+
+    const bool ok = std::ferror(file) == 0;
+    std::fclose(file);
+    return ok ? written : 0;
+}
+
+// ==========================================================================
+// EXPORTS
+// ==========================================================================
+
+extern "C" AARENDOCORE_API void AARendoCore_SetTraceMask(u32 mask) {
+    SetTraceMask(mask);
+}
+
+extern "C" AARENDOCORE_API u64 AARendoCore_DumpTrace(const char* path) {
+    return DumpTrace(path);
+}
+
+extern "C" AARENDOCORE_API u64 AARendoCore_TestTraceOverhead(u32 iterations, u32 enabled) {
+    if (iterations == 0) {
+        iterations = 10000000;  // Default 10M scopes
+    }
+
+    const u32 savedMask = GetTraceMask();
+    SetTraceMask(enabled ? TraceComponentBit(TraceComponent::TICK_UNIT) : 0);
+
+    volatile u64 sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (u32 i = 0; i < iterations; ++i) {
+        TraceScope scope(TraceComponent::TICK_UNIT, TraceEvent::UNIT_PROCESS_TICK);
+        if (scope.active()) {
+            scope.begin(i, 0);
+        }
+        sink = sink + i;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    SetTraceMask(savedMask);
+
+    const u64 totalNs = static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    return totalNs / iterations;
+}
+
+} // namespace AARendoCoreGLM
@@ -0,0 +1,235 @@
+//===--- Core_Trace.h - Per-Thread Binary Trace Rings --------------------===//
+//
+// COMPILATION LEVEL: 1 (Depends on Platform, Types and Config only)
+// ORIGIN: NEW - See where a tick's time goes from API to DAG node
+// DEPENDENCIES: Core_Platform.h, Core_Types.h, Core_Config.h
+// DEPENDENTS: FluentAPI, StreamSynchronizer, MessageBroker, DAGExecutor,
+//             every concrete processing unit
+//
+// Each thread appends fixed 32-byte records (TSC, event, component, two
+// arguments) to its own ring - one plain store of the record and one
+// release store of the head, no lock and no shared line written. Rings are
+// flight recorders: when full the oldest records are overwritten.
+//
+// Components are switched on at runtime through one mask word. A disabled
+// trace point costs a relaxed load and a branch; with
+// AARENDOCORE_ENABLE_PROFILING set to 0 the macros compile to nothing.
+// DumpTrace() converts every ring into Chrome trace JSON, which both
+// chrome://tracing and ui.perfetto.dev load directly.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_TRACE_H
+#define AARENDOCORE_CORE_TRACE_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include "Core_Config.h"
+#include <atomic>
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// CONFIGURATION
+// ==========================================================================
+
+constexpr u32 MAX_TRACE_THREADS = 256;          // Rings alive at once
+constexpr u32 TRACE_RING_CAPACITY = 16384;      // Records per thread (512KB)
+
+static_assert((TRACE_RING_CAPACITY & (TRACE_RING_CAPACITY - 1)) == 0,
+              "Trace ring capacity must be a power of 2");
+
+// ==========================================================================
+// EVENT VOCABULARY
+// ==========================================================================
+
+// Origin: One bit each in the runtime enable mask
+enum class TraceComponent : u8 {
+    API = 0,
+    SYNCHRONIZER,
+    BROKER,
+    EXECUTOR,
+    TICK_UNIT,
+    BATCH_UNIT,
+    INTERPOLATION_UNIT,
+    DATA_UNIT,
+    PIPELINE_UNIT,
+    COUNT
+};
+
+constexpr u32 TRACE_ALL_COMPONENTS =
+    (1u << static_cast<u32>(TraceComponent::COUNT)) - 1;
+
+constexpr u32 TraceComponentBit(TraceComponent component) noexcept {
+    return 1u << static_cast<u32>(component);
+}
+
+// Origin: Names for these live in Core_Trace.cpp - keep the two in step
+enum class TraceEvent : u16 {
+    API_PROCESS_TICK = 0,       // arg0 = stream id, arg1 = tick timestamp
+    SYNC_UPDATE_STREAM,         // arg0 = stream id, arg1 = timestamp
+    SYNC_SYNCHRONIZE,           // arg0 = leader stream, arg1 = streams aligned
+    BROKER_PUBLISH,             // arg0 = topic id, arg1 = priority
+    BROKER_PUBLISH_BATCH,       // arg0 = topic id, arg1 = messages
+    BROKER_DELIVER,             // arg0 = topic id, arg1 = message type
+    EXECUTOR_EXECUTE_DAG,       // arg0 = DAG id, arg1 = execution id
+    EXECUTOR_NODE,              // arg0 = node id, arg1 = execution id
+    EXECUTOR_TEMPLATE_BATCH,    // arg0 = template id, arg1 = executions
+    UNIT_PROCESS_TICK,          // arg0 = unit id, arg1 = tick timestamp
+    UNIT_PROCESS_BATCH,         // arg0 = unit id, arg1 = items
+    UNIT_CONFIG_ADOPTED,        // arg0 = unit id, arg1 = config version
+    COUNT
+};
+
+enum class TracePhase : u8 {
+    BEGIN = 0,                  // Chrome "B"
+    END,                        // Chrome "E"
+    INSTANT                     // Chrome "i"
+};
+
+// Origin: Fixed binary record, two per cache line
+struct TraceRecord {
+    u64 tsc;                    // Raw TSC at emission
+    u16 event;                  // TraceEvent
+    u8 component;               // TraceComponent
+    u8 phase;                   // TracePhase
+    u32 thread;                 // Trace thread number, survives ring reuse
+    u64 arg0;
+    u64 arg1;
+};
+
+static_assert(sizeof(TraceRecord) == 32, "TraceRecord must stay 32 bytes");
+
+// ==========================================================================
+// EMISSION
+// ==========================================================================
+
+// Runtime enable mask - written by SetTraceMask, read relaxed at every point
+extern std::atomic<u32> g_traceMask;
+
+AARENDOCORE_FORCEINLINE bool TraceEnabled(TraceComponent component) noexcept {
+    return (g_traceMask.load(std::memory_order_relaxed) &
+            TraceComponentBit(component)) != 0;
+}
+
+// Slow path: append to the calling thread's ring, claiming one on first use.
+// Dropped silently if all MAX_TRACE_THREADS rings are taken.
+void TraceWrite(TraceComponent component, TraceEvent event, TracePhase phase,
+                u64 arg0, u64 arg1) noexcept;
+
+// Origin: BEGIN via begin(), END on scope exit. The enable check is taken
+// once at construction, so a mask change mid-scope never leaves an
+// unmatched BEGIN, and arguments are only evaluated when active().
+class TraceScope {
+public:
+    TraceScope(TraceComponent component, TraceEvent event) noexcept
+        : component_(component), event_(event),
+          active_(TraceEnabled(component)), arg0_(0), arg1_(0) {}
+
+    ~TraceScope() noexcept {
+        if (active_) {
+            TraceWrite(component_, event_, TracePhase::END, arg0_, arg1_);
+        }
+    }
+
+    bool active() const noexcept { return active_; }
+
+    void begin(u64 arg0, u64 arg1) noexcept {
+        arg0_ = arg0;
+        arg1_ = arg1;
+        TraceWrite(component_, event_, TracePhase::BEGIN, arg0_, arg1_);
+    }
+
+    // Values known only later (execution id, result) go on END
+    void setArgs(u64 arg0, u64 arg1) noexcept {
+        arg0_ = arg0;
+        arg1_ = arg1;
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceComponent component_;
+    TraceEvent event_;
+    bool active_;
+    u64 arg0_;
+    u64 arg1_;
+};
+
+// ==========================================================================
+// CONTROL AND EXPORT
+// ==========================================================================
+
+// Enable the components in mask (TraceComponentBit values), disable the rest.
+// The first enable anchors TSC against the steady clock for the dump.
+void SetTraceMask(u32 mask) noexcept;
+u32 GetTraceMask() noexcept;
+
+// Forget every recorded event. Only meaningful while tracing is disabled.
+void ResetTrace() noexcept;
+
+// Write every ring as Chrome trace JSON to path. Safe while threads keep
+// tracing; records overwritten during the copy are dropped. Returns the
+// number of events written, 0 if the file could not be created.
+u64 DumpTrace(const char* path) noexcept;
+
+// Records lost because every ring was already claimed
+u64 GetTraceDroppedCount() noexcept;
+
+// ==========================================================================
+// TRACE POINT MACROS
+// ==========================================================================
+
+#if AARENDOCORE_ENABLE_PROFILING
+    #define AARENDOCORE_TRACE_CONCAT_INNER(a, b) a##b
+    #define AARENDOCORE_TRACE_CONCAT(a, b) AARENDOCORE_TRACE_CONCAT_INNER(a, b)
+
+    // Declares traceScope (for SCOPE_ARGS) - at most one per block.
+    // Arguments are evaluated only while the component is enabled.
+    #define AARENDOCORE_TRACE_SCOPE(component, event, arg0, arg1) \
+        ::AARendoCoreGLM::TraceScope traceScope( \
+            ::AARendoCoreGLM::TraceComponent::component, \
+            ::AARendoCoreGLM::TraceEvent::event); \
+        if (traceScope.active()) \
+            traceScope.begin(static_cast<::AARendoCoreGLM::u64>(arg0), \
+                             static_cast<::AARendoCoreGLM::u64>(arg1))
+
+    #define AARENDOCORE_TRACE_SCOPE_ARGS(arg0, arg1) \
+        do { \
+            if (traceScope.active()) \
+                traceScope.setArgs(static_cast<::AARendoCoreGLM::u64>(arg0), \
+                                   static_cast<::AARendoCoreGLM::u64>(arg1)); \
+        } while (0)
+
+    #define AARENDOCORE_TRACE_INSTANT(component, event, arg0, arg1) \
+        do { \
+            if (::AARendoCoreGLM::TraceEnabled(::AARendoCoreGLM::TraceComponent::component)) \
+                ::AARendoCoreGLM::TraceWrite( \
+                    ::AARendoCoreGLM::TraceComponent::component, \
+                    ::AARendoCoreGLM::TraceEvent::event, \
+                    ::AARendoCoreGLM::TracePhase::INSTANT, \
+                    static_cast<::AARendoCoreGLM::u64>(arg0), \
+                    static_cast<::AARendoCoreGLM::u64>(arg1)); \
+        } while (0)
+#else
+    #define AARENDOCORE_TRACE_SCOPE(component, event, arg0, arg1) ((void)0)
+    #define AARENDOCORE_TRACE_SCOPE_ARGS(arg0, arg1) ((void)0)
+    #define AARENDOCORE_TRACE_INSTANT(component, event, arg0, arg1) ((void)0)
+#endif
+
+// ==========================================================================
+// EXPORTS
+// ==========================================================================
+
+extern "C" {
+    AARENDOCORE_API void AARendoCore_SetTraceMask(u32 mask);
+    AARENDOCORE_API u64 AARendoCore_DumpTrace(const char* path);
+
+    // Cost of one scoped trace point (BEGIN + END) with its component
+    // enabled or disabled. Returns average ns per scope.
+    AARENDOCORE_API u64 AARendoCore_TestTraceOverhead(u32 iterations, u32 enabled);
+}
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_TRACE_H
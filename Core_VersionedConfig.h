@@ -0,0 +1,161 @@
+//===--- Core_VersionedConfig.h - RCU-Published Configuration Snapshots --===//
+//
+// COMPILATION LEVEL: 2 (Depends on EpochReclaim)
+// ORIGIN: NEW - Runtime reconfiguration without pausing processing units
+// DEPENDENCIES: Core_Platform.h, Core_Types.h, Core_EpochReclaim.h
+// DEPENDENTS: BaseProcessingUnit and every concrete processing unit
+//
+// A configuration is published as an immutable snapshot carrying a version;
+// a writer swaps it in with one pointer CAS and retires the old one through
+// the epoch manager, so it is freed only after every reader has left it.
+//
+// The processing thread never reads a snapshot field by field while it
+// processes. At a batch boundary it compares one version word and, only if
+// it moved, copies the new snapshot into its own working copy. Everything
+// inside a batch therefore sees one configuration, and the steady state
+// costs a single load - no epoch entry, no shared line written.
+//===----------------------------------------------------------------------===//
+
+#ifndef AARENDOCORE_CORE_VERSIONEDCONFIG_H
+#define AARENDOCORE_CORE_VERSIONEDCONFIG_H
+
+#include "Core_Platform.h"
+#include "Core_Types.h"
+#include "Core_EpochReclaim.h"
+#include <atomic>
+#include <new>
+
+namespace AARendoCoreGLM {
+
+// ==========================================================================
+// VERSIONED CONFIG
+// ==========================================================================
+
+// Origin: Single-pointer RCU cell for a trivially copyable config struct
+// Scope: One per config a unit exposes; writers any thread, readers any thread
+template<typename T>
+class VersionedConfig {
+public:
+    // Origin: Immutable once published
+    struct Snapshot {
+        T value;
+        u64 version;
+    };
+
+    // Nothing published yet reads as T{} at version 0
+    VersionedConfig() noexcept : current_(nullptr), version_(0) {}
+
+    // Only safe once no reader can still be inside - i.e. the unit is gone
+    ~VersionedConfig() noexcept {
+        delete current_.load(std::memory_order_relaxed);
+    }
+
+    VersionedConfig(const VersionedConfig&) = delete;
+    VersionedConfig& operator=(const VersionedConfig&) = delete;
+
+    // Writer: copy value into a fresh snapshot and make it current.
+    // Concurrent publishers are ordered by the CAS; versions stay unique.
+    // Returns the new version, 0 if the snapshot could not be allocated.
+    u64 publish(const T& value) noexcept {
+        Snapshot* next = new(std::nothrow) Snapshot{value, 0};
+        if (!next) {
+            return 0;
+        }
+
+        // Inside an epoch: a racing publisher may retire previous under us
+        EpochGuard guard;
+        Snapshot* previous = current_.load(std::memory_order_acquire);
+        do {
+            next->version = (previous ? previous->version : 0) + 1;
+        } while (!current_.compare_exchange_weak(previous, next,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire));
+
+        publishVersion(next->version);
+        if (previous) {
+            GetEpochManager().retire(previous, reclaimSnapshot);
+        }
+        return next->version;
+    }
+
+    // Writer: read-copy-update - apply modify(T&) to a copy of the latest
+    // snapshot and swap it in, redoing it if another publisher got there
+    // first. Needs a published snapshot to start from; returns 0 without one.
+    template<typename Modify>
+    u64 update(Modify modify) noexcept {
+        Snapshot* next = new(std::nothrow) Snapshot{T{}, 0};
+        if (!next) {
+            return 0;
+        }
+
+        EpochGuard guard;
+        Snapshot* previous = current_.load(std::memory_order_acquire);
+        do {
+            if (!previous) {
+                delete next;
+                return 0;
+            }
+            next->value = previous->value;
+            modify(next->value);
+            next->version = previous->version + 1;
+        } while (!current_.compare_exchange_weak(previous, next,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire));
+
+        publishVersion(next->version);
+        GetEpochManager().retire(previous, reclaimSnapshot);
+        return next->version;
+    }
+
+    // Latest published version (0 until the first publish)
+    u64 version() const noexcept {
+        return version_.load(std::memory_order_acquire);
+    }
+
+    // Reader at a batch boundary: copy the latest snapshot into local if it
+    // is newer than seen. Returns true if local changed.
+    bool refresh(T& local, u64& seen) const noexcept {
+        if (version_.load(std::memory_order_acquire) == seen) {
+            return false;
+        }
+
+        EpochGuard guard;
+        const Snapshot* snapshot = current_.load(std::memory_order_acquire);
+        if (!snapshot || snapshot->version == seen) {
+            return false;
+        }
+        local = snapshot->value;
+        seen = snapshot->version;
+        return true;
+    }
+
+    // Cold readers (getters, validation): a consistent copy of the latest
+    T load() const noexcept {
+        EpochGuard guard;
+        const Snapshot* snapshot = current_.load(std::memory_order_acquire);
+        return snapshot ? snapshot->value : T{};
+    }
+
+private:
+    // Version last - a reader that sees it move finds the new snapshot.
+    // Monotonic, so a slow publisher cannot move it backwards.
+    void publishVersion(u64 version) noexcept {
+        u64 seen = version_.load(std::memory_order_relaxed);
+        while (seen < version &&
+               !version_.compare_exchange_weak(seen, version,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+    }
+
+    static void reclaimSnapshot(void* object, [[maybe_unused]] void* context) noexcept {
+        delete static_cast<Snapshot*>(object);
+    }
+
+    std::atomic<Snapshot*> current_;         // nullptr until the first publish
+    std::atomic<u64> version_;               // Change hint for refresh()
+};
+
+} // namespace AARendoCoreGLM
+
+#endif // AARENDOCORE_CORE_VERSIONEDCONFIG_H